@@ -0,0 +1,47 @@
+#ifndef DD_TrackerBoundingBox_h
+#define DD_TrackerBoundingBox_h
+
+/*
+
+  Axis aligned bounding box of a solid in its own frame, computed
+  analytically from the solid parameters (box, tubs, cons, trap,
+  pseudotrap, polycone, polyhedra, torus and the boolean solids built
+  from them), and its transformation to the frame of a mother volume.
+
+*/
+
+#include "DetectorDescription/Core/interface/DDSolid.h"
+#include "DetectorDescription/Core/interface/DDTransform.h"
+
+class DDTrackerBoundingBox {
+
+public:
+
+  DDTrackerBoundingBox();
+  DDTrackerBoundingBox(double xmin, double ymin, double zmin,
+		       double xmax, double ymax, double zmax);
+  explicit DDTrackerBoundingBox(const DDSolid & solid);
+
+  bool   valid() const {return lo[0] <= hi[0];}
+  double center(int k) const {return 0.5*(lo[k]+hi[k]);}
+  double half(int k) const {return 0.5*(hi[k]-lo[k]);}
+  double area() const;
+
+  void   extend(double x, double y, double z);
+  void   extend(const DDTrackerBoundingBox & box);
+  bool   contains(double x, double y, double z, double tol=0) const;
+  bool   overlaps(const DDTrackerBoundingBox & box, double tol=0) const;
+
+  //Box of this box rotated by rot and translated by tran
+  DDTrackerBoundingBox transformed(const DDRotationMatrix & rot,
+				   const DDTranslation & tran) const;
+
+  double lo[3], hi[3];
+
+private:
+
+  void   extendPhi(double rmin, double rmax, double phi0, double dphi,
+		   double zmin, double zmax);
+};
+
+#endif
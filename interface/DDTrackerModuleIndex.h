@@ -0,0 +1,115 @@
+#ifndef DD_TrackerModuleIndex_h
+#define DD_TrackerModuleIndex_h
+
+/*
+
+  Index of the modules positioned in regular rings (TIB layers, TID
+  rings, pixel barrel layers, ...), keyed by layer/ring volume (whose
+  namespace identifies the subdetector) and by phi bin, so that a point
+  is mapped to its candidate module copies in constant time.
+
+  It is a product of the geometry build: fill() makes it from the
+  finished compact view, through a transform cache of the volumes below
+  a root, for the given layer/ring volumes. The modules of a layer are
+  the volumes placed in it off its axis (only those of the given names,
+  if any) which hold a sensor, i.e. one of the sensitive logical parts
+  given to fill() is the module itself or is placed below it (any
+  volume if none is given); cooling pipes, ICCs, cables, ... are not
+  indexed. A layer has as many phi
+  bins as modules, the first module being at the centre of bin 0, and a
+  bin returns the modules of the bin and of its two neighbours. Each
+  placement of a layer below the root is kept with its global
+  transformation and its box in the world frame; the placements are
+  binned in world z, so that a point in the world frame is only
+  compared with the placements of its z bin before it is looked up in
+  the frame of their layers:
+    DDTrackerModuleIndex index;
+    index.open("TrackerModuleIndex.bin");
+    std::vector<DDTrackerModuleIndex::Module> mods =
+      index.candidates(DDName("TIDRing1F", "tidring1f"), DDTranslation(x,y,z));
+    std::vector<DDTrackerModuleIndex::Hit> hits =
+      index.candidates(DDTranslation(x,y,z));
+
+  DDTrackerModuleIndexExport fills it at the end of a build and writes
+  it with write(); nothing is kept from one build to the next.
+
+*/
+
+#include <map>
+#include <string>
+#include <vector>
+#include "DetectorDescription/Core/interface/DDName.h"
+#include "DetectorDescription/Core/interface/DDTransform.h"
+
+class DDTrackerTransformCache;
+
+class DDTrackerModuleIndex {
+
+public:
+
+  struct Module {
+    DDName child;    //Positioned volume
+    int    copyNo;   //Its copy number in the layer/ring
+    double phi;      //Its azimuth in the layer/ring frame
+  };
+
+  class Layer {
+  public:
+    Layer(int nBins=1, double phiOffset=0);
+    int    bin(double phi) const;
+    void   add(const Module & module);
+    void   candidates(double x, double y, std::vector<Module> & result) const;
+    const std::vector<Module> & modules(int bin) const {return bins_[bin];}
+    int    nBins()     const {return (int)(bins_.size());}
+    double phiOffset() const {return phiOffset_;}
+    double lo[3], hi[3];       //Bounding box in the layer/ring frame
+  private:
+    double                            phiOffset_;
+    double                            invWidth_;
+    std::vector<std::vector<Module> > bins_;
+  };
+
+  //Placement of a layer/ring in the world
+  struct Instance {
+    DDName layer;
+    double global[12];         //3x4 row-major (rotation | translation)
+    double lo[3], hi[3];       //Bounding box in the world frame
+  };
+
+  //Candidate of a point given in the world frame
+  struct Hit {
+    int    instance;           //Placement of the layer/ring
+    Module module;
+  };
+
+  DDTrackerModuleIndex();
+
+  //Indexes the layers/rings among the volumes of the cache and keeps
+  //their placements; returns the number of layers/rings found
+  int  fill(const DDTrackerTransformCache & cache,
+	    const std::vector<DDName> & layers,
+	    const std::vector<DDName> & children,
+	    const std::vector<DDName> & sensors);
+  void clear();
+
+  bool write(const std::string & file) const;
+  bool open(const std::string & file);
+
+  const Layer* layer(const DDName & layer) const;
+  std::vector<Module> candidates(const DDName & layer,
+				 const DDTranslation & point) const;
+  std::vector<Hit>    candidates(const DDTranslation & point) const;
+  std::vector<DDName> layers(const std::string & subdetector) const;
+  const std::vector<Instance> & instances() const {return instances_;}
+
+private:
+
+  void bin();
+
+  std::map<DDName, Layer>        layers_;
+  std::vector<Instance>          instances_;
+  double                         zmin_, zmax_, invDz_;
+  std::vector<std::vector<int> > zBins_;   //Instances overlapping a z bin
+};
+
+#endif
@@ -0,0 +1,100 @@
+#ifndef DD_TrackerSpecParMatcher_h
+#define DD_TrackerSpecParMatcher_h
+
+/*
+
+  Matcher of the SpecPar part selectors of the tracker (structure
+  topology, reco material, sensitive, products) against the volumes
+  of the expanded geometry. The selectors are of the form
+
+    //Name                   any volume with logical part Name
+    //A/B/Name               any Name in a B in an A
+    //A//Name                any Name anywhere below an A
+
+  A step with a namespace (tob:Name) only matches the logical part of
+  that namespace, a step without one matches Name in any namespace.
+  All the selectors of all the SpecPars are compiled into one trie of
+  interned step names, read from the last step of a selector upwards,
+  so that every volume is matched against all the selectors in one walk
+  up its ancestors, which stops as soon as no selector goes on. A "/"
+  step must match the mother of the volume matched by the step below
+  it, a "//" step any of its ancestors.
+
+  The SpecPars are read (readFile, addSpecPar) and then compiled once;
+  the matching is const and only reads the compiled trie. It runs over
+  a range of nodes of a DDTrackerTransformCache: the subtree of a node is
+  a contiguous range, so that subtrees can be matched independently.
+  report() gives the number of volumes matched by each SpecPar.
+
+  The matcher serves the tracker tools which need the SpecPars of the
+  volumes outside of the DDD (DDTrackerSnapshot); the SpecPars of the
+  compact view itself are still applied by the DDD.
+
+*/
+
+#include <map>
+#include <string>
+#include <utility>
+#include <vector>
+
+class DDTrackerTransformCache;
+
+class DDTrackerSpecParMatcher {
+
+public:
+
+  struct SpecPar {
+    std::string              name;
+    std::string              file;
+    std::vector<std::string> selectors;
+    std::vector<std::pair<std::string,std::string> > parameters;
+  };
+
+  DDTrackerSpecParMatcher();
+
+  //Reads the SpecPars of a DDL file; returns the number read
+  int  readFile(const std::string & file);
+  void addSpecPar(const SpecPar & specPar);
+  //Compiles the selectors; must be called after the last SpecPar is
+  //added and before matching
+  void compile();
+  bool compiled() const {return compiled_;}
+
+  //Matches the nodes [first, last) of the cache: the SpecPars of node
+  //first+i are ids[offsets[i] ... offsets[i+1]-1]
+  void match(const DDTrackerTransformCache & cache, int first, int last,
+	     std::vector<int> & offsets, std::vector<int> & ids) const;
+  //Same for any tree given by the parent (-1 for none) and the logical
+  //part name (ns:name, or name alone) of every node
+  void match(const std::vector<int> & parents,
+	     const std::vector<std::string> & names,
+	     std::vector<int> & offsets, std::vector<int> & ids) const;
+
+  const std::vector<SpecPar> & specPars() const {return specPars_;}
+  int  specPar(const std::string & name) const;
+  //Logs the number of volumes matched by every SpecPar in ids
+  void report(const std::vector<int> & ids) const;
+
+private:
+
+  struct Step {
+    std::map<int, int> mother;    //Next step in the mother, by name id
+    std::map<int, int> ancestor;  //Next step in any ancestor
+    std::vector<int>   specPars;  //SpecPars whose selector ends here
+  };
+
+  //Nodes are given by the ids of their qualified and bare names
+  void matchNodes(const std::vector<int> & parents,
+		  const std::vector<int> & qualified,
+		  const std::vector<int> & bare, int first, int last,
+		  std::vector<int> & offsets, std::vector<int> & ids) const;
+  int  intern(const std::string & name);
+  int  id(const std::string & name) const;
+
+  std::vector<SpecPar>       specPars_;
+  std::map<std::string, int> names_;
+  std::vector<Step>          trie_;     //Step 0 is the root
+  bool                       compiled_;
+};
+
+#endif
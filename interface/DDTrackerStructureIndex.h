@@ -0,0 +1,87 @@
+#ifndef DD_TrackerStructureIndex_h
+#define DD_TrackerStructureIndex_h
+
+/*
+
+  Index of the placed volumes by structure level and copy number path,
+  as defined by the TkDDDStructure SpecPars of trackerStructureTopology:
+  a volume selected by a SpecPar with a TkDDDStructure parameter belongs
+  to the level given by its value, and its copy number path is the list
+  of copy numbers of itself and of all its ancestors which belong to a
+  level, from the top down.
+
+  The SpecPars are matched with a compiled DDTrackerSpecParMatcher over
+  the nodes of a DDTrackerTransformCache (the shared one of the build),
+  and the index is built in one pass in depth first order. For every
+  level the copy number paths are stored in a trie of dense arrays
+  indexed by the copy number, so that a lookup costs one array access
+  per level of the path instead of a walk of the selectors over the
+  whole tree. The handles returned are node indices of the transform
+  cache.
+
+    DDTrackerSpecParMatcher matcher;
+    matcher.readFile(edm::FileInPath(topologyFile).fullPath());
+    matcher.compile();
+    DDTrackerStructureIndex index(DDTrackerTransformCache::shared(cpv, root),
+				  matcher);
+    int node = index.find("PixelBarrelLayer", path);
+
+*/
+
+#include <string>
+#include <vector>
+
+class DDTrackerSpecParMatcher;
+class DDTrackerTransformCache;
+
+class DDTrackerStructureIndex {
+
+public:
+
+  DDTrackerStructureIndex(const DDTrackerTransformCache & cache,
+			  const DDTrackerSpecParMatcher & matcher,
+			  const std::string & parameter="TkDDDStructure");
+  //Same for any tree given by the parent (-1 for none), the logical part
+  //name and the copy number of every node
+  DDTrackerStructureIndex(const std::vector<int> & parents,
+			  const std::vector<std::string> & names,
+			  const std::vector<int> & copyNos,
+			  const DDTrackerSpecParMatcher & matcher,
+			  const std::string & parameter="TkDDDStructure");
+
+  const std::vector<std::string> & levels() const {return levels_;}
+  int  level(const std::string & name) const;
+
+  //Node of the transform cache (-1 if not found)
+  int  find(int level, const std::vector<int> & path) const;
+  int  find(const std::string & level, const std::vector<int> & path) const;
+
+  //Nodes of one level, in depth first order
+  const std::vector<int> & nodes(int level) const {return members_[level];}
+
+  //Level (-1 if none) and copy number path of a node
+  int  level(int node) const {return nodeLevel_[node];}
+  void path(int node, std::vector<int> & result) const;
+
+private:
+
+  struct TrieNode {
+    int              node;        //Node of the cache ending here (or -1)
+    std::vector<int> next;        //Trie node per copy number (or -1)
+  };
+
+  void fill(const std::vector<int> & parents,
+	    const DDTrackerSpecParMatcher & matcher,
+	    const std::vector<int> & offsets, const std::vector<int> & ids,
+	    const std::string & parameter);
+  int  insert(int level, const std::vector<int> & path, int node);
+
+  std::vector<int>                copyNo_;
+  std::vector<std::string>        levels_;
+  std::vector<std::vector<int> >  members_;
+  std::vector<int>                nodeLevel_;
+  std::vector<int>                tagged_;    //Nearest ancestor in a level
+  std::vector<TrieNode>           trie_;      //Roots are 0 ... nlevels-1
+};
+
+#endif
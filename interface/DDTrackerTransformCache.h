@@ -0,0 +1,100 @@
+#ifndef DD_TrackerTransformCache_h
+#define DD_TrackerTransformCache_h
+
+/*
+
+  Cache of the transformations of all the volumes below a root volume
+  (tracker:Tracker, a subdetector, ...), expanded once from the finished
+  compact view (DDExpandedView), so that the placements of the XML files
+  are included as well as those of the algorithms. The root is node 0
+  and the expanded tree is stored flat in depth first order: the parent
+  of a node precedes it and the subtree of a node occupies the nodes
+  [node, node+size(node)). Local and global transformations are 3x4
+  row-major matrices (rotation | translation) of 12 doubles per node;
+  the global ones are in the frame of the world volume and are all
+  obtained in one forward pass over the arrays.
+
+  Leaves (volumes without daughters) get dense ids 0 ... n-1 in depth
+  first order. When a placement changes, update() replaces its local
+  transformation in all its instances and recomputes only the subtrees
+  below them.
+
+  The walk of the expanded view is serial (the DDD stores are not
+  thread safe); the local transformations are then derived from the
+  global ones in parallel over blocks of nodes. The post-build steps
+  (module index, sensor table, overlap check, snapshot, ...) come after
+  all the files which position volumes and share one cache per root
+  through shared(); DDTrackerBuildReport releases them at the end of
+  the build.
+
+*/
+
+#include <map>
+#include <vector>
+#include "DetectorDescription/Core/interface/DDName.h"
+#include "DetectorDescription/Core/interface/DDTransform.h"
+
+class DDCompactView;
+
+class DDTrackerTransformCache {
+
+public:
+
+  DDTrackerTransformCache(const DDCompactView & cpv, const DDName & root);
+
+  //Cache of root for the current build, expanded at the first request
+  static const DDTrackerTransformCache & shared(const DDCompactView & cpv,
+						const DDName & root);
+  //Deletes the shared caches (end of the build)
+  static void                           release();
+
+  const DDName & root()   const {return root_;}
+  int            nodes()  const {return (int)(part_.size());}
+  int            leaves() const {return (int)(leafNode_.size());}
+
+  //Node structure
+  const DDName & part(int node) const {return part_[node];}
+  int copyNo(int node)    const {return copyNo_[node];}
+  int parent(int node)    const {return parent_[node];}
+  int size(int node)      const {return size_[node];}
+  int leafNode(int leaf)  const {return leafNode_[leaf];}
+  int leafId(int node)    const {return leafId_[node];}
+
+  //3x4 matrices (12 doubles)
+  const double* local(int node)  const {return &local_[12*node];}
+  const double* global(int node) const {return &global_[12*node];}
+  const double* leaf(int leaf)   const {return &global_[12*leafNode_[leaf]];}
+  static void   transform(const double* m, DDRotationMatrix & rot,
+			  DDTranslation & tran);
+
+  //Replaces the transformation of copy copyNo of child in mother in all
+  //its instances; returns the number of nodes recomputed
+  int update(const DDName & mother, const DDName & child, int copyNo,
+	     const DDRotationMatrix & rot, const DDTranslation & tran);
+
+private:
+
+  struct Placement {
+    DDName mother, child;
+    int    copyNo;
+    bool operator<(const Placement & p) const;
+  };
+
+  void compose(int first, int last);
+  void localize(int first, int last);
+  static void setMatrix(double* m, const DDRotationMatrix & rot,
+			const DDTranslation & tran);
+
+  DDName                          root_;
+  std::vector<DDName>             part_;
+  std::vector<int>                copyNo_;
+  std::vector<int>                parent_;
+  std::vector<int>                size_;
+  std::vector<int>                leafId_;    //-1 for inner nodes
+  std::vector<int>                leafNode_;
+  std::vector<double>             local_;
+  std::vector<double>             global_;
+  std::multimap<Placement, int>   instances_; //Placement -> nodes
+};
+
+#endif
@@ -0,0 +1,67 @@
+#ifndef DD_TrackerVolumeTree_h
+#define DD_TrackerVolumeTree_h
+
+/*
+
+  Bounding volume hierarchy over the volumes below a root volume. The
+  volumes are the nodes of a DDTrackerTransformCache (XML placements as
+  well as those of the algorithms); the bounding box of every logical
+  part is computed once analytically from its solid (DDTrackerBoundingBox)
+  and transformed with the global transformation of each node, so that
+  the boxes are in the frame of the world volume. A binned surface area
+  heuristic tree is built over them.
+
+  Nodes are stored depth first in one array of 32 bytes per node; the
+  left child of an inner node follows it, the right child is at 'index'.
+  Leaves reference 'count' consecutive entries, starting at 'index', of
+  the volume list sorted in leaf order. Volumes without a valid bounding
+  box (solid not defined) are not in the tree. The query results are
+  the node numbers of the cache (or the indices of the boxes given to
+  the constructor).
+
+  Queries: volumes whose box contains a point, volumes whose box overlaps
+  a box, and volumes whose box is crossed by a ray (sorted by distance).
+
+*/
+
+#include <utility>
+#include <vector>
+#include "DetectorDescription/Core/interface/DDTransform.h"
+#include "Geometry/TrackerCommonData/interface/DDTrackerBoundingBox.h"
+
+class DDTrackerTransformCache;
+
+class DDTrackerVolumeTree {
+
+public:
+
+  struct Node {
+    float lo[3];
+    int   index;
+    float hi[3];
+    int   count;                      //0 for inner nodes
+  };
+
+  explicit DDTrackerVolumeTree(const DDTrackerTransformCache & cache);
+  explicit DDTrackerVolumeTree(const std::vector<DDTrackerBoundingBox> & boxes);
+
+  int                          volumes() const {return (int)(boxes_.size());}
+  const DDTrackerBoundingBox & box(int v) const {return boxes_[v];}
+  const std::vector<Node> &    nodes()   const {return nodes_;}
+
+  void findPoint(double x, double y, double z, std::vector<int> & hits) const;
+  void findBox(const DDTrackerBoundingBox & box, std::vector<int> & hits) const;
+  void findRay(const DDTranslation & origin, const DDTranslation & dir,
+	       double tmax, std::vector<std::pair<double,int> > & hits) const;
+
+private:
+
+  void build();
+  int  build(int first, int last, const std::vector<double> & centroids);
+
+  std::vector<DDTrackerBoundingBox> boxes_;  //World box of every volume
+  std::vector<int>                  order_;  //Volumes in the order of the leaves
+  std::vector<Node>                 nodes_;
+};
+
+#endif
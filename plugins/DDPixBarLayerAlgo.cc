@@ -14,6 +14,8 @@
 #include "DetectorDescription/Core/interface/DDCurrentNamespace.h"
 #include "DetectorDescription/Core/interface/DDSplit.h"
 #include "Geometry/TrackerCommonData/plugins/DDPixBarLayerAlgo.h"
+#include "Geometry/TrackerCommonData/plugins/DDTrackerEnvelopeCheck.h"
+#include "Geometry/TrackerCommonData/plugins/DDTrackerSensorTable.h"
 #include "CLHEP/Units/GlobalPhysicalConstants.h"
 #include "CLHEP/Units/GlobalSystemOfUnits.h"
 
@@ -95,6 +97,8 @@ void DDPixBarLayerAlgo::execute(DDCompactView& cpv) {
   DDName matname(DDSplit(genMat).first, DDSplit(genMat).second);
   DDMaterial matter(matname);
   DDLogicalPart layer(solid.ddname(), matter, solid);
+  DDTrackerEnvelopeCheck envelope("DDPixBarLayerAlgo", layer.name(), rtmi,
+				  rtmx, 0.5*layerDz);
 
   double rr = 0.5*(rmax+rmin);
   double dr = 0.5*(rmax-rmin);
@@ -130,6 +134,8 @@ void DDPixBarLayerAlgo::execute(DDCompactView& cpv) {
 
   DDName ladderFull(DDSplit(ladder[0]).first, DDSplit(ladder[0]).second);
   DDName ladderHalf(DDSplit(ladder[1]).first, DDSplit(ladder[1]).second);
+  DDTrackerSensorTable::instance().defineModule(cpv, DDLogicalPart(ladderFull));
+  DDTrackerSensorTable::instance().defineModule(cpv, DDLogicalPart(ladderHalf));
 
   int nphi=number/2, copy=1, iup=-1;
   double phi0 = 90*CLHEP::deg;
@@ -153,6 +159,7 @@ void DDPixBarLayerAlgo::execute(DDCompactView& cpv) {
 			    << ", 0, 0";
       rot = DDrot(DDName(rots,idNameSpace), 90*CLHEP::deg, phix, 90*CLHEP::deg,
 		  phiy, 0.,0.);
+      envelope.checkPart(DDLogicalPart(ladderHalf), copy, tran, rot);
      cpv.position(ladderHalf, layer, copy, tran, rot);
       LogDebug("PixelGeom") << "DDPixBarLayerAlgo test: " << ladderHalf 
 			    << " number " << copy << " positioned in " 
@@ -171,6 +178,7 @@ void DDPixBarLayerAlgo::execute(DDCompactView& cpv) {
 			    << ", 0, 0";
       rot = DDrot(DDName(rots,idNameSpace), 90*CLHEP::deg, phix, 90*CLHEP::deg,
 		  phiy, 0.,0.);
+      envelope.checkPart(DDLogicalPart(ladderHalf), copy, tran, rot);
      cpv.position(ladderHalf, layer, copy, tran, rot);
       LogDebug("PixelGeom") << "DDPixBarLayerAlgo test: " << ladderHalf 
 			    << " number " << copy << " positioned in " 
@@ -191,6 +199,7 @@ void DDPixBarLayerAlgo::execute(DDCompactView& cpv) {
 			    << ", 0, 0";
       rot = DDrot(DDName(rots,idNameSpace), 90*CLHEP::deg, phix, 90*CLHEP::deg,
 		  phiy, 0.,0.);
+      envelope.checkPart(DDLogicalPart(ladderFull), copy, tran, rot);
      cpv.position(ladderFull, layer, copy, tran, rot);
       LogDebug("PixelGeom") << "DDPixBarLayerAlgo test: " << ladderFull 
 			    << " number " << copy << " positioned in " 
@@ -211,6 +220,7 @@ void DDPixBarLayerAlgo::execute(DDCompactView& cpv) {
 			  << ", 0, 0";
     rot = DDrot(DDName(rots,idNameSpace), 90*CLHEP::deg, phix, 90*CLHEP::deg,
 		phiy, 0.,0.);
+    envelope.checkPart(coolTube, i+1, tran, rot);
    cpv.position(coolTube, layer, i+1, tran, rot);
     LogDebug("PixelGeom") << "DDPixBarLayerAlgo test: " << coolTube.name() 
 			  << " number " << i+1 << " positioned in " 
@@ -13,7 +13,6 @@
 
 #include "FWCore/MessageLogger/interface/MessageLogger.h"
 #include "DetectorDescription/Base/interface/DDRotationMatrix.h"
-#include "DetectorDescription/Base/interface/DDutils.h"
 #include "DetectorDescription/Core/interface/DDLogicalPart.h"
 #include "DetectorDescription/Core/interface/DDSolid.h"
 #include "DetectorDescription/Core/interface/DDMaterial.h"
@@ -21,6 +20,7 @@
 #include "DetectorDescription/Core/interface/DDSplit.h"
 #include "DetectorDescription/Core/interface/DDConstant.h"
 #include "Geometry/TrackerCommonData/plugins/DDPixFwdBlades.h"
+#include "Geometry/TrackerCommonData/plugins/DDTrackerBufferCounter.h"
 #include "CLHEP/Vector/RotationInterfaces.h"
 #include "CLHEP/Units/GlobalPhysicalConstants.h"
 #include "CLHEP/Units/GlobalSystemOfUnits.h"
@@ -93,8 +93,7 @@ void DDPixFwdBlades::initialize(const DDNumericArguments & nArgs,
   
   // -- Static initialization :  -----------------------------------------------------------
 
-  nippleRotationZPlus = 0;
-  nippleRotationZMinus = 0;
+  nippleComputed = false;
   nippleTranslationX = 0.;
   nippleTranslationY = 0.;
   nippleTranslationZ = 0.;
@@ -109,9 +108,11 @@ void DDPixFwdBlades::execute(DDCompactView& cpv) {
 
   // -- Compute Nipple parameters if not already computed :
   
-  if (!nippleRotationZPlus) {
+  DDTrackerBufferCounter::Scope buffers("DDPixFwdBlades");
+  if (!nippleComputed) {
     computeNippleParameters(1.);   // Z Plus endcap
     computeNippleParameters(-1.);  // Z Minus endcap
+    nippleComputed = true;
   }
   if (childName == "") return;
   
@@ -136,9 +137,9 @@ void DDPixFwdBlades::execute(DDCompactView& cpv) {
     CLHEP::HepRep3x3 tr(x.X(), y.X(), z.X(), x.Y(), y.Y(), z.Y(), x.Z(), y.Z(), z.Z());
     childRotMatrix = CLHEP::HepRotation(tr);
   } else if (childName == "pixfwdNipple:PixelForwardNippleZPlus") {
-    childRotMatrix = *nippleRotationZPlus;
+    childRotMatrix = nippleRotationZPlus;
   } else if (childName == "pixfwdNipple:PixelForwardNippleZMinus") {
-    childRotMatrix = *nippleRotationZMinus;
+    childRotMatrix = nippleRotationZMinus;
   }
   
   CLHEP::Hep3Vector childTranslation;
@@ -159,6 +160,9 @@ void DDPixFwdBlades::execute(DDCompactView& cpv) {
   double deltaPhi = (360./nBlades)*CLHEP::deg;
   int nQuarter = nBlades/4;
   double zShiftMax = effBladeZShift*((nQuarter-1)/2.);
+  std::string & rotPrefix = DDTrackerBufferCounter::string();
+  rotPrefix.append(DDSplit(mother).first).append(DDSplit(childName).first);
+  std::string & rotstr = DDTrackerBufferCounter::string();
 
   for (int iBlade=0; iBlade < nBlades; iBlade++) {
     
@@ -186,14 +190,15 @@ void DDPixFwdBlades::execute(DDCompactView& cpv) {
     // create DDRotation for placing the child if not already existent :
 
     DDRotation rotation;   
-    std::string rotstr = DDSplit(mother).first + DDSplit(childName).first + int_to_string(copy);
+    rotstr = rotPrefix;
+    DDTrackerBufferCounter::append(rotstr, copy);
     rotation = DDRotation(DDName(rotstr, idNameSpace));
 
     if (!rotation) {
       rotMatrix *= childRotMatrix;
-      DDRotationMatrix* temp = new DDRotationMatrix(rotMatrix.xx(), rotMatrix.xy(), rotMatrix.xz(),
-						    rotMatrix.yx(), rotMatrix.yy(), rotMatrix.yz(),
-						    rotMatrix.zx(), rotMatrix.zy(), rotMatrix.zz() );
+      DDRotationMatrix* temp = DDTrackerBufferCounter::keep(new DDRotationMatrix(rotMatrix.xx(), rotMatrix.xy(), rotMatrix.xz(),
+									  rotMatrix.yx(), rotMatrix.yy(), rotMatrix.yz(),
+									  rotMatrix.zx(), rotMatrix.zy(), rotMatrix.zz()));
       rotation = DDrot(DDName(rotstr, idNameSpace), temp);
     }
     // position the child :
@@ -257,7 +262,7 @@ void DDPixFwdBlades::computeNippleParameters(double endcap) {
   // Vector JK in the "cover" blade frame:
   
   CLHEP::Hep3Vector jkC = kC - jC;
-  double* jkLength = new double(jkC.mag());
+  double* jkLength = DDTrackerBufferCounter::keep(new double(jkC.mag()));
   DDConstant JK(DDName("JK", "pixfwdNipple"), jkLength);
   LogDebug("PixelGeom") << "+++++++++++++++ DDPixFwdBlades: " << "JK Length " <<  *jkLength * CLHEP::mm;
   
@@ -277,32 +282,31 @@ void DDPixFwdBlades::computeNippleParameters(double endcap) {
   CLHEP::Hep3Vector axis = vZ.cross(jkC);
   double angleCover = vZ.angle(jkC);
   LogDebug("PixelGeom") << " Angle to Cover: " << angleCover;
-  CLHEP::HepRotation* rpCN = new CLHEP::HepRotation(axis, angleCover);
+  CLHEP::HepRotation rpCN(axis, angleCover);
   if (endcap > 0.) {
     nippleRotationZPlus = rpCN;
   } else {
     nippleRotationZMinus = rpCN;
   }
-  //( endcap > 0. ? nippleRotationZPlus : nippleRotationZMinus ) = rpCN;
 
-  DDRotationMatrix* ddrpCN = new DDRotationMatrix(rpCN->xx(), rpCN->xy(), rpCN->xz(),
-						  rpCN->yx(), rpCN->yy(), rpCN->yz(),
-						  rpCN->zx(), rpCN->zy(), rpCN->zz() );
+  DDRotationMatrix* ddrpCN = DDTrackerBufferCounter::keep(new DDRotationMatrix(rpCN.xx(), rpCN.xy(), rpCN.xz(),
+									rpCN.yx(), rpCN.yy(), rpCN.yz(),
+									rpCN.zx(), rpCN.zy(), rpCN.zz()));
 
   DDrot(DDName(rotNameCoverToNipple, "pixfwdNipple"), ddrpCN);
   CLHEP::HepRotation rpNC(axis, -angleCover);
-  DDRotationMatrix* ddrpNC = new DDRotationMatrix(rpNC.xx(), rpNC.xy(), rpNC.xz(),
-						  rpNC.yx(), rpNC.yy(), rpNC.yz(),
-						  rpNC.zx(), rpNC.zy(), rpNC.zz() );
+  DDRotationMatrix* ddrpNC = DDTrackerBufferCounter::keep(new DDRotationMatrix(rpNC.xx(), rpNC.xy(), rpNC.xz(),
+									rpNC.yx(), rpNC.yy(), rpNC.yz(),
+									rpNC.zx(), rpNC.zy(), rpNC.zz()));
 
   DDrot(DDName(rotNameNippleToCover, "pixfwdNipple"), ddrpNC);
   
   // Rotation from nipple frame to "body" blade frame :
   
   CLHEP::HepRotation rpNB( rpNC * rCB );
-  DDRotationMatrix* ddrpNB = new DDRotationMatrix(rpNB.xx(), rpNB.xy(), rpNB.xz(),
-						  rpNB.yx(), rpNB.yy(), rpNB.yz(),
-						  rpNB.zx(), rpNB.zy(), rpNB.zz() );
+  DDRotationMatrix* ddrpNB = DDTrackerBufferCounter::keep(new DDRotationMatrix(rpNB.xx(), rpNB.xy(), rpNB.xz(),
+									rpNB.yx(), rpNB.yy(), rpNB.yz(),
+									rpNB.zx(), rpNB.zy(), rpNB.zz()));
 
   DDrot(DDName(rotNameNippleToBody, "pixfwdNipple"), ddrpNB);
   double angleBody = vZ.angle(rpNB * vZ);
@@ -120,8 +120,9 @@ private:
   
   std::map<std::string, int> copyNumbers;
   
-  CLHEP::HepRotation* nippleRotationZPlus;
-  CLHEP::HepRotation* nippleRotationZMinus;
+  bool               nippleComputed;
+  CLHEP::HepRotation nippleRotationZPlus;
+  CLHEP::HepRotation nippleRotationZMinus;
   double nippleTranslationX, nippleTranslationY, nippleTranslationZ;
 
   // -- Helper functions :  --------------------------------------------------------------
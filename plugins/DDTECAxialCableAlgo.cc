@@ -7,13 +7,16 @@
 #include <algorithm>
 
 #include "FWCore/MessageLogger/interface/MessageLogger.h"
-#include "DetectorDescription/Base/interface/DDutils.h"
 #include "DetectorDescription/Core/interface/DDLogicalPart.h"
 #include "DetectorDescription/Core/interface/DDSolid.h"
 #include "DetectorDescription/Core/interface/DDMaterial.h"
 #include "DetectorDescription/Core/interface/DDCurrentNamespace.h"
 #include "DetectorDescription/Core/interface/DDSplit.h"
 #include "Geometry/TrackerCommonData/plugins/DDTECAxialCableAlgo.h"
+#include "Geometry/TrackerCommonData/plugins/DDTrackerBufferCounter.h"
+#include "Geometry/TrackerCommonData/plugins/DDTrackerMixture.h"
+#include "Geometry/TrackerCommonData/plugins/DDTrackerNames.h"
+#include "Geometry/TrackerCommonData/plugins/DDTrackerPlacements.h"
 #include "CLHEP/Units/GlobalPhysicalConstants.h"
 #include "CLHEP/Units/GlobalSystemOfUnits.h"
 
@@ -41,6 +44,9 @@ void DDTECAxialCableAlgo::initialize(const DDNumericArguments & nArgs,
   dZ          = nArgs["DZ"];
   startAngle  = vArgs["StartAngle"];
   zPos        = vArgs["ZPos"];
+  coarse      = false;
+  if (nArgs.find("CoarseServices") != nArgs.end())
+    coarse    = (nArgs["CoarseServices"] > 0.5);
   
   if (fabs(rangeAngle-360.0*CLHEP::deg)<0.001*CLHEP::deg) { 
     delta    =   rangeAngle/double(n);
@@ -60,7 +66,8 @@ void DDTECAxialCableAlgo::initialize(const DDNumericArguments & nArgs,
 		      << rMax << " Cable width " << width/CLHEP::deg 
 		      << " thickness " << thickR << ", " << thickZ << " dZ " 
 		      << dZ << "\n                            Range, Delta " 
-		      << rangeAngle/CLHEP::deg << ", " << delta/CLHEP::deg;
+		      << rangeAngle/CLHEP::deg << ", " << delta/CLHEP::deg
+		      << " Coarse " << coarse;
   for (int i=0; i<(int)(startAngle.size()); i++)
     LogDebug("TECGeom") << "                          Cable " << i 
 			<< " from Z " << zPos[i] << " startAngle " 
@@ -78,47 +85,43 @@ void DDTECAxialCableAlgo::initialize(const DDNumericArguments & nArgs,
 
 void DDTECAxialCableAlgo::execute(DDCompactView& cpv) {
 
+  DDTrackerBufferCounter::Scope buffers("DDTECAxialCableAlgo");
+  if (coarse) {
+    coarseCables(cpv);
+    return;
+  }
   DDName mother = parent().name();
-  double theta  = 90.*CLHEP::deg;
 
+  // Every cable is a polycone in the frame of its z position, translated
+  // there; the vectors of the profile are filled in place
+  std::vector<double> & pconZ    = DDTrackerBufferCounter::doubles();
+  std::vector<double> & pconRmin = DDTrackerBufferCounter::doubles();
+  std::vector<double> & pconRmax = DDTrackerBufferCounter::doubles();
+  pconZ.resize(8);
+  pconRmin.resize(8);
+  pconRmax.assign(8, rMax);
+  DDName mat(DDSplit(matName).first, DDSplit(matName).second); 
+  DDMaterial matter(mat);
   for (int k=0; k<(int)(startAngle.size()); k++) {
 
-    int i;
-    double zv = zPos[k]-dZ-0.5*(zStart+zEnd);
-    std::vector<double> pconZ, pconRmin, pconRmax;
-    pconZ.push_back(zv);
-    pconRmin.push_back(rMin);
-    pconRmax.push_back(rMax);
-    pconZ.push_back(zv+thickZ);
-    pconRmin.push_back(rMin);
-    pconRmax.push_back(rMax);
-    pconZ.push_back(zv+thickZ);
-    pconRmin.push_back(rMax-thickR);
-    pconRmax.push_back(rMax);
-    zv = zPos[k]+dZ-0.5*(zStart+zEnd);
-    pconZ.push_back(zv-thickZ);
-    pconRmin.push_back(rMax-thickR);
-    pconRmax.push_back(rMax);
-    pconZ.push_back(zv-thickZ);
-    pconRmin.push_back(rMin);
-    pconRmax.push_back(rMax);
-    pconZ.push_back(zv);
-    pconRmin.push_back(rMin);
-    pconRmax.push_back(rMax);
-    pconZ.push_back(zv);
-    pconRmin.push_back(rMax-thickR);
-    pconRmax.push_back(rMax);
-    pconZ.push_back(0.5*(zEnd-zStart));
-    pconRmin.push_back(rMax-thickR);
-    pconRmax.push_back(rMax);
-
-    std::string name = childName + dbl_to_string(k);
-    DDSolid solid = DDSolidFactory::polycone(DDName(name, idNameSpace),
+    double zc   = zPos[k]-0.5*(zStart+zEnd);
+    pconZ[0] = -dZ;        pconRmin[0] = rMin;
+    pconZ[1] = -dZ+thickZ; pconRmin[1] = rMin;
+    pconZ[2] = -dZ+thickZ; pconRmin[2] = rMax-thickR;
+    pconZ[3] = dZ-thickZ;  pconRmin[3] = rMax-thickR;
+    pconZ[4] = dZ-thickZ;  pconRmin[4] = rMin;
+    pconZ[5] = dZ;         pconRmin[5] = rMin;
+    pconZ[6] = dZ;         pconRmin[6] = rMax-thickR;
+    pconZ[7] = 0.5*(zEnd-zStart)-zc; pconRmin[7] = rMax-thickR;
+
+    int name = DDTrackerNames::name(childName, "", k);
+    DDName partName = DDTrackerNames::ddname(name, idNameSpace);
+    DDSolid solid = DDSolidFactory::polycone(partName,
 					     -0.5*width, width, pconZ, 
 					     pconRmin, pconRmax);
 
     LogDebug("TECGeom") << "DDTECAxialCableAlgo test: " 
-			<< DDName(name, idNameSpace) <<" Polycone made of "
+			<< partName <<" Polycone made of "
 			<< matName << " from " <<-0.5*width/CLHEP::deg <<" to "
 			<< 0.5*width/CLHEP::deg << " and with " << pconZ.size()
 			<< " sections ";
@@ -126,38 +129,98 @@ void DDTECAxialCableAlgo::execute(DDCompactView& cpv) {
       LogDebug("TECGeom") << "\t" << "\tZ[" << ii << "] = " << pconZ[ii] 
 			  << "\tRmin[" << ii << "] = "<< pconRmin[ii] 
 			  << "\tRmax[" << ii << "] = " << pconRmax[ii];
-    DDName mat(DDSplit(matName).first, DDSplit(matName).second); 
-    DDMaterial matter(mat);
-    DDLogicalPart genlogic(DDName(name, idNameSpace), matter, solid);
-    
+    DDLogicalPart genlogic(partName, matter, solid);
+
     double phi = startAngle[k];
-    for (i=0; i<n; i++) {
-      double phix = phi;
-      double phiy = phix + 90.*CLHEP::deg;
-      double phideg = phix/CLHEP::deg;
-
-      DDRotation rotation;
-      if (phideg != 0) {
-	std::string rotstr = childName + dbl_to_string(phideg*10.);
-	rotation = DDRotation(DDName(rotstr, idNameSpace));
-	if (!rotation) {
-	  LogDebug("TECGeom") << "DDTECAxialCableAlgo test: Creating a new"
-			      << " rotation: " << rotstr << "\t90., " 
-			      << phix/CLHEP::deg << ", 90.," 
-			      << phiy/CLHEP::deg << ", 0, 0";
-	  rotation = DDrot(DDName(rotstr, idNameSpace), theta, phix, theta, 
-			   phiy, 0., 0.);
-	}
-      }
-	
-      DDTranslation tran(0,0,0);
-     cpv.position(DDName(name, idNameSpace), mother, i+1, tran, rotation);
-      LogDebug("TECGeom") << "DDTECAxialCableAlgo test " 
-			  << DDName(name, idNameSpace) << " number " << i+1
-			  << " positioned in " << mother << " at " << tran
-			  << " with "  << rotation;
+    for (int i=0; i<n; i++) {
+      DDRotation rotation = DDTrackerPlacements::phiRotation(phi);
+      DDTranslation tran(0,0,zc);
+     cpv.position(partName, mother, i+1, tran, rotation);
+      LogDebug("TECGeom") << "DDTECAxialCableAlgo test " << partName
+			  << " number " << i+1 << " positioned in " 
+			  << mother << " at " << tran << " with "  << rotation;
 
       phi  += delta;
     }
   }
 }
+
+void DDTECAxialCableAlgo::coarseCables(DDCompactView& cpv) {
+
+  // All the cables in one polycone over the phi range of the copies, of
+  // the union of their profiles (the strip along rMax from the lowest
+  // start, full radial range at the ends of every cable); the material
+  // has the mass of all the copies, the rest is of the mother material
+  DDName mother = parent().name();
+  double zTop   = 0.5*(zEnd-zStart);
+  double rStrip = rMax-thickR;
+  std::vector<double> & zFull = DDTrackerBufferCounter::doubles(); //Pairs of z limits of full radial range
+  double zLow   = zTop;
+  double phiMin = 0, phiMax = 0;
+  double volume = 0;
+  for (int k=0; k<(int)(startAngle.size()); k++) {
+    double za = zPos[k]-dZ-0.5*(zStart+zEnd);
+    double zb = zPos[k]+dZ-0.5*(zStart+zEnd);
+    zFull.push_back(za);    zFull.push_back(za+thickZ);
+    zFull.push_back(zb-thickZ); zFull.push_back(zb);
+    zLow = std::min(zLow, za);
+    volume += n*0.5*width*(2*thickZ*(rMax*rMax-rMin*rMin) +
+			   (zTop-za-2*thickZ)*(rMax*rMax-rStrip*rStrip));
+    double phi1 = startAngle[k]-0.5*width;
+    double phi2 = startAngle[k]+(n-1)*delta+0.5*width;
+    if (k == 0 || phi1 < phiMin) phiMin = phi1;
+    if (k == 0 || phi2 > phiMax) phiMax = phi2;
+  }
+  if (phiMax-phiMin > CLHEP::twopi) phiMax = phiMin+CLHEP::twopi;
+
+  std::vector<double> & zs = DDTrackerBufferCounter::doubles();
+  zs.assign(zFull.begin(), zFull.end());
+  zs.push_back(zLow);
+  zs.push_back(zTop);
+  std::sort(zs.begin(), zs.end());
+  zs.erase(std::unique(zs.begin(), zs.end()), zs.end());
+  std::vector<double> & pconZ    = DDTrackerBufferCounter::doubles();
+  std::vector<double> & pconRmin = DDTrackerBufferCounter::doubles();
+  std::vector<double> & pconRmax = DDTrackerBufferCounter::doubles();
+  double envelope = 0;
+  for (int i=0; i+1<(int)(zs.size()); i++) {
+    if (zs[i] < zLow || zs[i+1] > zTop) continue;
+    double zm   = 0.5*(zs[i]+zs[i+1]);
+    double rmin = rStrip;
+    for (int j=0; j+1<(int)(zFull.size()); j+=2)
+      if (zm > zFull[j] && zm < zFull[j+1]) rmin = rMin;
+    if (pconRmin.size() > 0 && pconRmin.back() == rmin) {
+      pconZ.back() = zs[i+1];
+    } else {
+      pconZ.push_back(zs[i]);   pconRmin.push_back(rmin); pconRmax.push_back(rMax);
+      pconZ.push_back(zs[i+1]); pconRmin.push_back(rmin); pconRmax.push_back(rMax);
+    }
+    envelope += 0.5*(phiMax-phiMin)*(zs[i+1]-zs[i])*(rMax*rMax-rmin*rmin);
+  }
+
+  DDTrackerMixture mixture(parent().material().name().fullname());
+  mixture.add(matName, volume);
+  DDName partName(childName, idNameSpace);
+  int mixName = DDTrackerNames::name(childName, "Mixture");
+  DDSolid solid = DDSolidFactory::polycone(partName,
+					   phiMin, phiMax-phiMin, pconZ,
+					   pconRmin, pconRmax);
+  DDMaterial matter = mixture.make(DDTrackerNames::ddname(mixName, idNameSpace),
+				   envelope);
+  LogDebug("TECGeom") << "DDTECAxialCableAlgo test: " 
+		      << partName <<" Polycone made of "
+		      << matter.name() << " from " << phiMin/CLHEP::deg 
+		      << " to " << phiMax/CLHEP::deg << " and with " 
+		      << pconZ.size() << " sections for " << n << " x "
+		      << startAngle.size() << " cables";
+  for (int ii = 0; ii <(int)(pconZ.size()); ii++) 
+    LogDebug("TECGeom") << "\t" << "\tZ[" << ii << "] = " << pconZ[ii] 
+			<< "\tRmin[" << ii << "] = "<< pconRmin[ii] 
+			<< "\tRmax[" << ii << "] = " << pconRmax[ii];
+  DDLogicalPart genlogic(partName, matter, solid);
+
+  cpv.position(partName, mother, 1, DDTranslation(0,0,0), DDRotation());
+  LogDebug("TECGeom") << "DDTECAxialCableAlgo test " 
+		      << partName << " number 1 positioned in "
+		      << mother << " with no translation and no rotation";
+}
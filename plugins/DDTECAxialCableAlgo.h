@@ -24,6 +24,8 @@ public:
 
 private:
 
+  void coarseCables(DDCompactView& cpv);
+
   int                 n;          //Number of copies
   double              rangeAngle; //Range in angle
   double              zStart;     //Start z        of the Service volume
@@ -37,6 +39,7 @@ private:
   std::vector<double> startAngle; //Start angle
   std::vector<double> zPos;       //Starting Z of the cables
   double              delta;      //Increment in phi
+  bool                coarse;     //Cables as one uniform polycone
 
   std::string   idNameSpace;      //Namespace of this and ALL sub-parts
   std::string   childName;        //Child name
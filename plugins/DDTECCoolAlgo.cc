@@ -4,6 +4,10 @@
 // * in each call all objects are placed at the same radial position.
 // * Inserts are placed into the parent object
 // * for all i: CoolInsert[i] goes to PhiPosition[i]
+// * with the string vector Parents, several calls are made at once: the
+//   vectors StartCopyNo, RPosition and Rows (number of Inserts) give one
+//   entry per parent, PhiPosition and CoolInsert are those of all the
+//   rows one after the other
 ///////////////////////////////////////////////////////////////////////////////
 
 #include <cmath>
@@ -31,48 +35,89 @@ void DDTECCoolAlgo::initialize(const DDNumericArguments & nArgs,
 			       const DDStringVectorArguments & vsArgs) {
 
   idNameSpace    = DDCurrentNamespace::ns();
-  startCopyNo    = int(nArgs["StartCopyNo"]);
-
-  DDName parentName = parent().name(); 
-  rPosition       = nArgs["RPosition"];
-  LogDebug("TECGeom") << "DDTECCoolAlgo debug: Parent " << parentName 
-		      <<" NameSpace " << idNameSpace << " at radial Position " 
-		      << rPosition ;
   phiPosition    = vArgs["PhiPosition"]; 
   coolInsert     = vsArgs["CoolInsert"];
-  if (phiPosition.size() == coolInsert.size()) {
-    for (int i=0; i<(int)(phiPosition.size()); i++) 
-      LogDebug("TECGeom") << "DDTECCoolAlgo debug: Insert[" << i << "]: "
-			  << coolInsert.at(i) << " at Phi " 
-			  << phiPosition.at(i)/CLHEP::deg;
+
+  DDName parentName = parent().name(); 
+  parents.clear();
+  startCopyNo.clear();
+  rPosition.clear();
+  rows.clear();
+  if (vsArgs.find("Parents") != vsArgs.end()) {
+    // batch: a table with one row per parent and radial position
+    parents      = vsArgs["Parents"];
+    std::vector<double> copies = vArgs["StartCopyNo"];
+    std::vector<double> inserts = vArgs["Rows"];
+    rPosition    = vArgs["RPosition"];
+    for (int i=0; i<(int)(copies.size()); i++)
+      startCopyNo.push_back(int(copies[i]));
+    for (int i=0; i<(int)(inserts.size()); i++)
+      rows.push_back(int(inserts[i]));
   } else {
-    LogDebug("TECGeom") << "ERROR: Number of inserts does not match the numer of PhiPositions!";
+    parents.push_back(parentName.fullname());
+    startCopyNo.push_back(int(nArgs["StartCopyNo"]));
+    rPosition.push_back(nArgs["RPosition"]);
+    rows.push_back((int)(coolInsert.size()));
+  }
+  LogDebug("TECGeom") << "DDTECCoolAlgo debug: Parent " << parentName 
+		      <<" NameSpace " << idNameSpace << " with " 
+		      << parents.size() << " rows";
+
+  int total = 0;
+  for (int i=0; i<(int)(rows.size()); i++) total += rows[i];
+  if (startCopyNo.size() != parents.size() || 
+      rPosition.size() != parents.size() || rows.size() != parents.size() ||
+      phiPosition.size() != coolInsert.size() || 
+      total != (int)(coolInsert.size())) {
+    edm::LogError("TECGeom") << "DDTECCoolAlgo error: " << parents.size()
+			     << " parents, " << startCopyNo.size() 
+			     << " start copy numbers, " << rPosition.size()
+			     << " radial positions, " << rows.size() 
+			     << " rows of " << total << " Inserts for "
+			     << coolInsert.size() << " Inserts and " 
+			     << phiPosition.size() << " PhiPositions: "
+			     << "nothing placed in " << parentName;
+    rows.clear();
+  }
+  int k = 0;
+  for (int j=0; j<(int)(rows.size()); j++) {
+    LogDebug("TECGeom") << "DDTECCoolAlgo debug: Row " << j << " in "
+			<< parents[j] << " at radial Position " 
+			<< rPosition[j] << " from copy " << startCopyNo[j];
+    for (int i=0; i<rows[j]; i++, k++)
+      LogDebug("TECGeom") << "DDTECCoolAlgo debug: Insert[" << k << "]: "
+			  << coolInsert.at(k) << " at Phi " 
+			  << phiPosition.at(k)/CLHEP::deg;
   }
   LogDebug("TECGeom") << " Done creating instance of DDTECCoolAlgo ";
 }
 
 void DDTECCoolAlgo::execute(DDCompactView& cpv) {
   LogDebug("TECGeom") << "==>> Constructing DDTECCoolAlgo...";
-  int copyNo  = startCopyNo;
-  // loop over the inserts to be placed
-  for (int i = 0; i < (int)(coolInsert.size()); i++) {
-    // get objects
-    DDName child  = DDName(DDSplit(coolInsert.at(i)).first, 
-			   DDSplit(coolInsert.at(i)).second);
-    DDName mother = parent().name();
-    // get positions
-    double xpos = rPosition*cos(phiPosition.at(i));
-    double ypos = -rPosition*sin(phiPosition.at(i));
-    // place inserts
-    DDTranslation tran(xpos, ypos, 0.0);
-    DDRotation rotation;
-   cpv.position(child, mother, copyNo, tran, rotation);
-    LogDebug("TECGeom") << "DDTECCoolAlgo test " << child << "["  
-			<< copyNo << "] positioned in " << mother 
-			<< " at " << tran  << " with " << rotation 
-			<< " phi " << phiPosition.at(i)/CLHEP::deg << " r " 
-			<< rPosition;
-    copyNo++;
+  int i = 0;
+  // loop over the rows and the inserts to be placed
+  for (int j = 0; j < (int)(rows.size()); j++) {
+    DDName mother = DDName(DDSplit(parents[j]).first, 
+			   DDSplit(parents[j]).second);
+    int copyNo  = startCopyNo[j];
+    for (int last = i + rows[j]; i < last; i++) {
+      // get objects
+      DDName child  = DDName(DDSplit(coolInsert.at(i)).first, 
+			     DDSplit(coolInsert.at(i)).second);
+      // get positions
+      double xpos = rPosition[j]*cos(phiPosition.at(i));
+      double ypos = -rPosition[j]*sin(phiPosition.at(i));
+      // place inserts
+      DDTranslation tran(xpos, ypos, 0.0);
+      DDRotation rotation;
+      cpv.position(child, mother, copyNo, tran, rotation);
+      LogDebug("TECGeom") << "DDTECCoolAlgo test " << child << "["  
+			  << copyNo << "] positioned in " << mother 
+			  << " at " << tran  << " with " << rotation 
+			  << " phi " << phiPosition.at(i)/CLHEP::deg << " r " 
+			  << rPosition[j];
+      copyNo++;
+    }
   }
   LogDebug("TECGeom") << "<<== End of DDTECCoolAlgo construction ...";
 }
@@ -23,8 +23,12 @@ class DDTECCoolAlgo : public DDAlgorithm {
 
 private:
   std::string              idNameSpace;    //Namespace of this and ALL parts
-  int                      startCopyNo;    //Start copy number
-  double                   rPosition;      // Position of the Inserts in R
+  //One entry per row (a single row without the argument Parents)
+  std::vector<std::string> parents;        // Parent of the Inserts
+  std::vector<int>         startCopyNo;    //Start copy number
+  std::vector<double>      rPosition;      // Position of the Inserts in R
+  std::vector<int>         rows;           // Number of Inserts
+  //All the rows one after the other
   std::vector<double>      phiPosition;    // Position of the Inserts in Phi
   std::vector<std::string> coolInsert;       //Name of cooling pieces
 };
@@ -14,6 +14,9 @@
 #include "DetectorDescription/Core/interface/DDCurrentNamespace.h"
 #include "DetectorDescription/Core/interface/DDSplit.h"
 #include "Geometry/TrackerCommonData/plugins/DDTECModuleAlgo.h"
+#include "Geometry/TrackerCommonData/plugins/DDTrackerMixture.h"
+#include "Geometry/TrackerCommonData/plugins/DDTrackerNames.h"
+#include "Geometry/TrackerCommonData/plugins/DDTrackerSensorTable.h"
 #include "CLHEP/Units/GlobalPhysicalConstants.h"
 #include "CLHEP/Units/GlobalSystemOfUnits.h"
 
@@ -32,12 +35,17 @@ void DDTECModuleAlgo::initialize(const DDNumericArguments & nArgs,
 
   idNameSpace  = DDCurrentNamespace::ns();
   genMat       = sArgs["GeneralMaterial"];
+  homogeneous  = false;
+  if (sArgs.find("HomogeneousModule") != sArgs.end()) {
+    std::string comp = sArgs["HomogeneousModule"];
+    homogeneous = (comp == "Yes" || comp == "YES" || comp == "yes");
+  }
 
   DDName parentName = parent().name(); 
 
   LogDebug("TECGeom") << "DDTECModuleAlgo debug: Parent " << parentName 
 		      << " NameSpace " << idNameSpace << " General Material "
-		      << genMat;
+		      << genMat << " Homogeneous " << homogeneous;
   ringNo = (int)nArgs["RingNo"];
   moduleThick    = nArgs["ModuleThick"];
   detTilt        = nArgs["DetTilt"];
@@ -272,20 +280,21 @@ void DDTECModuleAlgo::execute(DDCompactView& cpv) {
   double thet;
   //names
   std::string idName;
-  std::string name;
-  std::string tag("Rphi");
-  if (isStereo) tag = "Stereo";
-  char buf[5]; //for string operations
+  int         name;  //Interned, see DDTrackerNames
+  int         tag;   //idName and Rphi or Stereo
   //usefull constants
   const double topFrameEndZ = 0.5 * (-waferPosition + fullHeight) + pitchHeight + hybridHeight - topFrameHeight;
   DDName  parentName = parent().name(); 
   idName = parentName.name();
+  tag    = DDTrackerNames::name(idName, isStereo ? "Stereo" : "Rphi");
   LogDebug("TECGeom") << "==>> " << idName << " parent " << parentName << " namespace " << idNameSpace;
   DDSolid solid;
 
   //set global parameters
   DDName matname(DDSplit(genMat).first, DDSplit(genMat).second);
   DDMaterial matter(matname);
+  //passive parts replaced by one layer in the homogeneous mode
+  DDTrackerMixture passive(genMat);
   dzdif = fullHeight + topFrameHeight;
   if(isStereo) dzdif += 0.5*(topFrame2LHeight+topFrame2RHeight);
   
@@ -301,7 +310,7 @@ void DDTECModuleAlgo::execute(DDCompactView& cpv) {
 
   //Frame Sides
   // left Frame
-  name    = idName + "SideFrameLeft";
+  name    = DDTrackerNames::name(idName, "SideFrameLeft");
   matname =  DDName(DDSplit(sideFrameMat).first, DDSplit(sideFrameMat).second);
   matter  = DDMaterial(matname);
 
@@ -311,7 +320,7 @@ void DDTECModuleAlgo::execute(DDCompactView& cpv) {
   thet = sideFrameLtheta;
   //for stereo modules
   if(isStereo)  bl1 = 0.5 * sideFrameLWidthLow;
-  solid = DDSolidFactory::trap(DDName(name,idNameSpace), dz, thet, 0, h1, bl1, 
+  solid = DDSolidFactory::trap(DDTrackerNames::ddname(name, idNameSpace), dz, thet, 0, h1, bl1, 
 			       bl1, 0, h1, bl2, bl2, 0);
   LogDebug("TECGeom") << "DDTECModuleAlgo test:\t" << solid.name() 
 		      << " Trap made of " << matname << " of dimensions "
@@ -335,10 +344,11 @@ void DDTECModuleAlgo::execute(DDCompactView& cpv) {
     zpos = topFrameEndZ -topFrame2LHeight- 0.5*sin(detTilt)*(topFrameBotWidth - topFrame2Width)-dz*cos(detTilt+fabs(thet))/cos(fabs(thet))+bl2*sin(detTilt)-0.1*CLHEP::mm;
   }
   //position
-  doPos(sideFrameLeft,xpos,ypos,zpos,waferRot, cpv);
+  if (homogeneous) passive.add(sideFrameLeft);
+  else             doPos(sideFrameLeft,xpos,ypos,zpos,waferRot, cpv);
 
   //right Frame
-  name    = idName + "SideFrameRight";
+  name    = DDTrackerNames::name(idName, "SideFrameRight");
   matname = DDName(DDSplit(sideFrameMat).first, DDSplit(sideFrameMat).second);
   matter  = DDMaterial(matname);
 
@@ -347,7 +357,7 @@ void DDTECModuleAlgo::execute(DDCompactView& cpv) {
   bl1 = bl2 = 0.5 * sideFrameRWidth;
   thet = sideFrameRtheta;
   if(isStereo) bl1 = 0.5 * sideFrameRWidthLow;
-  solid = DDSolidFactory::trap(DDName(name,idNameSpace), dz, thet, 0, h1, bl1, 
+  solid = DDSolidFactory::trap(DDTrackerNames::ddname(name, idNameSpace), dz, thet, 0, h1, bl1, 
 			       bl1, 0, h1, bl2, bl2, 0);
   LogDebug("TECGeom") << "DDTECModuleAlgo test:\t" << solid.name() 
 		      << " Trap made of " << matname << " of dimensions "
@@ -369,13 +379,13 @@ void DDTECModuleAlgo::execute(DDCompactView& cpv) {
     zpos = topFrameEndZ -topFrame2RHeight+ 0.5*sin(detTilt)*(topFrameBotWidth - topFrame2Width)-dz*cos(detTilt-fabs(thet))/cos(fabs(thet))-bl2*sin(detTilt)-0.1*CLHEP::mm;
   }
   //position it
-  doPos(sideFrameRight,xpos,ypos,zpos,waferRot, cpv);
+  if (homogeneous) passive.add(sideFrameRight);
+  else             doPos(sideFrameRight,xpos,ypos,zpos,waferRot, cpv);
 
 
   //Supplies Box(es)
   for (int i= 0; i < (int)(siFrSuppBoxWidth.size());i++){
-    sprintf(buf,"%i",i);
-    name    = idName + "SuppliesBox"+buf;
+    name    = DDTrackerNames::name(idName, "SuppliesBox", i);
     matname = DDName(DDSplit(siFrSuppBoxMat).first, DDSplit(siFrSuppBoxMat).second);
     matter  = DDMaterial(matname);
     
@@ -386,7 +396,7 @@ void DDTECModuleAlgo::execute(DDCompactView& cpv) {
     if(isStereo) thet = -atan(fabs(sideFrameRWidthLow-sideFrameRWidth)/(2*sideFrameRHeight)-tan(fabs(thet)));
                    // ^-- this calculates the lower left angel of the tipped trapezoid, which is the SideFframe...
     
-    solid = DDSolidFactory::trap(DDName(name,idNameSpace), dz, thet,0, h1, bl1,
+    solid = DDSolidFactory::trap(DDTrackerNames::ddname(name, idNameSpace), dz, thet,0, h1, bl1,
 				 bl1, 0, h1, bl2, bl2, 0);
     LogDebug("TECGeom") << "DDTECModuleAlgo test:\t" << solid.name() 
 			<< " Trap made of " << matname << " of dimensions "
@@ -408,16 +418,17 @@ void DDTECModuleAlgo::execute(DDCompactView& cpv) {
       zpos = topFrameEndZ - topFrame2RHeight - 0.5*sin(detTilt)*(topFrameBotWidth - topFrame2Width) - siFrSuppBoxYPos[i]-sin(detTilt)*sideFrameRWidth;
     }
     //position it;
-    doPos(siFrSuppBox,xpos,ypos,zpos,waferRot,cpv);
+    if (homogeneous) passive.add(siFrSuppBox);
+    else             doPos(siFrSuppBox,xpos,ypos,zpos,waferRot,cpv);
   }
   //The Hybrid
-  name    = idName + "Hybrid";
+  name    = DDTrackerNames::name(idName, "Hybrid");
   matname = DDName(DDSplit(hybridMat).first, DDSplit(hybridMat).second);
   matter  = DDMaterial(matname);
   dx = 0.5 * hybridWidth;
   dy = 0.5 * hybridThick;
   dz        = 0.5 * hybridHeight;
-  solid = DDSolidFactory::box(DDName(name, idNameSpace), dx, dy, dz);
+  solid = DDSolidFactory::box(DDTrackerNames::ddname(name, idNameSpace), dx, dy, dz);
   LogDebug("TECGeom") << "DDTECModuleAlgo test:\t" << solid.name() 
 					  << " Box made of " << matname << " of dimensions "
 					  << dx << ", " << dy << ", " << dz;
@@ -427,17 +438,18 @@ void DDTECModuleAlgo::execute(DDCompactView& cpv) {
   zpos = 0.5 * (-waferPosition + fullHeight + hybridHeight)+pitchHeight;
   if (isRing6)	zpos *=-1;
   //position it
-  doPos(hybrid,0,ypos,zpos,"NULL", cpv);  
+  if (homogeneous) passive.add(hybrid);
+  else             doPos(hybrid,0,ypos,zpos,"NULL", cpv);  
 
   // Wafer
-  name    = idName + tag +"Wafer";
+  name    = DDTrackerNames::name(tag, "Wafer");
   matname = DDName(DDSplit(waferMat).first, DDSplit(waferMat).second);
   matter  = DDMaterial(matname);
   bl1     = 0.5 * dlBottom;
   bl2     = 0.5 * dlTop;
   h1      = 0.5 * waferThick;
   dz      = 0.5 * fullHeight;
-  solid = DDSolidFactory::trap(DDName(name,idNameSpace), dz, 0, 0, h1, bl1, 
+  solid = DDSolidFactory::trap(DDTrackerNames::ddname(name, idNameSpace), dz, 0, 0, h1, bl1, 
 							   bl1, 0, h1, bl2, bl2, 0);
   LogDebug("TECGeom") << "DDTECModuleAlgo test:\t" << solid.name()
 			<< " Trap made of " << matname << " of dimensions "
@@ -453,7 +465,7 @@ void DDTECModuleAlgo::execute(DDCompactView& cpv) {
   doPos(wafer,0,ypos,zpos,waferRot,cpv);
   
   // Active
-  name    = idName + tag +"Active";
+  name    = DDTrackerNames::name(tag, "Active");
   matname = DDName(DDSplit(activeMat).first, DDSplit(activeMat).second);
   matter  = DDMaterial(matname);
   bl1    -= sideWidthBottom;
@@ -463,7 +475,7 @@ void DDTECModuleAlgo::execute(DDCompactView& cpv) {
   if (isRing6) { //switch bl1 <->bl2
     tmp = bl2;	bl2 =bl1;	bl1 = tmp;
   }
-  solid = DDSolidFactory::trap(DDName(name,idNameSpace), dz, 0, 0, h1, bl2, 
+  solid = DDSolidFactory::trap(DDTrackerNames::ddname(name, idNameSpace), dz, 0, 0, h1, bl2, 
 			       bl1, 0, h1, bl2, bl1, 0);
   LogDebug("TECGeom") << "DDTECModuleAlgo test:\t" << solid.name() 
 		      << " Trap made of " << matname << " of dimensions "
@@ -471,11 +483,12 @@ void DDTECModuleAlgo::execute(DDCompactView& cpv) {
 		      << bl1 << ", 0, " << h1 << ", " << bl2 << ", "
 		      << bl1 << ", 0";
   DDLogicalPart active(solid.ddname(), matter, solid);
+  DDTrackerSensorTable::instance().defineSensor(active);
   doPos(active, wafer, 1, -0.5 * backplaneThick,0,0, activeRot, cpv); // from the definition of the wafer local axes and doPos() routine
   //inactive part in rings > 3
   if(ringNo > 3){
     inactivePos -= fullHeight-activeHeight; //inactivePos is measured from the beginning of the _wafer_
-    name    = idName + tag +"Inactive";
+    name    = DDTrackerNames::name(tag, "Inactive");
     matname = DDName(DDSplit(inactiveMat).first, DDSplit(inactiveMat).second);
     matter  = DDMaterial(matname);
     bl1     = 0.5*dlBottom-sideWidthBottom
@@ -489,7 +502,7 @@ void DDTECModuleAlgo::execute(DDCompactView& cpv) {
     if (isRing6) { //switch bl1 <->bl2
       tmp = bl2;	bl2 =bl1;	bl1 = tmp;
     }
-    solid = DDSolidFactory::trap(DDName(name,idNameSpace), dz, 0, 0, h1, bl2, 
+    solid = DDSolidFactory::trap(DDTrackerNames::ddname(name, idNameSpace), dz, 0, 0, h1, bl2, 
 				 bl1, 0, h1, bl2, bl1, 0);
     LogDebug("TECGeom") << "DDTECModuleAlgo test:\t" << solid.name() 
 			<< " Trap made of " << matname << " of dimensions "
@@ -501,7 +514,7 @@ void DDTECModuleAlgo::execute(DDCompactView& cpv) {
     doPos(inactive,active, 1, ypos,0,0, "NULL", cpv); // from the definition of the wafer local axes and doPos() routine
   }
   //Pitch Adapter
-  name    = idName + "PA";
+  name    = DDTrackerNames::name(idName, "PA");
   matname = DDName(DDSplit(pitchMat).first, DDSplit(pitchMat).second);
   matter  = DDMaterial(matname);
   
@@ -509,7 +522,7 @@ void DDTECModuleAlgo::execute(DDCompactView& cpv) {
     dx      = 0.5 * pitchWidth;
     dy      = 0.5 * pitchThick;
     dz      = 0.5 * pitchHeight;
-    solid   = DDSolidFactory::box(DDName(name, idNameSpace), dx, dy, dz);
+    solid   = DDSolidFactory::box(DDTrackerNames::ddname(name, idNameSpace), dx, dy, dz);
     LogDebug("TECGeom") << "DDTECModuleAlgo test:\t" << solid.name() 
 			<< " Box made of " << matname <<" of dimensions "
 			<< dx << ", " << dy << ", " << dz;
@@ -519,7 +532,7 @@ void DDTECModuleAlgo::execute(DDCompactView& cpv) {
     bl1     = 0.5 * pitchHeight + 0.5 * dz * sin(detTilt);
     bl2     = 0.5 * pitchHeight - 0.5 * dz * sin(detTilt);
     double thet = atan((bl1-bl2)/(2.*dz));
-    solid   = DDSolidFactory::trap(DDName(name,idNameSpace), dz, thet, 0, h1,
+    solid   = DDSolidFactory::trap(DDTrackerNames::ddname(name, idNameSpace), dz, thet, 0, h1,
 				   bl1, bl1, 0, h1, bl2, bl2, 0);
     LogDebug("TECGeom") << "DDTECModuleAlgo test:\t" << solid.name()
 			<< " Trap made of " << matname 
@@ -535,10 +548,15 @@ void DDTECModuleAlgo::execute(DDCompactView& cpv) {
   if(isStereo)    xpos    = 0.5 * fullHeight * sin(detTilt);
   
   DDLogicalPart pa(solid.ddname(), matter, solid);
-  if(isStereo)doPos(pa, xpos, ypos,zpos, pitchRot, cpv);
-  else        doPos(pa, xpos, ypos,zpos, "NULL", cpv);
+  if (homogeneous) {
+    passive.add(pa);
+  } else if (isStereo) {
+    doPos(pa, xpos, ypos, zpos, pitchRot, cpv);
+  } else {
+    doPos(pa, xpos, ypos, zpos, "NULL", cpv);
+  }
   //Top of the frame
-  name = idName + "TopFrame";
+  name = DDTrackerNames::name(idName, "TopFrame");
   matname = DDName(DDSplit(topFrameMat).first, DDSplit(topFrameMat).second);
   matter  = DDMaterial(matname);
   
@@ -551,7 +569,7 @@ void DDTECModuleAlgo::execute(DDCompactView& cpv) {
     bl2 = 0.5 * topFrameBotWidth;
   }
   
-  solid = DDSolidFactory::trap(DDName(name,idNameSpace), dz, 0, 0, h1, bl1, 
+  solid = DDSolidFactory::trap(DDTrackerNames::ddname(name, idNameSpace), dz, 0, 0, h1, bl1, 
 			       bl1,0, h1, bl2, bl2, 0);
   LogDebug("TECGeom") << "DDTECModuleAlgo test:\t" << solid.name() 
 		      << " Trap made of " << matname << " of dimensions " 
@@ -561,7 +579,7 @@ void DDTECModuleAlgo::execute(DDCompactView& cpv) {
   DDLogicalPart topFrame(solid.ddname(), matter, solid);
   
   if(isStereo){ 
-    name = idName + "TopFrame2";
+    name = DDTrackerNames::name(idName, "TopFrame2");
     //additional object to build the not trapzoid geometry of the stereo topframes
     dz      = 0.5 * topFrame2Width;    
     h1      = 0.5 * topFrameThick;
@@ -569,7 +587,7 @@ void DDTECModuleAlgo::execute(DDCompactView& cpv) {
     bl2     = 0.5 * topFrame2RHeight;
     double thet = atan((bl1-bl2)/(2.*dz));
 	
-    solid   = DDSolidFactory::trap(DDName(name,idNameSpace), dz, thet, 0, h1,
+    solid   = DDSolidFactory::trap(DDTrackerNames::ddname(name, idNameSpace), dz, thet, 0, h1,
 				   bl1, bl1, 0, h1, bl2, bl2, 0);
     LogDebug("TECGeom") << "DDTECModuleAlgo test:\t" << solid.name()
 			<< " Trap made of " << matname << " of dimensions "
@@ -585,19 +603,19 @@ void DDTECModuleAlgo::execute(DDCompactView& cpv) {
     zpos *=-1;
   }
 
-  doPos(topFrame, 0,ypos,zpos,"NULL", cpv);
+  if (homogeneous) passive.add(topFrame);
+  else             doPos(topFrame, 0,ypos,zpos,"NULL", cpv);
   if(isStereo){
     //create
     DDLogicalPart topFrame2(solid.ddname(), matter, solid);
     zpos -= 0.5*(topFrameHeight + 0.5*(topFrame2LHeight+topFrame2RHeight));
-    doPos(topFrame2, 0,ypos,zpos,pitchRot, cpv);
+    if (homogeneous) passive.add(topFrame2);
+    else             doPos(topFrame2, 0,ypos,zpos,pitchRot, cpv);
   }
   
   //Si - Reencorcement
   for (int i= 0; i < (int)(siReenforceWidth.size());i++){
-    char buf[5];
-    sprintf(buf,"%i",i);
-    name    = idName + "SiReenforce"+buf;
+    name    = DDTrackerNames::name(idName, "SiReenforce", i);
     matname = DDName(DDSplit(siReenforceMat).first, DDSplit(siReenforceMat).second);
     matter  = DDMaterial(matname);
     
@@ -605,7 +623,7 @@ void DDTECModuleAlgo::execute(DDCompactView& cpv) {
     dz = 0.5 * siReenforceHeight[i];
     bl1 = bl2 = 0.5 * siReenforceWidth[i];
     
-    solid = DDSolidFactory::trap(DDName(name,idNameSpace), dz, 0, 0, h1, bl1, 
+    solid = DDSolidFactory::trap(DDTrackerNames::ddname(name, idNameSpace), dz, 0, 0, h1, bl1, 
 				 bl1, 0, h1, bl2, bl2, 0);
     LogDebug("TECGeom") << "DDTECModuleAlgo test:\t" << solid.name() 
 			<< " Trap made of " << matname << " of dimensions "
@@ -626,19 +644,20 @@ void DDTECModuleAlgo::execute(DDCompactView& cpv) {
       //    zpos -= topFrame2RHeight + sin(thet)*(sideFrameRWidth + 0.5*dlTop);
       zpos -= topFrame2RHeight + sin (fabs(detTilt))* 0.5*topFrame2Width;
     }
-    doPos(siReenforce,xpos,ypos,zpos,waferRot, cpv);
+    if (homogeneous) passive.add(siReenforce);
+    else             doPos(siReenforce,xpos,ypos,zpos,waferRot, cpv);
   }
 
   //Bridge 
   if (bridgeMat != "None") {
-    name    = idName + "Bridge";
+    name    = DDTrackerNames::name(idName, "Bridge");
     matname = DDName(DDSplit(bridgeMat).first, DDSplit(bridgeMat).second);
     matter  = DDMaterial(matname);
     bl2     = 0.5*bridgeSep + bridgeWidth;
     bl1     = bl2 - bridgeHeight * dxdif / dzdif;
     h1      = 0.5 * bridgeThick;
     dz      = 0.5 * bridgeHeight;
-    solid = DDSolidFactory::trap(DDName(name,idNameSpace), dz, 0, 0, h1, bl1, 
+    solid = DDSolidFactory::trap(DDTrackerNames::ddname(name, idNameSpace), dz, 0, 0, h1, bl1, 
 				 bl1, 0, h1, bl2, bl2, 0);
     LogDebug("TECGeom") << "DDTECModuleAlgo test:\t" << solid.name()
 			<< " Trap made of " << matname << " of dimensions "
@@ -647,11 +666,11 @@ void DDTECModuleAlgo::execute(DDCompactView& cpv) {
 			<< ", 0";
     DDLogicalPart bridge(solid.ddname(), matter, solid);
 
-    name    = idName + "BridgeGap";
+    name    = DDTrackerNames::name(idName, "BridgeGap");
     matname = DDName(DDSplit(genMat).first, DDSplit(genMat).second);
     matter  = DDMaterial(matname);
     bl1     = 0.5*bridgeSep;
-    solid = DDSolidFactory::box(DDName(name,idNameSpace), bl1, h1, dz);
+    solid = DDSolidFactory::box(DDTrackerNames::ddname(name, idNameSpace), bl1, h1, dz);
     LogDebug("TECGeom") << "DDTECModuleAlgo test:\t" << solid.name() 
 			<< " Box made of " << matname << " of dimensions "
 			<< bl1 << ", " << h1 << ", " << dz;
@@ -662,5 +681,37 @@ void DDTECModuleAlgo::execute(DDCompactView& cpv) {
 			<< " at (0,0,0) with no rotation";
   }
 
+  //Homogeneous passive layer: in the slab of the side frames (which
+  //the wafer does not cross), from the wafer end to the end of the top
+  //frame, with the frame outline; the bridge is not positioned in the
+  //detailed module either and is left out
+  if (homogeneous) {
+    name    = DDTrackerNames::name(idName, "Passive");
+    double zlow  = -0.5 * (waferPosition + fullHeight);
+    double zhigh = topFrameEndZ + topFrameHeight;
+    h1      = 0.5 * sideFrameThick;
+    dz      = 0.5 * (zhigh - zlow);
+    bl1     = (isRing6 ? dxtop : dxbot);
+    bl2     = 0.5 * topFrameTopWidth;
+    if (isRing6) {    // ring 6 faces the other way!
+      tmp = bl2;	bl2 =bl1;	bl1 = tmp;
+    }
+    solid = DDSolidFactory::trap(DDTrackerNames::ddname(name, idNameSpace), dz, 0, 0, h1, bl1, 
+				 bl1, 0, h1, bl2, bl2, 0);
+    matter = passive.make(DDTrackerNames::ddname(DDTrackerNames::name(name, "Mixture"), idNameSpace), 
+			  solid.volume());
+    LogDebug("TECGeom") << "DDTECModuleAlgo test:\t" << solid.name() 
+			<< " Trap made of " << matter.name() << " of dimensions "
+			<< dz << ", 0, 0, " << h1 << ", " << bl1 << ", "
+			<< bl1 << ", 0, " << h1 << ", " << bl2 << ", " << bl2
+			<< ", 0 for " << passive.mass()/CLHEP::g << " g of "
+			<< "passive material";
+    DDLogicalPart passiveLayer(solid.ddname(), matter, solid);
+    ypos = sideFrameZ;
+    zpos = 0.5 * (zlow + zhigh);
+    if (isRing6) zpos *= -1;
+    doPos(passiveLayer, 0,ypos,zpos,"NULL", cpv);
+  }
+
   LogDebug("TECGeom") << "<<== End of DDTECModuleAlgo construction ...";
 }
@@ -40,6 +40,7 @@ private:
   std::string              standardRot;    //Rotation that aligns the mother(Tub ) coordinate System with the components
   std::string              idNameSpace;    //Namespace of this and ALL parts
   std::string              genMat;         //General material name
+  bool                     homogeneous;    //Passive parts as one layer
   double                   moduleThick;    //Module thickness
   double                   detTilt;        //Tilt of stereo detector
   double                   fullHeight;     //Height 
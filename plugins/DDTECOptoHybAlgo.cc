@@ -1,16 +1,24 @@
 ///////////////////////////////////////////////////////////////////////////////
 // File: DDTECOptoHybAlgo.cc
 // Description: Placing cooling pieces in the petal material of a TEC petal
+// * with the string vector Parents, several calls are made at once: the
+//   vectors StartCopyNo, Rpos, Zpos, OptoHeight, OptoWidth, Rows (number
+//   of Hybrids) and the string vector ChildName give one entry per row,
+//   Angles are those of all the rows one after the other
+// * the rotations are those of DDTrackerPlacements::phiRotation, named
+//   tracker:Phi<phi in microdeg>; they used to be made in the namespace
+//   of the petal file and named after the child and phi in millideg
+//   (e.g. TECOptoHybrid<millideg>), names which no longer exist
 ///////////////////////////////////////////////////////////////////////////////
 
 #include <cmath>
 #include <algorithm>
 
 #include "FWCore/MessageLogger/interface/MessageLogger.h"
-#include "DetectorDescription/Base/interface/DDutils.h"
 #include "DetectorDescription/Core/interface/DDCurrentNamespace.h"
 #include "DetectorDescription/Core/interface/DDSplit.h"
 #include "Geometry/TrackerCommonData/plugins/DDTECOptoHybAlgo.h"
+#include "Geometry/TrackerCommonData/plugins/DDTrackerPlacements.h"
 #include "CLHEP/Units/GlobalPhysicalConstants.h"
 #include "CLHEP/Units/GlobalSystemOfUnits.h"
 
@@ -25,74 +33,108 @@ void DDTECOptoHybAlgo::initialize(const DDNumericArguments & nArgs,
 				  const DDVectorArguments & vArgs,
 				  const DDMapArguments & ,
 				  const DDStringArguments & sArgs,
-				  const DDStringVectorArguments & ) {
+				  const DDStringVectorArguments & vsArgs) {
 
   idNameSpace  = DDCurrentNamespace::ns();
-  childName    = sArgs["ChildName"];
+  angles       = vArgs["Angles"];
 
   DDName parentName = parent().name(); 
+  parents.clear();
+  childName.clear();
+  optoHeight.clear();
+  optoWidth.clear();
+  rpos.clear();
+  zpos.clear();
+  startCopyNo.clear();
+  rows.clear();
+  if (vsArgs.find("Parents") != vsArgs.end()) {
+    // batch: a table with one row per set of Hybrids
+    parents      = vsArgs["Parents"];
+    childName    = vsArgs["ChildName"];
+    optoHeight   = vArgs["OptoHeight"];
+    optoWidth    = vArgs["OptoWidth"];
+    rpos         = vArgs["Rpos"];
+    zpos         = vArgs["Zpos"];
+    std::vector<double> copies = vArgs["StartCopyNo"];
+    std::vector<double> hybrids = vArgs["Rows"];
+    for (int i=0; i<(int)(copies.size()); i++)
+      startCopyNo.push_back(int(copies[i]));
+    for (int i=0; i<(int)(hybrids.size()); i++)
+      rows.push_back(int(hybrids[i]));
+  } else {
+    parents.push_back(parentName.fullname());
+    childName.push_back(sArgs["ChildName"]);
+    optoHeight.push_back(nArgs["OptoHeight"]);
+    optoWidth.push_back(nArgs["OptoWidth"]);
+    rpos.push_back(nArgs["Rpos"]);
+    zpos.push_back(nArgs["Zpos"]);
+    startCopyNo.push_back(int (nArgs["StartCopyNo"]));
+    rows.push_back((int)(angles.size()));
+  }
 
   LogDebug("TECGeom") << "DDTECOptoHybAlgo debug: Parent " << parentName 
-		      << " Child " << childName << " NameSpace " <<idNameSpace;
-
-  optoHeight     = nArgs["OptoHeight"];
-  optoWidth      = nArgs["OptoWidth"];
-  rpos           = nArgs["Rpos"];
-  zpos           = nArgs["Zpos"];
-  startCopyNo    = int (nArgs["StartCopyNo"]);
-  angles         = vArgs["Angles"];
-
-  LogDebug("TECGeom") << "DDTECOptoHybAlgo debug: Height of the Hybrid "
-		      << optoHeight << " and Width " << optoWidth
-		      <<"Rpos " << rpos << " Zpos " << zpos 
-		      << " StartCopyNo " << startCopyNo << " Number " 
-		      << angles.size();
-
-  for (int i = 0; i < (int)(angles.size()); i++)
-    LogDebug("TECGeom") << "\tAngles[" << i << "] = " << angles[i];
+		      << " NameSpace " << idNameSpace << " with " 
+		      << parents.size() << " rows";
+
+  int total = 0;
+  for (int i=0; i<(int)(rows.size()); i++) total += rows[i];
+  unsigned int n = parents.size();
+  if (childName.size() != n || optoHeight.size() != n || 
+      optoWidth.size() != n || rpos.size() != n || zpos.size() != n ||
+      startCopyNo.size() != n || rows.size() != n ||
+      total != (int)(angles.size())) {
+    edm::LogError("TECGeom") << "DDTECOptoHybAlgo error: the " << n
+			     << " rows of " << parentName << " do not have "
+			     << "one entry each or do not add up to the "
+			     << angles.size() << " Angles: nothing placed";
+    rows.clear();
+  }
 
+  int k = 0;
+  for (int j=0; j<(int)(rows.size()); j++) {
+    LogDebug("TECGeom") << "DDTECOptoHybAlgo debug: Row " << j << " "
+			<< childName[j] << " in " << parents[j]
+			<< " Height of the Hybrid " << optoHeight[j] 
+			<< " and Width " << optoWidth[j] << "Rpos " << rpos[j]
+			<< " Zpos " << zpos[j] << " StartCopyNo " 
+			<< startCopyNo[j] << " Number " << rows[j];
+    for (int i = 0; i < rows[j]; i++, k++)
+      LogDebug("TECGeom") << "\tAngles[" << k << "] = " << angles[k];
+  }
 }
 
 void DDTECOptoHybAlgo::execute(DDCompactView& cpv) {
   
   LogDebug("TECGeom") << "==>> Constructing DDTECOptoHybAlgo...";
 
-  DDName mother = parent().name();
-  DDName child  = DDName(DDSplit(childName).first, DDSplit(childName).second);
-
-  // given r positions are for the lower left corner
-  rpos += optoHeight/2;
-  int    copyNo = startCopyNo;
-  for (int i = 0; i < (int)(angles.size()); i++) {
-    double phix = -angles.at(i);
-    // given phi positions are for the lower left corner
-    phix += asin(optoWidth/2/rpos);
-    double xpos = rpos * cos(phix);
-    double ypos = rpos * sin(phix);
-    DDTranslation tran(xpos, ypos, zpos);
-
-    DDRotation rotation;
-    double phiy = phix + 90.*CLHEP::deg;
-    double phideg = phix/CLHEP::deg;
-    if (phideg != 0) {
-      std::string rotstr= DDSplit(childName).first+dbl_to_string(phideg*1000.);
-      rotation = DDRotation(DDName(rotstr, idNameSpace));
-      if (!rotation) {
-	double theta = 90.*CLHEP::deg;
-	LogDebug("TECGeom") << "DDTECOptoHybAlgo test: Creating a new "
-			    << "rotation: " << rotstr << "\t90., " 
-			    << phix/CLHEP::deg << ", 90.," << phiy/CLHEP::deg
-			    << ", 0, 0";
-	rotation = DDrot(DDName(rotstr, idNameSpace), theta, phix, theta, phiy,
-			 0., 0.);
-      }
+  int i = 0;
+  for (int j = 0; j < (int)(rows.size()); j++) {
+    DDName mother = DDName(DDSplit(parents[j]).first, 
+			   DDSplit(parents[j]).second);
+    DDName child  = DDName(DDSplit(childName[j]).first, 
+			   DDSplit(childName[j]).second);
+
+    // given r positions are for the lower left corner
+    double r      = rpos[j] + optoHeight[j]/2;
+    int    copyNo = startCopyNo[j];
+    for (int last = i + rows[j]; i < last; i++) {
+      double phix = -angles.at(i);
+      // given phi positions are for the lower left corner
+      phix += asin(optoWidth[j]/2/r);
+      double xpos = r * cos(phix);
+      double ypos = r * sin(phix);
+      DDTranslation tran(xpos, ypos, zpos[j]);
+
+      //Shared tracker:Phi<microdeg> rotation, not <child><millideg> in the
+      //namespace of the petal
+      DDRotation rotation = DDTrackerPlacements::phiRotation(phix);
+
+      cpv.position(child, mother, copyNo, tran, rotation);
+      LogDebug("TECGeom") << "DDTECOptoHybAlgo test " << child << " number " 
+			  << copyNo << " positioned in " << mother << " at "
+			  << tran  << " with " << rotation;
+      copyNo++;
     }
-
-   cpv.position(child, mother, copyNo, tran, rotation);
-    LogDebug("TECGeom") << "DDTECOptoHybAlgo test " << child << " number " 
-			<< copyNo << " positioned in " << mother << " at "
-			<< tran  << " with " << rotation;
-    copyNo++;
   }
   
   LogDebug("TECGeom") << "<<== End of DDTECOptoHybAlgo construction ...";
@@ -24,12 +24,16 @@ class DDTECOptoHybAlgo : public DDAlgorithm {
 private:
 
   std::string              idNameSpace;    //Namespace of this and ALL parts
-  std::string              childName;      //Child name
-  double                   rpos;           //r Position
-  double                   zpos;           //Z position of the OptoHybrid
-  double                   optoHeight;     // Height of the OptoHybrid
-  double                   optoWidth;     // Width of the OptoHybrid
-  int                      startCopyNo;    //Start copy number
+  //One entry per row (a single row without the argument Parents)
+  std::vector<std::string> parents;        //Parent name
+  std::vector<std::string> childName;      //Child name
+  std::vector<double>      rpos;           //r Position
+  std::vector<double>      zpos;           //Z position of the OptoHybrid
+  std::vector<double>      optoHeight;     // Height of the OptoHybrid
+  std::vector<double>      optoWidth;     // Width of the OptoHybrid
+  std::vector<int>         startCopyNo;    //Start copy number
+  std::vector<int>         rows;           //Number of Hybrids
+  //All the rows one after the other
   std::vector<double>      angles;         //Angular position of Hybrid
 };
 
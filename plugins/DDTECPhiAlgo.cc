@@ -7,10 +7,11 @@
 #include <algorithm>
 
 #include "FWCore/MessageLogger/interface/MessageLogger.h"
-#include "DetectorDescription/Base/interface/DDutils.h"
 #include "DetectorDescription/Core/interface/DDCurrentNamespace.h"
 #include "DetectorDescription/Core/interface/DDSplit.h"
 #include "Geometry/TrackerCommonData/plugins/DDTECPhiAlgo.h"
+#include "Geometry/TrackerCommonData/plugins/DDTrackerEnvelopeCheck.h"
+#include "Geometry/TrackerCommonData/plugins/DDTrackerPlacements.h"
 #include "CLHEP/Units/GlobalPhysicalConstants.h"
 #include "CLHEP/Units/GlobalSystemOfUnits.h"
 
@@ -54,33 +55,20 @@ void DDTECPhiAlgo::initialize(const DDNumericArguments & nArgs,
 void DDTECPhiAlgo::execute(DDCompactView& cpv) {
 
   if (number > 0) {
-    double theta  = 90.*CLHEP::deg;
     int    copyNo = startCopyNo;
 
     DDName mother = parent().name();
     DDName child(DDSplit(childName).first, DDSplit(childName).second);
+    DDTrackerEnvelopeCheck envelope("DDTECPhiAlgo", DDLogicalPart(mother));
     for (int i=0; i<number; i++) {
       double phix = startAngle + i*incrAngle;
-      double phiy = phix + 90.*CLHEP::deg;
-      double phideg = phix/CLHEP::deg;
-  
-      DDRotation rotation;
-      std::string rotstr = DDSplit(childName).first+dbl_to_string(phideg*10.);
-      rotation = DDRotation(DDName(rotstr, idNameSpace));
-      if (!rotation) {
-	LogDebug("TECGeom") << "DDTECPhiAlgo test: Creating a new "
-			    << "rotation " << rotstr << "\t" 
-			    << theta/CLHEP::deg << ", " << phix/CLHEP::deg 
-			    << ", " << theta/CLHEP::deg << ", "
-			    << phiy/CLHEP::deg << ", 0, 0";
-	rotation = DDrot(DDName(rotstr, idNameSpace), theta, phix, theta, phiy,
-			 0., 0.);
-      }
+      DDRotation rotation = DDTrackerPlacements::phiRotation(phix);
 	
       double zpos = zOut;
       if (i%2 == 0) zpos = zIn;
       DDTranslation tran(0., 0., zpos);
   
+      envelope.checkPart(DDLogicalPart(child), copyNo, tran, rotation);
      cpv.position(child, mother, copyNo, tran, rotation);
       LogDebug("TECGeom") << "DDTECPhiAlgo test: " << child <<" number "
 			  << copyNo << " positioned in " << mother <<" at "
@@ -11,6 +11,7 @@
 #include "DetectorDescription/Core/interface/DDCurrentNamespace.h"
 #include "DetectorDescription/Core/interface/DDSplit.h"
 #include "Geometry/TrackerCommonData/plugins/DDTECPhiAltAlgo.h"
+#include "Geometry/TrackerCommonData/plugins/DDTrackerEnvelopeCheck.h"
 #include "CLHEP/Units/GlobalPhysicalConstants.h"
 #include "CLHEP/Units/GlobalSystemOfUnits.h"
 
@@ -60,6 +61,7 @@ void DDTECPhiAltAlgo::execute(DDCompactView& cpv) {
 
     DDName mother = parent().name();
     DDName child(DDSplit(childName).first, DDSplit(childName).second);
+    DDTrackerEnvelopeCheck envelope("DDTECPhiAltAlgo", DDLogicalPart(mother));
     for (int i=0; i<number; i++) {
       double phiz = startAngle + i*incrAngle;
       double phix = phiz + 90.*CLHEP::deg;
@@ -85,6 +87,7 @@ void DDTECPhiAltAlgo::execute(DDCompactView& cpv) {
       else          zpos = zOut;
       DDTranslation tran(xpos, ypos, zpos);
   
+      envelope.checkPart(DDLogicalPart(child), copyNo, tran, rotation);
      cpv.position(child, mother, copyNo, tran, rotation);
       LogDebug("TECGeom") << "DDTECPhiAltAlgo test: " << child <<" number "
 			  << copyNo << " positioned in " << mother <<" at "
@@ -7,13 +7,17 @@
 #include <algorithm>
 
 #include "FWCore/MessageLogger/interface/MessageLogger.h"
-#include "DetectorDescription/Base/interface/DDutils.h"
 #include "DetectorDescription/Core/interface/DDLogicalPart.h"
 #include "DetectorDescription/Core/interface/DDSolid.h"
 #include "DetectorDescription/Core/interface/DDMaterial.h"
 #include "DetectorDescription/Core/interface/DDCurrentNamespace.h"
 #include "DetectorDescription/Core/interface/DDSplit.h"
 #include "Geometry/TrackerCommonData/plugins/DDTIBLayerAlgo.h"
+#include "Geometry/TrackerCommonData/plugins/DDTrackerBufferCounter.h"
+#include "Geometry/TrackerCommonData/plugins/DDTrackerEnvelopeCheck.h"
+#include "Geometry/TrackerCommonData/plugins/DDTrackerMixture.h"
+#include "Geometry/TrackerCommonData/plugins/DDTrackerNames.h"
+#include "Geometry/TrackerCommonData/plugins/DDTrackerSensorTable.h"
 #include "CLHEP/Units/GlobalPhysicalConstants.h"
 #include "CLHEP/Units/GlobalSystemOfUnits.h"
 
@@ -32,6 +36,11 @@ void DDTIBLayerAlgo::initialize(const DDNumericArguments & nArgs,
 
   idNameSpace  = DDCurrentNamespace::ns();
   genMat       = sArgs["GeneralMaterial"];
+  homogeneous  = false;
+  if (sArgs.find("HomogeneousSupport") != sArgs.end()) {
+    std::string comp = sArgs["HomogeneousSupport"];
+    homogeneous = (comp == "Yes" || comp == "YES" || comp == "yes");
+  }
   DDName parentName = parent().name(); 
   LogDebug("TIBGeom") << "DDTIBLayerAlgo debug: Parent " << parentName 
 		      << " NameSpace " << idNameSpace 
@@ -177,8 +186,10 @@ void DDTIBLayerAlgo::execute(DDCompactView& cpv) {
 
   LogDebug("TIBGeom") << "==>> Constructing DDTIBLayerAlgo...";
 
+  DDTrackerBufferCounter::Scope buffers("DDTIBLayerAlgo");
   DDName  parentName = parent().name(); 
   const std::string &idName = parentName.name();
+  std::string & rotName = DDTrackerBufferCounter::string();  //Phi rotations
 
   double rmin = MFRingInR;
   double rmax = MFRingOutR;
@@ -195,20 +206,23 @@ void DDTIBLayerAlgo::execute(DDCompactView& cpv) {
   DDName matname(DDSplit(genMat).first, DDSplit(genMat).second);
   DDMaterial matter(matname);
   DDLogicalPart layer(solid.ddname(), matter, solid);
+  DDTrackerEnvelopeCheck envelope("DDTIBLayerAlgo", layer.name(), rmin, rmax,
+				  0.5*layerL);
 
   //Internal layer first
   double rin  = rmin+MFRingT;
   //  double rout = 0.5*(radiusLo+radiusUp-cylinderT);
   double rout = cylinderInR;
-  std::string name = idName + "Down";
-  solid = DDSolidFactory::tubs(DDName(name, idNameSpace), 0.5*layerL,
+  int name = DDTrackerNames::name(idName, "Down");
+  solid = DDSolidFactory::tubs(DDTrackerNames::ddname(name, idNameSpace), 0.5*layerL,
 			       rin, rout, 0, CLHEP::twopi);
   LogDebug("TIBGeom") << "DDTIBLayerAlgo test: " 
-		      << DDName(name, idNameSpace) << " Tubs made of " 
+		      << DDTrackerNames::ddname(name, idNameSpace) << " Tubs made of " 
 		      << genMat << " from 0 to " << CLHEP::twopi/CLHEP::deg 
 		      << " with Rin " << rin << " Rout " << rout 
 		      << " ZHalf " << 0.5*layerL;
   DDLogicalPart layerIn(solid.ddname(), matter, solid);
+  envelope.checkTubs(layerIn.name(), 1, rin, rout, 0.5*layerL);
  cpv.position(layerIn, layer, 1, DDTranslation(0.0, 0.0, 0.0), DDRotation());
   LogDebug("TIBGeom") << "DDTIBLayerAlgo test: " << layerIn.name()
 		      << " number 1 positioned in " << layer.name()
@@ -217,6 +231,9 @@ void DDTIBLayerAlgo::execute(DDCompactView& cpv) {
   double rposdet = radiusLo;
   double dphi    = CLHEP::twopi/stringsLo;
   DDName detIn(DDSplit(detectorLo).first, DDSplit(detectorLo).second);
+  DDTrackerSensorTable::instance().defineModule(cpv, DDLogicalPart(detIn));
+  DDTrackerEnvelopeCheck envelopeIn("DDTIBLayerAlgo", layerIn.name(), rin,
+				    rout, 0.5*layerL);
   for (int n = 0; n < stringsLo; n++) {
     double phi    = (n+0.5)*dphi;
     double phix   = phi - detectorTilt + 90*CLHEP::deg;
@@ -225,18 +242,20 @@ void DDTIBLayerAlgo::execute(DDCompactView& cpv) {
     if (phideg != 0) {
       double theta  = 90*CLHEP::deg;
       double phiy   = phix + 90.*CLHEP::deg;
-      std::string rotstr = idName + dbl_to_string(phideg*10.);
-      rotation = DDRotation(DDName(rotstr, idNameSpace));
+      rotName = idName;
+      DDTrackerBufferCounter::append(rotName, int(phideg*10.));
+      rotation = DDRotation(DDName(rotName, idNameSpace));
       if (!rotation) {
         LogDebug("TIBGeom") << "DDTIBLayerAlgo test: Creating a new "
-			    << "rotation: "	<< rotstr << "\t90., " 
+			    << "rotation: "	<< rotName << "\t90., " 
 			    << phix/CLHEP::deg << ", 90.,"
 			    << phiy/CLHEP::deg << ", 0, 0";
-        rotation = DDrot(DDName(rotstr, idNameSpace), theta, phix, theta, phiy,
+        rotation = DDrot(DDName(rotName, idNameSpace), theta, phix, theta, phiy,
                          0., 0.);
       }
     }
     DDTranslation trdet(rposdet*cos(phi), rposdet*sin(phi), 0);
+    envelopeIn.checkPart(detIn, n+1, trdet, rotation);
    cpv.position(detIn, layerIn, n+1, trdet, rotation);
     LogDebug("TIBGeom") << "DDTIBLayerAlgo test " << detIn.name() 
 			<< " number " << n+1 << " positioned in " 
@@ -247,15 +266,16 @@ void DDTIBLayerAlgo::execute(DDCompactView& cpv) {
   //Now the external layer
   rin  = cylinderInR + cylinderT;
   rout = rmax-MFRingT;
-  name = idName + "Up";
-  solid = DDSolidFactory::tubs(DDName(name, idNameSpace), 0.5*layerL,
+  name = DDTrackerNames::name(idName, "Up");
+  solid = DDSolidFactory::tubs(DDTrackerNames::ddname(name, idNameSpace), 0.5*layerL,
 			       rin, rout, 0, CLHEP::twopi);
   LogDebug("TIBGeom") << "DDTIBLayerAlgo test: " 
-		      << DDName(name, idNameSpace) << " Tubs made of " 
+		      << DDTrackerNames::ddname(name, idNameSpace) << " Tubs made of " 
 		      << genMat << " from 0 to " << CLHEP::twopi/CLHEP::deg 
 		      << " with Rin " << rin << " Rout " << rout
 		      << " ZHalf " << 0.5*layerL;
   DDLogicalPart layerOut(solid.ddname(), matter, solid);
+  envelope.checkTubs(layerOut.name(), 1, rin, rout, 0.5*layerL);
  cpv.position(layerOut, layer, 1, DDTranslation(0.0, 0.0, 0.0), DDRotation());
   LogDebug("TIBGeom") << "DDTIBLayerAlgo test: " << layerOut.name() 
 		      << " number 1 positioned in " << layer.name() 
@@ -264,6 +284,9 @@ void DDTIBLayerAlgo::execute(DDCompactView& cpv) {
   rposdet = radiusUp;
   dphi    = CLHEP::twopi/stringsUp;
   DDName detOut(DDSplit(detectorUp).first, DDSplit(detectorUp).second);
+  DDTrackerSensorTable::instance().defineModule(cpv, DDLogicalPart(detOut));
+  DDTrackerEnvelopeCheck envelopeOut("DDTIBLayerAlgo", layerOut.name(), rin,
+				     rout, 0.5*layerL);
   for (int n = 0; n < stringsUp; n++) {
     double phi    = (n+0.5)*dphi;
     double phix   = phi - detectorTilt - 90*CLHEP::deg;
@@ -272,18 +295,20 @@ void DDTIBLayerAlgo::execute(DDCompactView& cpv) {
     if (phideg != 0) {
       double theta  = 90*CLHEP::deg;
       double phiy   = phix + 90.*CLHEP::deg;
-      std::string rotstr = idName + dbl_to_string(phideg*10.);
-      rotation = DDRotation(DDName(rotstr, idNameSpace));
+      rotName = idName;
+      DDTrackerBufferCounter::append(rotName, int(phideg*10.));
+      rotation = DDRotation(DDName(rotName, idNameSpace));
       if (!rotation) {
         LogDebug("TIBGeom") << "DDTIBLayerAlgo test: Creating a new "
-			    << "rotation: " << rotstr << "\t90., " 
+			    << "rotation: " << rotName << "\t90., " 
 			    << phix/CLHEP::deg << ", 90.,"
 			    << phiy/CLHEP::deg << ", 0, 0";
-        rotation = DDrot(DDName(rotstr, idNameSpace), theta, phix, theta, phiy,
+        rotation = DDrot(DDName(rotName, idNameSpace), theta, phix, theta, phiy,
                          0., 0.);
       }
     }
     DDTranslation trdet(rposdet*cos(phi), rposdet*sin(phi), 0);
+    envelopeOut.checkPart(detOut, n+1, trdet, rotation);
    cpv.position(detOut, layerOut, n+1, trdet, rotation);
     LogDebug("TIBGeom") << "DDTIBLayerAlgo test " << detOut.name() 
 			<< " number " << n+1 << " positioned in " 
@@ -297,105 +322,40 @@ void DDTIBLayerAlgo::execute(DDCompactView& cpv) {
   // External skins
   rin  = cylinderInR;
   rout = cylinderInR+cylinderT;
-  name = idName + "Cylinder";
-  solid = DDSolidFactory::tubs(DDName(name, idNameSpace), 0.5*layerL,
+  name = DDTrackerNames::name(idName, "Cylinder");
+  solid = DDSolidFactory::tubs(DDTrackerNames::ddname(name, idNameSpace), 0.5*layerL,
 			       rin, rout, 0, CLHEP::twopi);
   LogDebug("TIBGeom") << "DDTIBLayerAlgo test: " 
-		      << DDName(name, idNameSpace) << " Tubs made of " 
+		      << DDTrackerNames::ddname(name, idNameSpace) << " Tubs made of " 
 		      << cylinderMat << " from 0 to " 
 		      << CLHEP::twopi/CLHEP::deg << " with Rin " << rin 
 		      << " Rout " << rout << " ZHalf " << 0.5*layerL;
   matname = DDName(DDSplit(cylinderMat).first, DDSplit(cylinderMat).second);
   DDMaterial matcyl(matname);
+  if (homogeneous) {
+    // Skins, fillers and ribs in one volume
+    double rinIn  = rin + supportT;
+    double routIn = rout - supportT;
+    double ribDz  = 0.5*layerL-2.*fillerDz;
+    DDTrackerMixture mixture(genMat);
+    mixture.add(matcyl, CLHEP::pi*(rout*rout-rin*rin)*layerL - 
+		CLHEP::pi*(routIn*routIn-rinIn*rinIn)*layerL);
+    mixture.add(fillerMat, CLHEP::pi*(routIn*routIn-rinIn*rinIn)*2.*fillerDz,
+		2);
+    for (unsigned int i = 0; i < ribW.size(); i++) {
+      double width = 2.*ribW[i]/(rinIn+routIn);
+      double r1 = rinIn+0.5*CLHEP::mm, r2 = routIn-0.5*CLHEP::mm;
+      mixture.add(ribMat, width*(r2*r2-r1*r1)*ribDz);
+    }
+    matcyl = mixture.make(DDTrackerNames::ddname(DDTrackerNames::name(name, "Mixture"), idNameSpace),
+			  CLHEP::pi*(rout*rout-rin*rin)*layerL);
+  }
   DDLogicalPart cylinder(solid.ddname(), matcyl, solid);
+  envelope.checkTubs(cylinder.name(), 1, rin, rout, 0.5*layerL);
  cpv.position(cylinder, layer, 1, DDTranslation(0.0, 0.0, 0.0), DDRotation());
   LogDebug("TIBGeom") << "DDTIBLayerAlgo test: " << cylinder.name() 
 		      << " number 1 positioned in " << layer.name()
 		      << " at (0,0,0) with no rotation";
-  //
-  // inner part of the cylinder
-  //
-  rin  += supportT;
-  rout -= supportT;
-  name  = idName + "CylinderIn";
-  solid = DDSolidFactory::tubs(DDName(name, idNameSpace), 0.5*layerL,
-			       rin, rout, 0, CLHEP::twopi);
-  LogDebug("TIBGeom") << "DDTIBLayerAlgo test: "
-		      << DDName(name, idNameSpace) << " Tubs made of "
-		      << genMat << " from 0 to " << CLHEP::twopi/CLHEP::deg 
-		      << " with Rin " << rin << " Rout " << rout 
-		      << " ZHalf " << 0.5*layerL;
-  DDLogicalPart cylinderIn(solid.ddname(), matter, solid);
- cpv.position(cylinderIn, cylinder, 1, DDTranslation(0.0, 0.0, 0.0), DDRotation());
-  LogDebug("TIBGeom") << "DDTIBLayerAlgo test: " << cylinderIn.name() 
-		      << " number 1 positioned in " << cylinder.name() 
-		      << " at (0,0,0) with no rotation";
-  //
-  // Filler Rings
-  //
-  matname = DDName(DDSplit(fillerMat).first, DDSplit(fillerMat).second);
-  DDMaterial matfiller(matname);
-  name = idName + "Filler";
-  solid = DDSolidFactory::tubs(DDName(name, idNameSpace), fillerDz, rin, rout, 
-			       0., CLHEP::twopi);
-  LogDebug("TIBGeom") << "DDTIBLayerAlgo test: " 
-		      << DDName(name, idNameSpace) << " Tubs made of " 
-		      << fillerMat << " from " << 0. << " to "
-		      << CLHEP::twopi/CLHEP::deg << " with Rin " << rin 
-		      << " Rout " << rout << " ZHalf "  << fillerDz;
-  DDLogicalPart cylinderFiller(solid.ddname(), matfiller, solid);
- cpv.position(cylinderFiller, cylinderIn, 1, DDTranslation(0.0, 0.0, 0.5*layerL-fillerDz), DDRotation());
- cpv.position(cylinderFiller, cylinderIn, 2, DDTranslation(0.0, 0.0,-0.5*layerL+fillerDz), DDRotation());
-  LogDebug("TIBGeom") << "DDTIBLayerAlgo test " << cylinderFiller.name()
-		      << " number 1" << " positioned in " 
-		      << cylinderIn.name() << " at " << DDTranslation(0.0, 0.0, 0.5*layerL-fillerDz)
-		      << " number 2" << " positioned in " 
-		      << cylinderIn.name() << " at " << DDTranslation(0.0, 0.0,-0.5*layerL+fillerDz);
-
-  //
-  // Ribs
-  //
-  matname = DDName(DDSplit(ribMat).first, DDSplit(ribMat).second);
-  DDMaterial matrib(matname);
-  for (int i = 0; i < (int)(ribW.size()); i++) {
-    name = idName + "Rib" + dbl_to_string(i);
-    double width = 2.*ribW[i]/(rin+rout);
-    double dz    = 0.5*layerL-2.*fillerDz;
-    solid = DDSolidFactory::tubs(DDName(name, idNameSpace), dz, 
-				 rin+0.5*CLHEP::mm, rout-0.5*CLHEP::mm, 
-				 -0.5*width, width);
-    LogDebug("TIBGeom") << "DDTIBLayerAlgo test: " 
-			<< DDName(name, idNameSpace) << " Tubs made of " 
-			<< ribMat << " from " << -0.5*width/CLHEP::deg <<" to "
-			<< 0.5*width/CLHEP::deg << " with Rin " 
-			<< rin+0.5*CLHEP::mm << " Rout " 
-			<< rout-0.5*CLHEP::mm << " ZHalf "  << dz;
-    DDLogicalPart cylinderRib(solid.ddname(), matrib, solid);
-    double phix   = ribPhi[i];
-    double phideg = phix/CLHEP::deg;
-    DDRotation rotation;
-    if (phideg != 0) {
-      double theta  = 90*CLHEP::deg;
-      double phiy   = phix + 90.*CLHEP::deg;
-      std::string rotstr = idName + dbl_to_string(phideg*10.);
-      rotation = DDRotation(DDName(rotstr, idNameSpace));
-      if (!rotation) {
-        LogDebug("TIBGeom") << "DDTIBLayerAlgo test: Creating a new "
-			    << "rotation: "	<< rotstr << "\t90., " 
-			    << phix/CLHEP::deg << ", 90.," << phiy/CLHEP::deg 
-			    << ", 0, 0";
-        rotation = DDrot(DDName(rotstr, idNameSpace), theta, phix, theta, phiy,
-                         0., 0.);
-      }
-    }
-    DDTranslation tran(0, 0, 0);
-   cpv.position(cylinderRib, cylinderIn, 1, tran, rotation);
-    LogDebug("TIBGeom") << "DDTIBLayerAlgo test " << cylinderRib.name()
-			<< " number 1" << " positioned in " 
-			<< cylinderIn.name() << " at " << tran << " with " 
-			<< rotation;
-  }
-
   //Manifold rings
   //
   // Inner ones first
@@ -403,12 +363,12 @@ void DDTIBLayerAlgo::execute(DDCompactView& cpv) {
   DDMaterial matintmfr(matname);
   rin  = MFRingInR;
   rout = rin + MFRingT;
-  name = idName + "InnerMFRing";
-  solid = DDSolidFactory::tubs(DDName(name, idNameSpace), MFRingDz,
+  name = DDTrackerNames::name(idName, "InnerMFRing");
+  solid = DDSolidFactory::tubs(DDTrackerNames::ddname(name, idNameSpace), MFRingDz,
 			       rin, rout, 0, CLHEP::twopi);
 
   LogDebug("TIBGeom") << "DDTIBLayerAlgo test: " 
-		      << DDName(name, idNameSpace) << " Tubs made of " 
+		      << DDTrackerNames::ddname(name, idNameSpace) << " Tubs made of " 
 		      << MFIntRingMat << " from 0 to " 
 		      << CLHEP::twopi/CLHEP::deg << " with Rin " << rin 
 		      << " Rout " << rout << " ZHalf " << MFRingDz;
@@ -424,12 +384,12 @@ void DDTIBLayerAlgo::execute(DDCompactView& cpv) {
   DDMaterial matextmfr(matname);
   rout  = MFRingOutR;
   rin   = rout - MFRingT;
-  name = idName + "OuterMFRing";
-  solid = DDSolidFactory::tubs(DDName(name, idNameSpace), MFRingDz,
+  name = DDTrackerNames::name(idName, "OuterMFRing");
+  solid = DDSolidFactory::tubs(DDTrackerNames::ddname(name, idNameSpace), MFRingDz,
 			       rin, rout, 0, CLHEP::twopi);
 
   LogDebug("TIBGeom") << "DDTIBLayerAlgo test: " 
-		      << DDName(name, idNameSpace) << " Tubs made of " 
+		      << DDTrackerNames::ddname(name, idNameSpace) << " Tubs made of " 
 		      << MFExtRingMat << " from 0 to " 
 		      << CLHEP::twopi/CLHEP::deg << " with Rin " << rin 
 		      << " Rout " << rout << " ZHalf " << MFRingDz;
@@ -451,12 +411,12 @@ void DDTIBLayerAlgo::execute(DDCompactView& cpv) {
   double centDz = 0.5*centRing1par[1];
   rin  = centRing1par[2];
   rout = centRing1par[3];
-  name = idName + "CentRing1";
-  solid = DDSolidFactory::tubs(DDName(name, idNameSpace), centDz,
+  name = DDTrackerNames::name(idName, "CentRing1");
+  solid = DDSolidFactory::tubs(DDTrackerNames::ddname(name, idNameSpace), centDz,
 			       rin, rout, 0, CLHEP::twopi);
 
   LogDebug("TIBGeom") << "DDTIBLayerAlgo test: " 
-		      << DDName(name, idNameSpace) << " Tubs made of " 
+		      << DDTrackerNames::ddname(name, idNameSpace) << " Tubs made of " 
 		      << centMat << " from 0 to " << CLHEP::twopi/CLHEP::deg 
 		      << " with Rin " << rin << " Rout " << rout 
 		      << " ZHalf " << centDz;
@@ -471,12 +431,12 @@ void DDTIBLayerAlgo::execute(DDCompactView& cpv) {
   centDz = 0.5*centRing2par[1];
   rin  = centRing2par[2];
   rout = centRing2par[3];
-  name = idName + "CentRing2";
-  solid = DDSolidFactory::tubs(DDName(name, idNameSpace), centDz,
+  name = DDTrackerNames::name(idName, "CentRing2");
+  solid = DDSolidFactory::tubs(DDTrackerNames::ddname(name, idNameSpace), centDz,
 			       rin, rout, 0, CLHEP::twopi);
 
   LogDebug("TIBGeom") << "DDTIBLayerAlgo test: " 
-		      << DDName(name, idNameSpace) << " Tubs made of " 
+		      << DDTrackerNames::ddname(name, idNameSpace) << " Tubs made of " 
 		      << centMat << " from 0 to " << CLHEP::twopi/CLHEP::deg 
 		      << " with Rin " << rin << " Rout " << rout 
 		      << " ZHalf " << centDz;
@@ -488,22 +448,30 @@ void DDTIBLayerAlgo::execute(DDCompactView& cpv) {
 		      << " at (0,0," << centZ << ") with no rotation";
 
   ////// DOHM
+  //
+  // Homogenized: the DOHM carriers and the pillars made as rings by
+  // homogeneousServices(), the inside of the cylinder not detailed
+  if (homogeneous) {
+    homogeneousServices(cpv);
+    return;
+  }
+
   //
   // Preparing DOHM Carrier solid
 
-  name = idName + "DOHMCarrier";
+  name = DDTrackerNames::name(idName, "DOHMCarrier");
 
   double dohmCarrierRin   = MFRingOutR - MFRingT;
   double dohmCarrierRout  = MFRingOutR;
   double dohmCarrierDz    = 0.5*(dohmPrimL+dohmtoMF);
   double dohmCarrierZ     = 0.5*layerL-2.*MFRingDz-dohmCarrierDz;
 
-  solid = DDSolidFactory::tubs(DDName(name, idNameSpace), dohmCarrierDz, 
+  solid = DDSolidFactory::tubs(DDTrackerNames::ddname(name, idNameSpace), dohmCarrierDz, 
 			       dohmCarrierRin, dohmCarrierRout, 
 			       dohmCarrierPhiOff, 
 			       180.*CLHEP::deg-2.*dohmCarrierPhiOff);
   LogDebug("TIBGeom") << "DDTIBLayerAlgo test: " 
-		      << DDName(name, idNameSpace) << " Tubs made of "
+		      << DDTrackerNames::ddname(name, idNameSpace) << " Tubs made of "
 		      << dohmCarrierMaterial << " from "
 		      << dohmCarrierPhiOff << " to " 
 		      << 180.*CLHEP::deg-dohmCarrierPhiOff << " with Rin "
@@ -525,55 +493,55 @@ void DDTIBLayerAlgo::execute(DDCompactView& cpv) {
 
     std::vector<double> dohmList;
     DDTranslation tran;
-    std::string rotstr;
+    int rotstr = 0;
     DDRotation rotation;
     int dohmCarrierReplica=0;
     int placeDohm = 0;
 
     switch (j){
     case 0:
-      name = idName + "DOHMCarrierFW";
+      name = DDTrackerNames::name(idName, "DOHMCarrierFW");
       dohmList = dohmListFW;
       tran = DDTranslation(0., 0., dohmCarrierZ);
-      rotstr = idName + "FwUp";
+      rotstr = DDTrackerNames::name(idName, "FwUp");
       rotation = DDRotation();
       dohmCarrierReplica = 1;
       placeDohm=1;
       break;
     case 1:
-      name = idName + "DOHMCarrierFW";
+      name = DDTrackerNames::name(idName, "DOHMCarrierFW");
       dohmList = dohmListFW;
       tran = DDTranslation(0., 0., dohmCarrierZ);
-      rotstr = idName + "FwDown";
-      rotation = DDrot(DDName(rotstr, idNameSpace), 90.*CLHEP::deg, 
+      rotstr = DDTrackerNames::name(idName, "FwDown");
+      rotation = DDrot(DDTrackerNames::ddname(rotstr, idNameSpace), 90.*CLHEP::deg, 
 		       180.*CLHEP::deg, 90.*CLHEP::deg,270.*CLHEP::deg, 0.,0.);
       dohmCarrierReplica = 2;
       placeDohm=0;
       break;
     case 2:
-      name = idName + "DOHMCarrierBW";
+      name = DDTrackerNames::name(idName, "DOHMCarrierBW");
       dohmList = dohmListBW;
       tran = DDTranslation(0., 0., -dohmCarrierZ);
-      rotstr = idName + "BwUp";
-      rotation = DDrot(DDName(rotstr, idNameSpace), 90.*CLHEP::deg, 
+      rotstr = DDTrackerNames::name(idName, "BwUp");
+      rotation = DDrot(DDTrackerNames::ddname(rotstr, idNameSpace), 90.*CLHEP::deg, 
 		       180.*CLHEP::deg, 90.*CLHEP::deg, 90.*CLHEP::deg, 
 		       180.*CLHEP::deg, 0.);
       dohmCarrierReplica = 1;
       placeDohm=1;
       break;
     case 3:
-      name = idName + "DOHMCarrierBW";
+      name = DDTrackerNames::name(idName, "DOHMCarrierBW");
       dohmList = dohmListBW;
       tran = DDTranslation(0., 0., -dohmCarrierZ);
-      rotstr = idName + "BwDown";
-      rotation = DDrot(DDName(rotstr, idNameSpace), 90.*CLHEP::deg, 0., 
+      rotstr = DDTrackerNames::name(idName, "BwDown");
+      rotation = DDrot(DDTrackerNames::ddname(rotstr, idNameSpace), 90.*CLHEP::deg, 0., 
 		       90.*CLHEP::deg, 270.*CLHEP::deg, 180.*CLHEP::deg, 0.);
       dohmCarrierReplica = 2;
       placeDohm=0;
       break;
     }
 
-    DDLogicalPart dohmCarrier(name,DDMaterial(dohmCarrierMaterial),solid);
+    DDLogicalPart dohmCarrier(DDName(DDTrackerNames::text(name)),DDMaterial(dohmCarrierMaterial),solid);
 
     int primReplica = 0;
     int auxReplica = 0;
@@ -586,14 +554,14 @@ void DDTIBLayerAlgo::execute(DDCompactView& cpv) {
       if (phideg != 0) {
 	double theta  = 90*CLHEP::deg;
 	double phiy   = phix + 90.*CLHEP::deg;
-	std::string   rotstr = idName+dbl_to_string(std::abs(dohmList[i])-1.);
-	dohmRotation = DDRotation(DDName(rotstr, idNameSpace));
+	int rotstr = DDTrackerNames::name(idName, "", int(std::abs(dohmList[i])-1.));
+	dohmRotation = DDRotation(DDTrackerNames::ddname(rotstr, idNameSpace));
 	if (!dohmRotation) {
 	  LogDebug("TIBGeom") << "DDTIBLayerAlgo test: Creating a new "
-			      << "rotation: "	<< rotstr << "\t" << theta 
+			      << "rotation: "	<< DDTrackerNames::text(rotstr) << "\t" << theta 
 			      << ", " << phix/CLHEP::deg << ", " << theta 
 			      << ", " << phiy/CLHEP::deg <<", 0, 0";
-	  dohmRotation = DDrot(DDName(rotstr, idNameSpace), theta, phix, theta,
+	  dohmRotation = DDrot(DDTrackerNames::ddname(rotstr, idNameSpace), theta, phix, theta,
 			       phiy, 0., 0.);
 	}
       }
@@ -647,7 +615,7 @@ void DDTIBLayerAlgo::execute(DDCompactView& cpv) {
     
     switch (j){
     case 0:
-      name = idName + "FWIntPillar";
+      name = DDTrackerNames::name(idName, "FWIntPillar");
       pillarZ    = fwIntPillarZ;
       pillarPhi  = fwIntPillarPhi;
       pillarRin  = MFRingInR;
@@ -656,7 +624,7 @@ void DDTIBLayerAlgo::execute(DDCompactView& cpv) {
       pillarDPhi = fwIntPillarDPhi;
       break;
     case 1:
-      name = idName + "BWIntPillar";
+      name = DDTrackerNames::name(idName, "BWIntPillar");
       pillarZ    = bwIntPillarZ;
       pillarPhi  = bwIntPillarPhi;
       pillarRin  = MFRingInR;
@@ -665,7 +633,7 @@ void DDTIBLayerAlgo::execute(DDCompactView& cpv) {
       pillarDPhi = bwIntPillarDPhi;
       break;
     case 2:
-      name = idName + "FWExtPillar";
+      name = DDTrackerNames::name(idName, "FWExtPillar");
       pillarZ    = fwExtPillarZ;
       pillarPhi  = fwExtPillarPhi;
       pillarRin  = MFRingOutR - MFRingT;
@@ -674,7 +642,7 @@ void DDTIBLayerAlgo::execute(DDCompactView& cpv) {
       pillarDPhi = fwExtPillarDPhi;
       break;
     case 3:
-      name = idName + "BWExtPillar";
+      name = DDTrackerNames::name(idName, "BWExtPillar");
       pillarZ    = bwExtPillarZ;
       pillarPhi  = bwExtPillarPhi;
       pillarRin  = MFRingOutR - MFRingT;
@@ -685,14 +653,14 @@ void DDTIBLayerAlgo::execute(DDCompactView& cpv) {
     }
     
     
-    solid = DDSolidFactory::tubs(DDName(name, idNameSpace), pillarDz, 
+    solid = DDSolidFactory::tubs(DDTrackerNames::ddname(name, idNameSpace), pillarDz, 
 				 pillarRin, pillarRout, 
 				 -pillarDPhi, 2.*pillarDPhi);
     
-    DDLogicalPart Pillar(name,DDMaterial(pillarMat),solid);
+    DDLogicalPart Pillar(DDName(DDTrackerNames::text(name)),DDMaterial(pillarMat),solid);
     
     LogDebug("TIBGeom") << "DDTIBLayerAlgo test: " 
-			<< DDName(name, idNameSpace) << " Tubs made of "
+			<< DDTrackerNames::ddname(name, idNameSpace) << " Tubs made of "
 			<< pillarMat << " from "
 			<< -pillarDPhi << " to " 
 			<< pillarDPhi << " with Rin "
@@ -722,4 +690,232 @@ void DDTIBLayerAlgo::execute(DDCompactView& cpv) {
     
   }
 
+  //
+  // inner part of the cylinder
+  //
+  rin  = cylinderInR;
+  rout = cylinderInR+cylinderT;
+  rin  += supportT;
+  rout -= supportT;
+  name  = DDTrackerNames::name(idName, "CylinderIn");
+  solid = DDSolidFactory::tubs(DDTrackerNames::ddname(name, idNameSpace), 0.5*layerL,
+			       rin, rout, 0, CLHEP::twopi);
+  LogDebug("TIBGeom") << "DDTIBLayerAlgo test: "
+		      << DDTrackerNames::ddname(name, idNameSpace) << " Tubs made of "
+		      << genMat << " from 0 to " << CLHEP::twopi/CLHEP::deg 
+		      << " with Rin " << rin << " Rout " << rout 
+		      << " ZHalf " << 0.5*layerL;
+  DDLogicalPart cylinderIn(solid.ddname(), matter, solid);
+ cpv.position(cylinderIn, cylinder, 1, DDTranslation(0.0, 0.0, 0.0), DDRotation());
+  LogDebug("TIBGeom") << "DDTIBLayerAlgo test: " << cylinderIn.name() 
+		      << " number 1 positioned in " << cylinder.name() 
+		      << " at (0,0,0) with no rotation";
+  //
+  // Filler Rings
+  //
+  matname = DDName(DDSplit(fillerMat).first, DDSplit(fillerMat).second);
+  DDMaterial matfiller(matname);
+  name = DDTrackerNames::name(idName, "Filler");
+  solid = DDSolidFactory::tubs(DDTrackerNames::ddname(name, idNameSpace), fillerDz, rin, rout, 
+			       0., CLHEP::twopi);
+  LogDebug("TIBGeom") << "DDTIBLayerAlgo test: " 
+		      << DDTrackerNames::ddname(name, idNameSpace) << " Tubs made of " 
+		      << fillerMat << " from " << 0. << " to "
+		      << CLHEP::twopi/CLHEP::deg << " with Rin " << rin 
+		      << " Rout " << rout << " ZHalf "  << fillerDz;
+  DDLogicalPart cylinderFiller(solid.ddname(), matfiller, solid);
+ cpv.position(cylinderFiller, cylinderIn, 1, DDTranslation(0.0, 0.0, 0.5*layerL-fillerDz), DDRotation());
+ cpv.position(cylinderFiller, cylinderIn, 2, DDTranslation(0.0, 0.0,-0.5*layerL+fillerDz), DDRotation());
+  LogDebug("TIBGeom") << "DDTIBLayerAlgo test " << cylinderFiller.name()
+		      << " number 1" << " positioned in " 
+		      << cylinderIn.name() << " at " << DDTranslation(0.0, 0.0, 0.5*layerL-fillerDz)
+		      << " number 2" << " positioned in " 
+		      << cylinderIn.name() << " at " << DDTranslation(0.0, 0.0,-0.5*layerL+fillerDz);
+
+  //
+  // Ribs
+  //
+  matname = DDName(DDSplit(ribMat).first, DDSplit(ribMat).second);
+  DDMaterial matrib(matname);
+  for (int i = 0; i < (int)(ribW.size()); i++) {
+    name = DDTrackerNames::name(idName, "Rib", i);
+    double width = 2.*ribW[i]/(rin+rout);
+    double dz    = 0.5*layerL-2.*fillerDz;
+    solid = DDSolidFactory::tubs(DDTrackerNames::ddname(name, idNameSpace), dz, 
+				 rin+0.5*CLHEP::mm, rout-0.5*CLHEP::mm, 
+				 -0.5*width, width);
+    LogDebug("TIBGeom") << "DDTIBLayerAlgo test: " 
+			<< DDTrackerNames::ddname(name, idNameSpace) << " Tubs made of " 
+			<< ribMat << " from " << -0.5*width/CLHEP::deg <<" to "
+			<< 0.5*width/CLHEP::deg << " with Rin " 
+			<< rin+0.5*CLHEP::mm << " Rout " 
+			<< rout-0.5*CLHEP::mm << " ZHalf "  << dz;
+    DDLogicalPart cylinderRib(solid.ddname(), matrib, solid);
+    double phix   = ribPhi[i];
+    double phideg = phix/CLHEP::deg;
+    DDRotation rotation;
+    if (phideg != 0) {
+      double theta  = 90*CLHEP::deg;
+      double phiy   = phix + 90.*CLHEP::deg;
+      rotName = idName;
+      DDTrackerBufferCounter::append(rotName, int(phideg*10.));
+      rotation = DDRotation(DDName(rotName, idNameSpace));
+      if (!rotation) {
+	LogDebug("TIBGeom") << "DDTIBLayerAlgo test: Creating a new "
+			    << "rotation: "	<< rotName << "\t90., " 
+			    << phix/CLHEP::deg << ", 90.," << phiy/CLHEP::deg 
+			    << ", 0, 0";
+	rotation = DDrot(DDName(rotName, idNameSpace), theta, phix, theta, phiy,
+			 0., 0.);
+      }
+    }
+    DDTranslation tran(0, 0, 0);
+   cpv.position(cylinderRib, cylinderIn, 1, tran, rotation);
+    LogDebug("TIBGeom") << "DDTIBLayerAlgo test " << cylinderRib.name()
+			<< " number 1" << " positioned in " 
+			<< cylinderIn.name() << " at " << tran << " with " 
+			<< rotation;
+  }
+}
+
+void DDTIBLayerAlgo::homogeneousServices(DDCompactView& cpv) {
+
+  const std::string &idName = parent().name().name();
+  int         name;
+  DDSolid     solid;
+
+  //DOHM carriers: one ring at each end with the carriers and the DOHMs
+  double dohmCarrierRin   = MFRingOutR - MFRingT;
+  double dohmCarrierRout  = MFRingOutR;
+  double dohmCarrierDz    = 0.5*(dohmPrimL+dohmtoMF);
+  double dohmCarrierZ     = 0.5*layerL-2.*MFRingDz-dohmCarrierDz;
+  double dohmCarrierDPhi  = 180.*CLHEP::deg-2.*dohmCarrierPhiOff;
+  double dohmArea         = dohmCarrierRout*dohmCarrierRout -
+			    dohmCarrierRin*dohmCarrierRin;
+  DDLogicalPart dohmPrim(DDName(DDSplit(dohmPrimName).first,
+				DDSplit(dohmPrimName).second));
+  DDLogicalPart dohmAux(DDName(DDSplit(dohmAuxName).first,
+			       DDSplit(dohmAuxName).second));
+  solid = DDSolidFactory::tubs(DDTrackerNames::ddname(DDTrackerNames::name(idName, "DOHMRing"), idNameSpace),
+			       dohmCarrierDz, dohmCarrierRin, 
+			       dohmCarrierRout, 0, CLHEP::twopi);
+  LogDebug("TIBGeom") << "DDTIBLayerAlgo test: " << solid.name() 
+		      << " Tubs from 0 to " << CLHEP::twopi/CLHEP::deg 
+		      << " with Rin " << dohmCarrierRin << " Rout " 
+		      << dohmCarrierRout << " ZHalf " << dohmCarrierDz;
+
+  for (int j = 0; j<2; j++) {
+    std::vector<double> dohmList = (j == 0) ? dohmListFW : dohmListBW;
+    name = DDTrackerNames::name(idName, (j == 0) ? "DOHMCarrierFW" : "DOHMCarrierBW");
+    int prim = 0, aux = 0;
+    for (unsigned int i = 0; i < dohmList.size(); i++) {
+      if (dohmList[i] < 0.) aux++;
+      else                  prim++;
+    }
+    // Both carriers of an end hold the DOHMs of the list, in place of
+    // their own material
+    double carrier = 2.*dohmCarrierDPhi*dohmArea*dohmCarrierDz;
+    if (dohmPrim.solid().volume() > 0)
+      carrier -= 2*prim*dohmPrim.solid().volume();
+    if (dohmAux.solid().volume() > 0)
+      carrier -= 2*aux*dohmAux.solid().volume();
+    DDTrackerMixture mixture(genMat);
+    mixture.add(dohmCarrierMaterial, carrier);
+    mixture.add(dohmPrim, 2*prim);
+    mixture.add(dohmAux, 2*aux);
+    DDMaterial matdohm = mixture.make(DDTrackerNames::ddname(DDTrackerNames::name(name, "Mixture"), idNameSpace),
+				      2.*CLHEP::pi*dohmArea*dohmCarrierDz);
+    DDLogicalPart dohmRing(DDTrackerNames::ddname(name, idNameSpace), matdohm, solid);
+    DDTranslation tran(0., 0., (j == 0) ? dohmCarrierZ : -dohmCarrierZ);
+    cpv.position(dohmRing, parent(), 1, tran, DDRotation());
+    LogDebug("TIBGeom") << "DDTIBLayerAlgo test " << dohmRing.name() 
+			<< " with " << prim << " primary and " << aux 
+			<< " auxiliary DOHMs positioned in " 
+			<< parent().name() << " at " << tran 
+			<< " with no rotation";
+  }
+
+  //Pillars: the pillars at the same z in one ring
+  for (int j = 0; j<4; j++) {
+    std::vector<double> pillarZ, pillarPhi;
+    double pillarDz=0, pillarDPhi=0, pillarRin=0, pillarRout=0;
+    switch (j) {
+    case 0:
+      name       = DDTrackerNames::name(idName, "FWIntPillar");
+      pillarZ    = fwIntPillarZ;
+      pillarPhi  = fwIntPillarPhi;
+      pillarRin  = MFRingInR;
+      pillarRout = MFRingInR + MFRingT;
+      pillarDz   = fwIntPillarDz;
+      pillarDPhi = fwIntPillarDPhi;
+      break;
+    case 1:
+      name       = DDTrackerNames::name(idName, "BWIntPillar");
+      pillarZ    = bwIntPillarZ;
+      pillarPhi  = bwIntPillarPhi;
+      pillarRin  = MFRingInR;
+      pillarRout = MFRingInR + MFRingT;
+      pillarDz   = bwIntPillarDz;
+      pillarDPhi = bwIntPillarDPhi;
+      break;
+    case 2:
+      name       = DDTrackerNames::name(idName, "FWExtPillar");
+      pillarZ    = fwExtPillarZ;
+      pillarPhi  = fwExtPillarPhi;
+      pillarRin  = MFRingOutR - MFRingT;
+      pillarRout = MFRingOutR;
+      pillarDz   = fwExtPillarDz;
+      pillarDPhi = fwExtPillarDPhi;
+      break;
+    case 3:
+      name       = DDTrackerNames::name(idName, "BWExtPillar");
+      pillarZ    = bwExtPillarZ;
+      pillarPhi  = bwExtPillarPhi;
+      pillarRin  = MFRingOutR - MFRingT;
+      pillarRout = MFRingOutR;
+      pillarDz   = bwExtPillarDz;
+      pillarDPhi = bwExtPillarDPhi;
+      break;
+    }
+
+    // Number of pillars at each z
+    std::vector<double> ringZ;
+    std::vector<int>    ringN;
+    for (unsigned int i=0; i<pillarZ.size(); i++) {
+      if (pillarPhi[i] <= 0.) continue;
+      unsigned int k = std::find(ringZ.begin(), ringZ.end(), pillarZ[i]) -
+		       ringZ.begin();
+      if (k == ringZ.size()) {
+	ringZ.push_back(pillarZ[i]);
+	ringN.push_back(0);
+      }
+      ringN[k]++;
+    }
+    if (ringZ.empty()) continue;
+
+    double area = pillarRout*pillarRout - pillarRin*pillarRin;
+    solid = DDSolidFactory::tubs(DDTrackerNames::ddname(DDTrackerNames::name(name, "Ring"), idNameSpace), 
+				 pillarDz, pillarRin, pillarRout, 0, 
+				 CLHEP::twopi);
+    std::map<int, DDLogicalPart> rings;
+    for (unsigned int k=0; k<ringZ.size(); k++) {
+      if (rings.find(ringN[k]) == rings.end()) {
+	int ringName = DDTrackerNames::name(name, "Ring", ringN[k]);
+	DDTrackerMixture mixture(genMat);
+	mixture.add(pillarMaterial, 2.*pillarDPhi*area*pillarDz, ringN[k]);
+	int mixName  = DDTrackerNames::name(ringName, "Mixture");
+	DDMaterial matring = mixture.make(DDTrackerNames::ddname(mixName, idNameSpace),
+					  2.*CLHEP::pi*area*pillarDz);
+	rings[ringN[k]] = DDLogicalPart(DDTrackerNames::ddname(ringName, idNameSpace),
+					matring, solid);
+      }
+      DDTranslation tran(0., 0., ringZ[k]);
+      cpv.position(rings[ringN[k]], parent(), k+1,
+				    tran, DDRotation());
+      LogDebug("TIBGeom") << "DDTIBLayerAlgo test " << rings[ringN[k]].name()
+			  << " for " << ringN[k] << " pillars positioned in "
+			  << parent().name() << " at " << tran 
+			  << " with no rotation";
+    }
+  }
 }
@@ -23,8 +23,12 @@ class DDTIBLayerAlgo : public DDAlgorithm {
 
 private:
 
+  //Rings standing for the DOHM carriers and the pillars (homogeneous mode)
+  void homogeneousServices(DDCompactView& cpv);
+
   std::string              idNameSpace;    //Namespace of this and ALL parts
   std::string              genMat;         //General material name
+  bool                     homogeneous;    //Supports homogenized or not
   double                   detectorTilt;   //Detector Tilt
   double                   layerL;         //Length of the layer
 
@@ -4,6 +4,7 @@
 ///////////////////////////////////////////////////////////////////////////////
 #include <cmath>
 #include <algorithm>
+#include <sstream>
 
 #include "FWCore/MessageLogger/interface/MessageLogger.h"
 #include "DetectorDescription/Core/interface/DDLogicalPart.h"
@@ -12,9 +13,217 @@
 #include "DetectorDescription/Core/interface/DDCurrentNamespace.h"
 #include "DetectorDescription/Core/interface/DDSplit.h"
 #include "Geometry/TrackerCommonData/plugins/DDTIDModuleAlgo.h"
+#include "Geometry/TrackerCommonData/plugins/DDTrackerSensorTable.h"
 #include "CLHEP/Units/GlobalPhysicalConstants.h"
 #include "CLHEP/Units/GlobalSystemOfUnits.h"
 
+namespace {
+
+  //Outline in the x-z plane of a trap of constant half thickness along y
+  //(bl = tl, no alpha, phi = 0) placed with a rotation about y
+  typedef std::pair<double,double> Point2D;   //(x, z)
+
+  struct Line {                               //x = x0 + dxdz*z
+    double x0, dxdz;
+    double at(double z) const {return x0 + dxdz*z;}
+  };
+
+  struct Slab {                               //Trap piece of an outline
+    double z1, z2;
+    Line   left, right;
+  };
+
+  bool aboutY(const DDRotation & rot) {
+    const DDRotationMatrix* matrix = rot ? rot.rotation() : 0;
+    if (!matrix) return true;
+    double r[9];
+    matrix->GetComponents(r);
+    return (std::abs(r[1]) < 1.e-9 && std::abs(r[3]) < 1.e-9 &&
+	    std::abs(r[5]) < 1.e-9 && std::abs(r[7]) < 1.e-9);
+  }
+
+  std::vector<Point2D> outline(double dz, double theta, double bl1, double bl2,
+			       const DDRotation & rot, const DDTranslation & tran) {
+    double dx = dz*tan(theta);
+    double local[4][2] = {{-dx-bl1, -dz}, {-dx+bl1, -dz}, {dx+bl2, dz},
+			  {dx-bl2, dz}};
+    double r[9] = {1, 0, 0, 0, 1, 0, 0, 0, 1};
+    const DDRotationMatrix* matrix = rot ? rot.rotation() : 0;
+    if (matrix) matrix->GetComponents(r);
+    std::vector<Point2D> result;
+    for (int i=0; i<4; i++)
+      result.push_back(Point2D(r[0]*local[i][0] + r[2]*local[i][1] + tran.x(),
+			       r[6]*local[i][0] + r[8]*local[i][1] + tran.z()));
+    return result;
+  }
+
+  //Sides of a convex outline at height z; false if z is outside
+  bool section(const std::vector<Point2D> & poly, double z, Line & left,
+	       Line & right) {
+    int n = 0;
+    for (unsigned int i=0; i<poly.size(); i++) {
+      const Point2D & a = poly[i];
+      const Point2D & b = poly[(i+1)%poly.size()];
+      if (std::min(a.second, b.second) >= z || std::max(a.second, b.second) <= z)
+	continue;
+      Line edge;
+      edge.dxdz = (b.first-a.first)/(b.second-a.second);
+      edge.x0   = a.first - edge.dxdz*a.second;
+      if (n == 0 || edge.at(z) < left.at(z))  left  = edge;
+      if (n == 0 || edge.at(z) > right.at(z)) right = edge;
+      n++;
+    }
+    return n >= 2;
+  }
+
+  //Heights between which the sides of the outlines are straight
+  std::vector<double> breaks(const std::vector<std::vector<Point2D> > & polys) {
+    std::vector<double> z;
+    std::vector<Line>   lines;
+    for (unsigned int p=0; p<polys.size(); p++) {
+      for (unsigned int i=0; i<polys[p].size(); i++) {
+	const Point2D & a = polys[p][i];
+	const Point2D & b = polys[p][(i+1)%polys[p].size()];
+	z.push_back(a.second);
+	if (a.second == b.second) continue;
+	Line edge;
+	edge.dxdz = (b.first-a.first)/(b.second-a.second);
+	edge.x0   = a.first - edge.dxdz*a.second;
+	lines.push_back(edge);
+      }
+    }
+    for (unsigned int i=0; i<lines.size(); i++)
+      for (unsigned int j=i+1; j<lines.size(); j++)
+	if (lines[i].dxdz != lines[j].dxdz)
+	  z.push_back((lines[j].x0-lines[i].x0)/(lines[i].dxdz-lines[j].dxdz));
+    std::sort(z.begin(), z.end());
+    z.erase(std::unique(z.begin(), z.end()), z.end());
+    return z;
+  }
+
+  //Length at height z of the part of interval [x1, x2] outside the others
+  double remaining(double x1, double x2,
+		   std::vector<std::pair<double,double> > others) {
+    std::sort(others.begin(), others.end());
+    double length = 0, x = x1;
+    for (unsigned int i=0; i<others.size() && x < x2; i++) {
+      if (others[i].first > x) length += std::min(others[i].first, x2) - x;
+      x = std::max(x, others[i].second);
+    }
+    if (x < x2) length += x2 - x;
+    return length;
+  }
+
+  //Pieces of (uncut * cut) - hole, which together with the hole fill
+  //the cut out of the uncut solid
+  std::vector<Slab> cutPieces(const std::vector<Point2D> & uncut,
+			      const std::vector<Point2D> & cut,
+			      const std::vector<Point2D> & hole) {
+    std::vector<std::vector<Point2D> > polys;
+    polys.push_back(uncut);
+    polys.push_back(cut);
+    polys.push_back(hole);
+    std::vector<double> z = breaks(polys);
+    std::vector<Slab> result;
+    for (unsigned int i=0; i+1<z.size(); i++) {
+      if (z[i+1]-z[i] < 1.e-6*mm) continue;
+      double zm = 0.5*(z[i]+z[i+1]);
+      Line uL, uR, cL, cR, hL, hR;
+      if (!section(uncut, zm, uL, uR) || !section(cut, zm, cL, cR)) continue;
+      Slab slab;
+      slab.z1    = z[i];
+      slab.z2    = z[i+1];
+      slab.left  = (uL.at(zm) > cL.at(zm)) ? uL : cL;
+      slab.right = (uR.at(zm) < cR.at(zm)) ? uR : cR;
+      if (slab.right.at(zm) <= slab.left.at(zm)) continue;
+      if (!section(hole, zm, hL, hR)) {
+	result.push_back(slab);
+	continue;
+      }
+      Slab side = slab;
+      if (hL.at(zm) > slab.left.at(zm)) {
+	if (hL.at(zm) < side.right.at(zm)) side.right = hL;
+	result.push_back(side);
+      }
+      side = slab;
+      if (hR.at(zm) < slab.right.at(zm)) {
+	if (hR.at(zm) > side.left.at(zm)) side.left = hR;
+	result.push_back(side);
+      }
+    }
+    return result;
+  }
+
+  //Fills the cut with traps of the general material and compares the
+  //volume left to the kapton with the one of the subtraction solid
+  void fillCut(DDCompactView & cpv, const DDLogicalPart & kapton,
+	       const std::vector<Point2D> & uncut,
+	       const std::vector<Point2D> & cut,
+	       const std::vector<Point2D> & hole, double h1,
+	       const DDMaterial & matter) {
+
+    std::vector<Slab> pieces = cutPieces(uncut, cut, hole);
+    for (unsigned int i=0; i<pieces.size(); i++) {
+      const Slab & p = pieces[i];
+      double dz  = 0.5*(p.z2-p.z1);
+      double bl1 = std::max(0.5*(p.right.at(p.z1)-p.left.at(p.z1)), 1.e-6*mm);
+      double bl2 = std::max(0.5*(p.right.at(p.z2)-p.left.at(p.z2)), 1.e-6*mm);
+      double x1  = 0.5*(p.right.at(p.z1)+p.left.at(p.z1));
+      double x2  = 0.5*(p.right.at(p.z2)+p.left.at(p.z2));
+      double thet = atan((x2-x1)/(2*dz));
+      std::ostringstream name;
+      name << kapton.name().name() << "Cut" << i+1;
+      DDSolid solid = DDSolidFactory::trap(DDName(name.str(), kapton.name().ns()),
+					   dz, thet, 0, h1, bl1, bl1, 0,
+					   h1, bl2, bl2, 0);
+      DDLogicalPart piece(solid.ddname(), matter, solid);
+      DDTranslation tran(0.5*(x1+x2), 0, 0.5*(p.z1+p.z2));
+      cpv.position(piece, kapton, 1, tran, DDRotation());
+      LogDebug("TIDGeom") << "DDTIDModuleAlgo test: " << piece.name()
+			  << " Trap of dimensions " << dz << ", " << thet
+			  << ", 0, " << h1 << ", " << bl1 << ", " << bl1
+			  << ", 0, " << h1 << ", " << bl2 << ", " << bl2
+			  << ", 0 positioned in " << kapton.name() << " at "
+			  << tran;
+    }
+
+    //Kapton left: uncut - cut - hole (subtraction) and uncut - hole -
+    //pieces; the lengths are linear between the breaks
+    std::vector<std::vector<Point2D> > polys;
+    polys.push_back(uncut);
+    polys.push_back(cut);
+    polys.push_back(hole);
+    std::vector<double> z = breaks(polys);
+    double volSub = 0, volTraps = 0;
+    for (unsigned int i=0; i+1<z.size(); i++) {
+      double zm = 0.5*(z[i]+z[i+1]);
+      Line uL, uR, l, r;
+      if (!section(uncut, zm, uL, uR)) continue;
+      std::vector<std::pair<double,double> > sub, traps;
+      if (section(hole, zm, l, r)) {
+	sub.push_back(std::make_pair(l.at(zm), r.at(zm)));
+	traps.push_back(std::make_pair(l.at(zm), r.at(zm)));
+      }
+      if (section(cut, zm, l, r)) sub.push_back(std::make_pair(l.at(zm), r.at(zm)));
+      for (unsigned int k=0; k<pieces.size(); k++)
+	if (pieces[k].z1 <= zm && pieces[k].z2 >= zm)
+	  traps.push_back(std::make_pair(pieces[k].left.at(zm),
+					 pieces[k].right.at(zm)));
+      double dz = (z[i+1]-z[i])*2*h1;
+      volSub   += dz*remaining(uL.at(zm), uR.at(zm), sub);
+      volTraps += dz*remaining(uL.at(zm), uR.at(zm), traps);
+    }
+    LogDebug("TIDGeom") << "DDTIDModuleAlgo test: " << kapton.name()
+			<< " made of traps with " << pieces.size()
+			<< " pieces: kapton volume " << volTraps
+			<< " instead of " << volSub;
+    if (std::abs(volTraps-volSub) > 1.e-6*volSub)
+      edm::LogWarning("TIDGeom") << "DDTIDModuleAlgo: " << kapton.name()
+				 << " made of traps has a kapton volume of "
+				 << volTraps << " instead of " << volSub;
+  }
+}
+
 
 DDTIDModuleAlgo::DDTIDModuleAlgo() {
   LogDebug("TIDGeom") << "DDTIDModuleAlgo info: Creating an instance";
@@ -28,9 +237,21 @@ void DDTIDModuleAlgo::initialize(const DDNumericArguments & nArgs,
 				 const DDStringArguments & sArgs,
 				 const DDStringVectorArguments & vsArgs) {
 
+  DDTIDModuleCommon common;
+  common.read(nArgs, sArgs, vsArgs);
+  initialize(common, nArgs, vArgs, sArgs, vsArgs);
+}
+
+void DDTIDModuleAlgo::initialize(const DDTIDModuleCommon & common,
+				 const DDNumericArguments & nArgs,
+				 const DDVectorArguments & vArgs,
+				 const DDStringArguments & sArgs,
+				 const DDStringVectorArguments & vsArgs) {
+
+  DDTIDModuleCommon::operator=(common);
+
   int i;
   genMat       = sArgs["GeneralMaterial"];
-  detectorN    = (int)(nArgs["DetectorNumber"]);
   DDName parentName = parent().name(); 
 
   LogDebug("TIDGeom") << "DDTIDModuleAlgo debug: Parent " << parentName 
@@ -38,11 +259,6 @@ void DDTIDModuleAlgo::initialize(const DDNumericArguments & nArgs,
 		      << " Detector Planes " << detectorN;
 
   moduleThick       = nArgs["ModuleThick"];
-  detTilt           = nArgs["DetTilt"];
-  fullHeight        = nArgs["FullHeight"];
-  dlTop             = nArgs["DlTop"];
-  dlBottom          = nArgs["DlBottom"];
-  dlHybrid          = nArgs["DlHybrid"];
   std::string comp  = sArgs["DoComponents"];
   if (comp == "No" || comp == "NO" || comp == "no") doComponents = false;
   else                                              doComponents = true;
@@ -53,13 +269,8 @@ void DDTIDModuleAlgo::initialize(const DDNumericArguments & nArgs,
 		      << " dl(Bottom) " << dlBottom << " dl(Hybrid) "
 		      << dlHybrid << " doComponents " << doComponents;
 
-  boxFrameName      = sArgs["BoxFrameName"];
   boxFrameMat       = sArgs["BoxFrameMaterial"];
   boxFrameThick     = nArgs["BoxFrameThick"];
-  boxFrameHeight    = nArgs["BoxFrameHeight"];
-  boxFrameWidth     = nArgs["BoxFrameWidth"];
-  bottomFrameHeight = nArgs["BottomFrameHeight"];
-  bottomFrameOver   = nArgs["BottomFrameOver"];
   LogDebug("TIDGeom") << "DDTIDModuleAlgo debug: " << boxFrameName 
 		      << " Material " << boxFrameMat << " Thickness " 
 		      << boxFrameThick << " width " << boxFrameWidth 
@@ -67,13 +278,8 @@ void DDTIDModuleAlgo::initialize(const DDNumericArguments & nArgs,
 		      << " Extra Height at Bottom " << bottomFrameHeight 
 		      << " Overlap " << bottomFrameOver;
 
-  topFrameHeight    = nArgs["TopFrameHeight"];
-  topFrameOver      = nArgs["TopFrameOver"];
-  sideFrameName     = vsArgs["SideFrameName"];
   sideFrameMat      = sArgs["SideFrameMaterial"];
-  sideFrameWidth    = nArgs["SideFrameWidth"];
   sideFrameThick    = nArgs["SideFrameThick"];
-  sideFrameOver     = nArgs["SideFrameOver"];
   holeFrameName     = vsArgs["HoleFrameName"];
   holeFrameRot      = vsArgs["HoleFrameRotation"];
   for (i = 0; i < detectorN; i++)
@@ -83,12 +289,17 @@ void DDTIDModuleAlgo::initialize(const DDNumericArguments & nArgs,
 			<< " Overlap " << sideFrameOver << " Hole  "
 			<< holeFrameName[i];
 
-  kaptonName     = vsArgs["KaptonName"];
   kaptonMat      = sArgs["KaptonMaterial"];
   kaptonThick    = nArgs["KaptonThick"];
   kaptonOver     = nArgs["KaptonOver"];
   holeKaptonName     = vsArgs["HoleKaptonName"];
   holeKaptonRot      = vsArgs["HoleKaptonRotation"];
+  if (sArgs.find("StereoKaptonSolid") != sArgs.end())
+    kaptonSolid    = sArgs["StereoKaptonSolid"];
+  else
+    kaptonSolid    = "Subtraction";
+  LogDebug("TIDGeom") << "DDTIDModuleAlgo debug : stereo kapton made as "
+		      << kaptonSolid;
   for (i = 0; i < detectorN; i++)
     LogDebug("TIDGeom") << "DDTIDModuleAlgo debug : " << kaptonName[i] 
 			<< " Material " << kaptonMat 
@@ -97,7 +308,6 @@ void DDTIDModuleAlgo::initialize(const DDNumericArguments & nArgs,
 			<< holeKaptonName[i];
 
 
-  waferName         = vsArgs["WaferName"];
   waferMat          = sArgs["WaferMaterial"];
   sideWidthTop      = nArgs["SideWidthTop"];
   sideWidthBottom   = nArgs["SideWidthBottom"];
@@ -122,9 +332,7 @@ void DDTIDModuleAlgo::initialize(const DDNumericArguments & nArgs,
 			<< ",0)\tactiveName[" << i << "] = " << activeName[i]
 			<< " of thickness " << waferThick[i]-backplaneThick[i];
   
-  hybridName        = sArgs["HybridName"];
   hybridMat         = sArgs["HybridMaterial"];
-  hybridHeight      = nArgs["HybridHeight"];
   hybridWidth       = nArgs["HybridWidth"];
   hybridThick       = nArgs["HybridThick"];
   LogDebug("TIDGeom") << "DDTIDModuleAlgo debug: " << hybridName 
@@ -132,9 +340,7 @@ void DDTIDModuleAlgo::initialize(const DDNumericArguments & nArgs,
 		      << hybridHeight << " Width " << hybridWidth 
 		      << " Thickness " << hybridThick;
 
-  pitchName         = vsArgs["PitchName"];
   pitchMat          = sArgs["PitchMaterial"];
-  pitchHeight       = nArgs["PitchHeight"];
   pitchThick        = nArgs["PitchThick"];
   pitchStereoTol    = nArgs["PitchStereoTolerance"];
 
@@ -144,11 +350,8 @@ void DDTIDModuleAlgo::initialize(const DDNumericArguments & nArgs,
   for (i = 0; i < detectorN; i++)
     LogDebug("TIDGeom") <<  "\tpitchName[" << i << "] = " << pitchName[i];
 
-  coolName         = sArgs["CoolInsertName"];
   coolMat          = sArgs["CoolInsertMaterial"];
-  coolHeight       = nArgs["CoolInsertHeight"];
   coolThick        = nArgs["CoolInsertThick"];
-  coolWidth        = nArgs["CoolInsertWidth"];
   LogDebug("TIDGeom") << "DDTIDModuleAlgo debug: Cool Element Material "
 		      << coolMat << " Height " << coolHeight
 		      << " Thickness " << coolThick << " Width " << coolWidth;
@@ -160,6 +363,7 @@ void DDTIDModuleAlgo::execute(DDCompactView& cpv) {
 
   DDName parentName = parent().name(); 
   DDName name;
+  parts_.clear();
 
   double sidfr = sideFrameWidth - sideFrameOver;      // width of side frame on the sides of module 
   double botfr;                                       // width of side frame at the the bottom of the modules 
@@ -225,6 +429,7 @@ void DDTIDModuleAlgo::execute(DDCompactView& cpv) {
 			<< " Box made of " << matname << " of dimensions " 
 			<< dx << ", " << dy << ", " << dz;
     DDLogicalPart boxFrame(solid.ddname(), matter, solid);
+    parts_[boxFrameName] = boxFrame;
 
 
     // Hybrid
@@ -239,6 +444,7 @@ void DDTIDModuleAlgo::execute(DDCompactView& cpv) {
 			<< " Box made of " << matname << " of dimensions " 
 			<< dx << ", " << dy << ", " << dz;
     DDLogicalPart hybrid(solid.ddname(), matter, solid);
+    parts_[hybridName] = hybrid;
 
     // Cool Insert
     name    = DDName(DDSplit(coolName).first, DDSplit(coolName).second);
@@ -252,6 +458,7 @@ void DDTIDModuleAlgo::execute(DDCompactView& cpv) {
 			<< " Box made of " << matname << " of dimensions " 
 			<< dx << ", " << dy << ", " << dz;
     DDLogicalPart cool(solid.ddname(), matter, solid);
+    parts_[coolName] = cool;
 
     // Loop over detectors to be placed
     for (int k = 0; k < detectorN; k++) {
@@ -283,6 +490,7 @@ void DDTIDModuleAlgo::execute(DDCompactView& cpv) {
 			  << bbl1 << ", 0, " << h1 << ", " << bbl2 << ", " 
 			  << bbl2 << ", 0";
       DDLogicalPart sideFrame(solid.ddname(), matter, solid);
+      parts_[sideFrameName[k]] = sideFrame;
 
       std::string rotstr, rotns; 
       DDRotation rot;
@@ -356,19 +564,14 @@ void DDTIDModuleAlgo::execute(DDCompactView& cpv) {
       dz = 0.5 * (kaptonHeight+kaptonExtraHeight);
 
       // For the stereo create the uncut solid, the solid to be removed and then the subtraction solid
+      // (or, with StereoKaptonSolid = Traps, the uncut solid filled later with
+      // traps of the general material where the cut is)
+      std::vector<Point2D> kaptonUncut, kaptonCut;
+      bool kaptonTraps = false;
       if ( k == 1 ) {
-	// Uncut solid
-	std::string kaptonUncutName=kaptonName[k]+"Uncut";
-	name    = DDName(DDSplit(kaptonUncutName).first,
-			 DDSplit(kaptonUncutName).second);
-	solidUncut = DDSolidFactory::trap(name, dz, 0, 0, h1, bbl1, bbl1, 0,
-					  h1,  bbl2, bbl2, 0);
+	double dzUncut = dz, bl1Uncut = bbl1, bl2Uncut = bbl2;
 
 	// Piece to be cut
-	std::string kaptonCutName=kaptonName[k]+"Cut";
-	name    = DDName(DDSplit(kaptonCutName).first,
-			 DDSplit(kaptonCutName).second);	 
-
 	if (dlHybrid > dlTop) {
 	  dz   = 0.5 * dlTop;
 	} else {
@@ -378,8 +581,6 @@ void DDTIDModuleAlgo::execute(DDCompactView& cpv) {
 	bbl1     =  fabs(dz*sin(detTilt));
 	bbl2     =  bbl1*0.000001;
 	double thet = atan((bbl1-bbl2)/(2*dz));	
-	solidCut  = DDSolidFactory::trap(name, dz, thet, 0, h1, bbl1, bbl1, 0,
-					 h1, bbl2, bbl2, 0);
 
 	std::string aRot("tidmodpar:9PYX"); 
 	rotstr  = DDSplit(aRot).first;
@@ -389,11 +590,47 @@ void DDTIDModuleAlgo::execute(DDCompactView& cpv) {
 	xpos = -0.5 * fullHeight * sin(detTilt);
 	zpos = 0.5 * kaptonHeight - bbl2;
 
-	// Subtraction Solid
-	name   = DDName(DDSplit(kaptonName[k]).first,
-			DDSplit(kaptonName[k]).second);  
-	solid  = DDSolidFactory::subtraction(name, solidUncut, solidCut, 
-					     DDTranslation(xpos,0.0,zpos),rot);
+	kaptonTraps = (kaptonSolid == "Traps");
+	DDRotation holeRot;
+	if (DDSplit(holeKaptonRot[k]).first != "NULL")
+	  holeRot = DDRotation(DDName(DDSplit(holeKaptonRot[k]).first,
+				      DDSplit(holeKaptonRot[k]).second));
+	if (kaptonTraps && !(aboutY(rot) && aboutY(holeRot))) {
+	  edm::LogWarning("TIDGeom") << "DDTIDModuleAlgo: " << kaptonName[k]
+				     << " cut or hole not rotated about y: "
+				     << "made as a subtraction solid";
+	  kaptonTraps = false;
+	}
+	if (kaptonTraps) {
+	  kaptonUncut = outline(dzUncut, 0, bl1Uncut, bl2Uncut, DDRotation(),
+				DDTranslation());
+	  kaptonCut   = outline(dz, thet, bbl1, bbl2, rot,
+				DDTranslation(xpos,0.0,zpos));
+	  name   = DDName(DDSplit(kaptonName[k]).first,
+			  DDSplit(kaptonName[k]).second);
+	  solid  = DDSolidFactory::trap(name, dzUncut, 0, 0, h1, bl1Uncut,
+					bl1Uncut, 0, h1, bl2Uncut, bl2Uncut, 0);
+	} else {
+	  // Uncut solid
+	  std::string kaptonUncutName=kaptonName[k]+"Uncut";
+	  name    = DDName(DDSplit(kaptonUncutName).first,
+			   DDSplit(kaptonUncutName).second);
+	  solidUncut = DDSolidFactory::trap(name, dzUncut, 0, 0, h1, bl1Uncut,
+					    bl1Uncut, 0, h1, bl2Uncut,
+					    bl2Uncut, 0);
+
+	  std::string kaptonCutName=kaptonName[k]+"Cut";
+	  name    = DDName(DDSplit(kaptonCutName).first,
+			   DDSplit(kaptonCutName).second);	 
+	  solidCut  = DDSolidFactory::trap(name, dz, thet, 0, h1, bbl1, bbl1, 0,
+					   h1, bbl2, bbl2, 0);
+
+	  // Subtraction Solid
+	  name   = DDName(DDSplit(kaptonName[k]).first,
+			  DDSplit(kaptonName[k]).second);  
+	  solid  = DDSolidFactory::subtraction(name, solidUncut, solidCut, 
+					       DDTranslation(xpos,0.0,zpos),rot);
+	}
       } else {
 	name   = DDName(DDSplit(kaptonName[k]).first,
 			DDSplit(kaptonName[k]).second);
@@ -402,6 +639,7 @@ void DDTIDModuleAlgo::execute(DDCompactView& cpv) {
       }
 
       DDLogicalPart kapton(solid.ddname(), matter, solid);         
+      parts_[kaptonName[k]] = kapton;
       LogDebug("TIDGeom") << "DDTIDModuleAlgo test:\t" << solid.name() 
 			  << " SUBTRACTION SOLID Trap made of " << matname 
 			  << " of dimensions " << dz << ", 0, 0, " << h1 
@@ -452,6 +690,10 @@ void DDTIDModuleAlgo::execute(DDCompactView& cpv) {
       LogDebug("TIDGeom") << "DDTIDModuleAlgo test: " << holeKapton.name() 
 			  << " number 1 positioned in " << kapton.name()
 			  << " at (0,0," << zpos << ") with no rotation";
+      if (kaptonTraps)
+	fillCut(cpv, kapton, kaptonUncut, kaptonCut,
+		outline(dz, 0, bbl1, bbl2, rot, DDTranslation(xpos,0.0,zpos)),
+		h1, matter);
 
 
 
@@ -476,6 +718,7 @@ void DDTIDModuleAlgo::execute(DDCompactView& cpv) {
 			  << bl1 << ", 0, " << h1 << ", " << bl2 << ", "
 			  << bl2 << ", 0";
       DDLogicalPart wafer(solid.ddname(), matter, solid);
+      parts_[waferName[k]] = wafer;
 
       // Active
       name    = DDName(DDSplit(activeName[k]).first,
@@ -499,6 +742,7 @@ void DDTIDModuleAlgo::execute(DDCompactView& cpv) {
 			  << bl1 << ", 0, " << h1 << ", " << bl2 << ", "
 			  << bl1 << ", 0";
       DDLogicalPart active(solid.ddname(), matter, solid);
+      DDTrackerSensorTable::instance().defineSensor(active);
       rotstr = DDSplit(activeRot).first;
       if (rotstr != "NULL") {
 	rotns = DDSplit(activeRot).second;
@@ -550,6 +794,7 @@ void DDTIDModuleAlgo::execute(DDCompactView& cpv) {
 			    << ", 0";
       }
       DDLogicalPart pa(solid.ddname(), matter, solid);
+      parts_[pitchName[k]] = pa;
     }
   }
   LogDebug("TIDGeom") << "<<== End of DDTIDModuleAlgo construction ...";
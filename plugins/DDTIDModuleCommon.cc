@@ -0,0 +1,57 @@
+///////////////////////////////////////////////////////////////////////////////
+// File: DDTIDModuleCommon.cc
+// Description: Arguments shared by the TID module algorithms
+///////////////////////////////////////////////////////////////////////////////
+
+#include "FWCore/MessageLogger/interface/MessageLogger.h"
+#include "Geometry/TrackerCommonData/plugins/DDTIDModuleCommon.h"
+#include "CLHEP/Units/GlobalSystemOfUnits.h"
+
+void DDTIDModuleCommon::read(const DDNumericArguments & nArgs,
+			     const DDStringArguments & sArgs,
+			     const DDStringVectorArguments & vsArgs) {
+
+  detectorN         = (int)(nArgs["DetectorNumber"]);
+  detTilt           = nArgs["DetTilt"];
+  fullHeight        = nArgs["FullHeight"];
+  dlTop             = nArgs["DlTop"];
+  dlBottom          = nArgs["DlBottom"];
+  dlHybrid          = nArgs["DlHybrid"];
+  LogDebug("TIDGeom") << "DDTIDModuleCommon debug: Detector Planes "
+		      << detectorN << " Detector Tilt " << detTilt/CLHEP::deg
+		      << " Height " << fullHeight << " dl(Top) " << dlTop
+		      << " dl(Bottom) " << dlBottom << " dl(Hybrid) "
+		      << dlHybrid;
+
+  boxFrameName      = sArgs["BoxFrameName"];
+  boxFrameHeight    = nArgs["BoxFrameHeight"];
+  boxFrameWidth     = nArgs["BoxFrameWidth"];
+  bottomFrameHeight = nArgs["BottomFrameHeight"];
+  bottomFrameOver   = nArgs["BottomFrameOver"];
+  topFrameHeight    = nArgs["TopFrameHeight"];
+  topFrameOver      = nArgs["TopFrameOver"];
+  sideFrameName     = vsArgs["SideFrameName"];
+  sideFrameWidth    = nArgs["SideFrameWidth"];
+  sideFrameOver     = nArgs["SideFrameOver"];
+  LogDebug("TIDGeom") << "DDTIDModuleCommon debug: " << boxFrameName
+		      << " width " << boxFrameWidth << " height "
+		      << boxFrameHeight << " Extra Height at Bottom "
+		      << bottomFrameHeight << " Overlap " << bottomFrameOver
+		      << " Top " << topFrameHeight << " Overlap "
+		      << topFrameOver << " Side Frame Width "
+		      << sideFrameWidth << " Overlap " << sideFrameOver;
+
+  kaptonName        = vsArgs["KaptonName"];
+  waferName         = vsArgs["WaferName"];
+  hybridName        = sArgs["HybridName"];
+  hybridHeight      = nArgs["HybridHeight"];
+  pitchName         = vsArgs["PitchName"];
+  pitchHeight       = nArgs["PitchHeight"];
+  coolName          = sArgs["CoolInsertName"];
+  coolHeight        = nArgs["CoolInsertHeight"];
+  coolWidth         = nArgs["CoolInsertWidth"];
+  LogDebug("TIDGeom") << "DDTIDModuleCommon debug: " << hybridName
+		      << " Height " << hybridHeight << " Pitch Adapter Height "
+		      << pitchHeight << " " << coolName << " Height "
+		      << coolHeight << " Width " << coolWidth;
+}
@@ -0,0 +1,52 @@
+#ifndef DD_TIDModuleCommon_h
+#define DD_TIDModuleCommon_h
+
+/*
+
+  Arguments shared by DDTIDModuleAlgo and DDTIDModulePosAlgo: the shape
+  of the module and the names and heights of the components, which the
+  first makes and the second positions. Both algorithms inherit them;
+  DDTIDModuleFullAlgo reads them once and gives them to both.
+
+*/
+
+#include <string>
+#include <vector>
+#include "DetectorDescription/Base/interface/DDTypes.h"
+
+struct DDTIDModuleCommon {
+
+  void read(const DDNumericArguments & nArgs,
+	    const DDStringArguments & sArgs,
+	    const DDStringVectorArguments & vsArgs);
+
+  int                      detectorN;         //Detector planes
+  double                   detTilt;           //Tilt of stereo detector
+  double                   fullHeight;        //Height 
+  double                   dlTop;             //Width at top of wafer
+  double                   dlBottom;          //Width at bottom of wafer
+  double                   dlHybrid;          //Width at the hybrid end
+
+  std::string              boxFrameName;      //Top frame     name
+  double                   boxFrameHeight;    //              height  
+  double                   boxFrameWidth;     //              extra width
+  double                   bottomFrameHeight; //Bottom of the frame
+  double                   bottomFrameOver;   //              overlap
+  double                   topFrameHeight;    //Top    of the frame
+  double                   topFrameOver;      //              overlap
+  std::vector<std::string> sideFrameName;     //Side frame    name
+  double                   sideFrameWidth;    //              width
+  double                   sideFrameOver;     //              overlap (wrt wafer)
+
+  std::vector<std::string> kaptonName;        //Kapton circuit name
+  std::vector<std::string> waferName;         //Wafer         name
+  std::string              hybridName;        //Hybrid        name
+  double                   hybridHeight;      //              height
+  std::vector<std::string> pitchName;         //Pitch adapter name
+  double                   pitchHeight;       //              height
+  std::string              coolName;          //Cool insert   name
+  double                   coolHeight;        //              height
+  double                   coolWidth;         //              width
+};
+
+#endif
@@ -0,0 +1,45 @@
+///////////////////////////////////////////////////////////////////////////////
+// File: DDTIDModuleFullAlgo.cc
+// Description: Creation of a TID Module and positioning of its components
+///////////////////////////////////////////////////////////////////////////////
+
+#include "FWCore/MessageLogger/interface/MessageLogger.h"
+#include "Geometry/TrackerCommonData/plugins/DDTIDModuleFullAlgo.h"
+#include "CLHEP/Units/GlobalSystemOfUnits.h"
+
+
+DDTIDModuleFullAlgo::DDTIDModuleFullAlgo() {
+  LogDebug("TIDGeom") << "DDTIDModuleFullAlgo info: Creating an instance";
+}
+
+DDTIDModuleFullAlgo::~DDTIDModuleFullAlgo() {}
+
+void DDTIDModuleFullAlgo::initialize(const DDNumericArguments & nArgs,
+				     const DDVectorArguments & vArgs,
+				     const DDMapArguments & ,
+				     const DDStringArguments & sArgs,
+				     const DDStringVectorArguments & vsArgs) {
+
+  module.setParent(parent());
+  position.setParent(parent());
+  DDTIDModuleCommon common;
+  common.read(nArgs, sArgs, vsArgs);
+  module.initialize(common, nArgs, vArgs, sArgs, vsArgs);
+
+  if (nArgs.find("PositionTilt") != nArgs.end()) {
+    common.detTilt = nArgs["PositionTilt"];
+    LogDebug("TIDGeom") << "DDTIDModuleFullAlgo debug: " << parent().name()
+			<< " components positioned with tilt "
+			<< common.detTilt/CLHEP::deg;
+  }
+  position.initialize(common, nArgs, vArgs, sArgs, vsArgs);
+  position.setParts(&module.parts());
+}
+
+void DDTIDModuleFullAlgo::execute(DDCompactView& cpv) {
+
+  LogDebug("TIDGeom") << "==>> Constructing DDTIDModuleFullAlgo...";
+  module.execute(cpv);
+  position.execute(cpv);
+  LogDebug("TIDGeom") << "<<== End of DDTIDModuleFullAlgo construction ...";
+}
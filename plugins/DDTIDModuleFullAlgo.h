@@ -0,0 +1,53 @@
+#ifndef DD_TIDModuleFullAlgo_h
+#define DD_TIDModuleFullAlgo_h
+
+/*
+
+  Makes the contents of a TID module and positions them in one
+  invocation: the arguments are those of DDTIDModuleAlgo and of
+  DDTIDModulePosAlgo together, each given once; those they share
+  (DDTIDModuleCommon) are read once for both, and the components made
+  are positioned as they are, without looking them up by name again.
+  The positions of the stereo detector may use a tilt of the opposite
+  sign (PositionTilt, DetTilt if not given).
+
+== Example of use : ==
+
+<Algorithm name="track:DDTIDModuleFullAlgo">
+  <rParent name="tidmodule2:TIDModule2"/>
+  <Numeric name="DetectorNumber" value="1"/>
+  <Numeric name="DetTilt"        value="[tidmodpar:DetTilt]"/>
+  ... arguments of DDTIDModuleAlgo and DDTIDModulePosAlgo ...
+</Algorithm>
+
+*/
+
+#include <map>
+#include <string>
+#include <vector>
+#include "DetectorDescription/Base/interface/DDTypes.h"
+#include "DetectorDescription/Algorithm/interface/DDAlgorithm.h"
+#include "Geometry/TrackerCommonData/plugins/DDTIDModuleAlgo.h"
+#include "Geometry/TrackerCommonData/plugins/DDTIDModulePosAlgo.h"
+
+class DDTIDModuleFullAlgo : public DDAlgorithm {
+ public:
+  //Constructor and Destructor
+  DDTIDModuleFullAlgo(); 
+  virtual ~DDTIDModuleFullAlgo();
+  
+  void initialize(const DDNumericArguments & nArgs,
+                  const DDVectorArguments & vArgs,
+                  const DDMapArguments & mArgs,
+                  const DDStringArguments & sArgs,
+                  const DDStringVectorArguments & vsArgs);
+
+  void execute(DDCompactView& cpv);
+
+private:
+
+  DDTIDModuleAlgo          module;            //Makes the components
+  DDTIDModulePosAlgo       position;          //Positions them
+};
+
+#endif
@@ -15,7 +15,7 @@
 #include "CLHEP/Units/GlobalSystemOfUnits.h"
 
 
-DDTIDModulePosAlgo::DDTIDModulePosAlgo() {
+DDTIDModulePosAlgo::DDTIDModulePosAlgo() : parts_(0) {
   LogDebug("TIDGeom") << "DDTIDModulePosAlgo info: Creating an instance";
 }
 
@@ -27,32 +27,31 @@ void DDTIDModulePosAlgo::initialize(const DDNumericArguments & nArgs,
 				    const DDStringArguments & sArgs,
 				    const DDStringVectorArguments & vsArgs) {
 
+  DDTIDModuleCommon common;
+  common.read(nArgs, sArgs, vsArgs);
+  initialize(common, nArgs, vArgs, sArgs, vsArgs);
+}
+
+void DDTIDModulePosAlgo::initialize(const DDTIDModuleCommon & common,
+				    const DDNumericArguments & nArgs,
+				    const DDVectorArguments & vArgs,
+				    const DDStringArguments & sArgs,
+				    const DDStringVectorArguments & vsArgs) {
+
+  DDTIDModuleCommon::operator=(common);
+
   int i;
   DDName parentName = parent().name(); 
-  detectorN         = (int)(nArgs["DetectorNumber"]);
 
   LogDebug("TIDGeom") << "DDTIDModulePosAlgo debug: Parent " << parentName
 		      << " Detector Planes " << detectorN;
 
-  detTilt           = nArgs["DetTilt"];
-  fullHeight        = nArgs["FullHeight"];
-  dlTop             = nArgs["DlTop"];
-  dlBottom          = nArgs["DlBottom"];
-  dlHybrid          = nArgs["DlHybrid"];
-
   LogDebug("TIDGeom") << "DDTIDModulePosAlgo debug: Detector Tilt " 
 		      << detTilt/CLHEP::deg << " Height " << fullHeight 
 		      << " dl(Top) " << dlTop << " dl(Bottom) " << dlBottom
 		      << " dl(Hybrid) " << dlHybrid;
 
-  boxFrameName      = sArgs["BoxFrameName"];
-  boxFrameHeight    = nArgs["BoxFrameHeight"];
-  boxFrameWidth     = nArgs["BoxFrameWidth"];
   boxFrameZ         = vArgs["BoxFrameZ"];
-  bottomFrameHeight = nArgs["BottomFrameHeight"];
-  bottomFrameOver   = nArgs["BottomFrameOver"];
-  topFrameHeight    = nArgs["TopFrameHeight"];
-  topFrameOver      = nArgs["TopFrameOver"];
   LogDebug("TIDGeom") << "DDTIDModulePosAlgo debug: " << boxFrameName 
 		      << " positioned at Z";
   for (i = 0; i < detectorN; i++)
@@ -60,17 +59,13 @@ void DDTIDModulePosAlgo::initialize(const DDNumericArguments & nArgs,
   LogDebug("TIDGeom") << "\t Extra Height at Bottom " << bottomFrameHeight
 		      << " Overlap " <<bottomFrameOver;
 
-  sideFrameName     = vsArgs["SideFrameName"];
   sideFrameZ        = vArgs["SideFrameZ"];
   sideFrameRot      =vsArgs["SideFrameRotation"];
-  sideFrameWidth    = nArgs["SideFrameWidth"];
-  sideFrameOver     = nArgs["SideFrameOver"];
   for (i = 0; i < detectorN; i++)
     LogDebug("TIDGeom") << "\tsideFrame[" << i << "] = " << sideFrameName[i]
 			<< " positioned at Z "<< sideFrameZ[i]
 			<< " with rotation " << sideFrameRot[i];
 
-  kaptonName     = vsArgs["KaptonName"];
   kaptonZ        = vArgs["KaptonZ"];
   kaptonRot      =vsArgs["KaptonRotation"];
   for (i = 0; i < detectorN; i++)
@@ -78,7 +73,6 @@ void DDTIDModulePosAlgo::initialize(const DDNumericArguments & nArgs,
 			<< " positioned at Z "<< kaptonZ[i]
 			<< " with rotation " << kaptonRot[i];
 
-  waferName         =vsArgs["WaferName"];
   waferZ            = vArgs["WaferZ"];
   waferRot          =vsArgs["WaferRotation"];
   for (i = 0; i < detectorN; i++)
@@ -86,16 +80,12 @@ void DDTIDModulePosAlgo::initialize(const DDNumericArguments & nArgs,
 			<< " positioned at Z " << waferZ[i] 
 			<< " with rotation " << waferRot[i];
 
-  hybridName        = sArgs["HybridName"];
-  hybridHeight      = nArgs["HybridHeight"];
   hybridZ           = vArgs["HybridZ"];
   LogDebug("TIDGeom") << "DDTIDModulePosAlgo debug: " << hybridName 
 		      << " Height " << hybridHeight << " Z";
   for (i = 0; i < detectorN; i++)
     LogDebug("TIDGeom") << "\thybridZ[" << i <<"] = " << hybridZ[i];
 
-  pitchName         =vsArgs["PitchName"];
-  pitchHeight       = nArgs["PitchHeight"];
   pitchZ            = vArgs["PitchZ"];
   pitchRot          =vsArgs["PitchRotation"];
   LogDebug("TIDGeom") << "DDTIDModulePosAlgo debug: Pitch Adapter Height " 
@@ -105,10 +95,7 @@ void DDTIDModulePosAlgo::initialize(const DDNumericArguments & nArgs,
 			<< " position at Z " << pitchZ[i] 
 			<< " with rotation " << pitchRot[i];
 
-  coolName         = sArgs["CoolInsertName"];
-  coolHeight       = nArgs["CoolInsertHeight"];
   coolZ            = nArgs["CoolInsertZ"];
-  coolWidth        = nArgs["CoolInsertWidth"];
   coolRadShift     = vArgs["CoolInsertShift"];
 
   std::string comp  = sArgs["DoSpacers"];
@@ -126,12 +113,21 @@ void DDTIDModulePosAlgo::initialize(const DDNumericArguments & nArgs,
 
 }
 
+DDLogicalPart DDTIDModulePosAlgo::part(const std::string & name) const {
+
+  if (parts_) {
+    std::map<std::string, DDLogicalPart>::const_iterator it = parts_->find(name);
+    if (it != parts_->end()) return it->second;
+  }
+  return DDLogicalPart(DDName(DDSplit(name).first, DDSplit(name).second));
+}
+
 void DDTIDModulePosAlgo::execute(DDCompactView& cpv) {
   
   LogDebug("TIDGeom") << "==>> Constructing DDTIDModulePosAlgo...";
 
   DDName parentName  = parent().name(); 
-  DDName name;
+  DDLogicalPart child;
 
   double botfr;                                       // width of side frame at the the bottom of the modules 
   double topfr;                                       // width of side frame at the the top of the modules 
@@ -176,7 +172,7 @@ void DDTIDModulePosAlgo::execute(DDCompactView& cpv) {
   double xpos=0; double ypos=0; double zpos=0;
 
   // Cool Inserts
-  name = DDName(DDSplit(coolName).first, DDSplit(coolName).second);
+  child = part(coolName);
   ypos = coolZ;
 
   double zCool;
@@ -202,8 +198,8 @@ void DDTIDModulePosAlgo::execute(DDCompactView& cpv) {
     zpos = zCool-zCenter;
     for ( int j2=0; j2<2; j2++) {
       copy++;
-     cpv.position(name, parentName, copy,  DDTranslation(xpos,ypos,zpos), rot);
-      LogDebug("TIDGeom") << "DDTIDModulePosAlgo test: " << name <<" number "
+     cpv.position(child, parent(), copy,  DDTranslation(xpos,ypos,zpos), rot);
+      LogDebug("TIDGeom") << "DDTIDModulePosAlgo test: " << child.name() <<" number "
 			  << copy << " positioned in " << parentName << " at "
 			  << DDTranslation(xpos,ypos,zpos) << " with " << rot;
       xpos = -xpos;
@@ -213,7 +209,7 @@ void DDTIDModulePosAlgo::execute(DDCompactView& cpv) {
 
   if ( doSpacers ) {
   // Bottom Spacers (Alumina)
-    name = DDName(DDSplit(botSpacersName).first, DDSplit(botSpacersName).second);
+    child = part(botSpacersName);
     ypos = botSpacersZ;
 
     double zBotSpacers;
@@ -224,15 +220,14 @@ void DDTIDModulePosAlgo::execute(DDCompactView& cpv) {
     }
     zpos = zBotSpacers - zCenter; 
     rot = DDRotation();
-   cpv.position(name, parentName, 1,  DDTranslation(0.0,ypos,zpos), rot );
-    LogDebug("TIDGeom") << "DDTIDModulePosAlgo test: " << name <<" number "
+   cpv.position(child, parent(), 1,  DDTranslation(0.0,ypos,zpos), rot );
+    LogDebug("TIDGeom") << "DDTIDModulePosAlgo test: " << child.name() <<" number "
 			<< 1 << " positioned in " << parentName << " at "
 			<< DDTranslation(0.0,ypos,zpos) << " with no rotation";       	
 
     
     // Side Spacers (Alumina)
-    name = DDName(DDSplit(sidSpacersName).first, 
-		  DDSplit(sidSpacersName).second);
+    child = part(sidSpacersName);
     ypos = sidSpacersZ;
 
     double zSideSpacers;
@@ -265,8 +260,8 @@ void DDTIDModulePosAlgo::execute(DDCompactView& cpv) {
 		    phix, thetay, phiy, thetaz, phiz);
       }
 
-     cpv.position(name, parentName, copy,  DDTranslation(xpos,ypos,zpos), rot);
-      LogDebug("TIDGeom") << "DDTIDModulePosAlgo test: " << name <<" number "
+     cpv.position(child, parent(), copy,  DDTranslation(xpos,ypos,zpos), rot);
+      LogDebug("TIDGeom") << "DDTIDModulePosAlgo test: " << child.name() <<" number "
 			  << copy << " positioned in " << parentName << " at "
 			  << DDTranslation(xpos,ypos,zpos) << " with " << rot;
       xpos = -xpos;
@@ -277,7 +272,7 @@ void DDTIDModulePosAlgo::execute(DDCompactView& cpv) {
   // Loop over detectors to be placed
   for (int k = 0; k < detectorN; k++) {
     // Wafer
-    name = DDName(DDSplit(waferName[k]).first, DDSplit(waferName[k]).second);
+    child = part(waferName[k]);
     xpos=0; 
     zpos=0; 
     ypos = waferZ[k];
@@ -295,13 +290,13 @@ void DDTIDModulePosAlgo::execute(DDCompactView& cpv) {
       rotns = DDSplit(waferRot[k]).second;
       rot   = DDRotation(DDName(rotstr, rotns));
     }
-   cpv.position(name, parentName, k+1, tran, rot);
-    LogDebug("TIDGeom") << "DDTIDModulePosAlgo test: " << name <<" number "
+   cpv.position(child, parent(), k+1, tran, rot);
+    LogDebug("TIDGeom") << "DDTIDModulePosAlgo test: " << child.name() <<" number "
 			<< k+1 << " positioned in " << parentName << " at "
 			<< tran << " with " << rot;
 
     //Pitch Adapter
-    name = DDName(DDSplit(pitchName[k]).first, DDSplit(pitchName[k]).second);
+    child = part(pitchName[k]);
     if (k == 0) {
       xpos = 0;
     } else {
@@ -323,13 +318,13 @@ void DDTIDModulePosAlgo::execute(DDCompactView& cpv) {
       rot     = DDRotation();
     }
     tran = DDTranslation(xpos,ypos,zpos);
-   cpv.position(name, parentName, k+1, tran, rot);
-    LogDebug("TIDGeom") << "DDTIDModulePosAlgo test: " << name <<" number "
+   cpv.position(child, parent(), k+1, tran, rot);
+    LogDebug("TIDGeom") << "DDTIDModulePosAlgo test: " << child.name() <<" number "
 			<< k+1 << " positioned in " << parentName << " at "
 			<< tran << " with " << rot;
 
     // Hybrid 
-    name = DDName(DDSplit(hybridName).first, DDSplit(hybridName).second);
+    child = part(hybridName);
     ypos = hybridZ[k];
     double zHybrid;
     if (dlHybrid > dlTop) {
@@ -340,14 +335,14 @@ void DDTIDModulePosAlgo::execute(DDCompactView& cpv) {
     zpos = zHybrid - zCenter;
     tran = DDTranslation(0,ypos,zpos);
     rot  = DDRotation();
-   cpv.position(name, parentName, k+1, tran, rot);
-    LogDebug("TIDGeom") << "DDTIDModulePosAlgo test: " << name <<" number "
+   cpv.position(child, parent(), k+1, tran, rot);
+    LogDebug("TIDGeom") << "DDTIDModulePosAlgo test: " << child.name() <<" number "
 			<< k+1 << " positioned in " << parentName << " at "
 			<< tran << " with " << rot;
 
 
     // Box frame
-    name = DDName(DDSplit(boxFrameName).first, DDSplit(boxFrameName).second);
+    child = part(boxFrameName);
     ypos = boxFrameZ[k];
     double zBoxFrame;
     if (dlHybrid > dlTop) {
@@ -358,14 +353,13 @@ void DDTIDModulePosAlgo::execute(DDCompactView& cpv) {
     zpos = zBoxFrame - zCenter;
     tran = DDTranslation(0,ypos,zpos);
     rot  = DDRotation();
-   cpv.position(name, parentName, k+1, tran, rot);
-    LogDebug("TIDGeom") << "DDTIDModulePosAlgo test: " << name <<" number "
+   cpv.position(child, parent(), k+1, tran, rot);
+    LogDebug("TIDGeom") << "DDTIDModulePosAlgo test: " << child.name() <<" number "
 			<< k+1 << " positioned in " << parentName << " at "
 			<< tran << " with " << rot;
 
     // Side frame
-    name = DDName(DDSplit(sideFrameName[k]).first, 
-		  DDSplit(sideFrameName[k]).second);
+    child = part(sideFrameName[k]);
     ypos = sideFrameZ[k];
     double zSideFrame;
     if (dlHybrid > dlTop) {
@@ -382,14 +376,14 @@ void DDTIDModulePosAlgo::execute(DDCompactView& cpv) {
       rot     = DDRotation();
     }  
     tran = DDTranslation(0,ypos,zpos);
-   cpv.position(name, parentName, k+1, tran, rot);
-    LogDebug("TIDGeom") << "DDTIDModulePosAlgo test: " << name <<" number "
+   cpv.position(child, parent(), k+1, tran, rot);
+    LogDebug("TIDGeom") << "DDTIDModulePosAlgo test: " << child.name() <<" number "
 			<< k+1 << " positioned in " << parentName << " at "
 			<< tran << " with " << rot;
 
 
     // Kapton circuit
-    name = DDName(DDSplit(kaptonName[k]).first, DDSplit(kaptonName[k]).second);
+    child = part(kaptonName[k]);
     ypos = kaptonZ[k];
     double zKapton;
     double kaptonExtraHeight=0;
@@ -411,8 +405,8 @@ void DDTIDModulePosAlgo::execute(DDCompactView& cpv) {
       rot     = DDRotation();
     }  
     tran = DDTranslation(0,ypos,zpos);
-   cpv.position(name, parentName, k+1, tran, rot);
-    LogDebug("TIDGeom") << "DDTIDModulePosAlgo test: " << name <<" number "
+   cpv.position(child, parent(), k+1, tran, rot);
+    LogDebug("TIDGeom") << "DDTIDModulePosAlgo test: " << child.name() <<" number "
 			<< k+1 << " positioned in " << parentName << " at "
 			<< tran << " with " << rot;
   }
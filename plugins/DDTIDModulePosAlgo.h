@@ -5,9 +5,11 @@
 #include <string>
 #include <vector>
 #include "DetectorDescription/Base/interface/DDTypes.h"
+#include "DetectorDescription/Core/interface/DDLogicalPart.h"
 #include "DetectorDescription/Algorithm/interface/DDAlgorithm.h"
+#include "Geometry/TrackerCommonData/plugins/DDTIDModuleCommon.h"
 
-class DDTIDModulePosAlgo : public DDAlgorithm {
+class DDTIDModulePosAlgo : public DDAlgorithm, private DDTIDModuleCommon {
  public:
   //Constructor and Destructor
   DDTIDModulePosAlgo(); 
@@ -18,48 +20,35 @@ class DDTIDModulePosAlgo : public DDAlgorithm {
                   const DDMapArguments & mArgs,
                   const DDStringArguments & sArgs,
                   const DDStringVectorArguments & vsArgs);
+  //Same with the shared arguments already read
+  void initialize(const DDTIDModuleCommon & common,
+                  const DDNumericArguments & nArgs,
+                  const DDVectorArguments & vArgs,
+                  const DDStringArguments & sArgs,
+                  const DDStringVectorArguments & vsArgs);
   void execute(DDCompactView& cpv);
 
+  //Components already at hand (by argument name), used instead of
+  //looking them up by name
+  void setParts(const std::map<std::string, DDLogicalPart> * parts) {parts_ = parts;}
+
 private:
 
-  int                      detectorN;         //Number of detectors
-  double                   detTilt;           //Tilt of stereo detector
-  double                   fullHeight;        //Height 
-  std::string              boxFrameName;      //Top frame Name
-  double                   boxFrameHeight;    //          height 
-  double                   boxFrameWidth;     //          width
-  double                   dlTop;             //Width at top of wafer
-  double                   dlBottom;          //Width at bottom of wafer
-  double                   dlHybrid;          //Width at the hybrid end
-  std::vector<double>      boxFrameZ;         //              z-positions
-  double                   bottomFrameHeight; //Bottom of the frame
-  double                   bottomFrameOver;   //              overlap
-  double                   topFrameHeight;    //Top    of the frame
-  double                   topFrameOver;      //              overlap 
+  DDLogicalPart part(const std::string & name) const;
+
+  std::vector<double>      boxFrameZ;         //Top frame     z-positions
 
-  std::vector<std::string> sideFrameName;     //Side Frame    name
-  std::vector<double>      sideFrameZ;        //              z-positions
+  std::vector<double>      sideFrameZ;        //Side frame    z-positions
   std::vector<std::string> sideFrameRot;      //              rotation matrix (required for correct positiong of the hole in the StereoR)
-  double                   sideFrameWidth;    //              width
-  double                   sideFrameOver;     //              overlap (wrt wafer)
 
-  std::vector<std::string> kaptonName;         //Kapton Circuit    name
-  std::vector<double>      kaptonZ;           //              z-positions
+  std::vector<double>      kaptonZ;           //Kapton circuit z-positions
   std::vector<std::string> kaptonRot;         //              rotation matrix (required for correct positiong of the hole in the StereoR)
-  std::vector<std::string> waferName;         //Wafer         name
-  std::vector<double>      waferZ;            //              z-positions
+  std::vector<double>      waferZ;            //Wafer         z-positions
   std::vector<std::string> waferRot;          //              rotation matrix
-  std::string              hybridName;        //Hybrid        name
-  double                   hybridHeight;      //              height
-  std::vector<double>      hybridZ;           //              z-positions
-  std::vector<std::string> pitchName;         //Pitch adapter rotation matrix
-  double                   pitchHeight;       //              height
-  std::vector<double>      pitchZ;            //              z-positions
+  std::vector<double>      hybridZ;           //Hybrid        z-positions
+  std::vector<double>      pitchZ;            //Pitch adapter z-positions
   std::vector<std::string> pitchRot;          //              rotation matrix
-  std::string              coolName;        //Cool Insert   name
-  double                   coolHeight;      //              height
-  double                   coolZ;           //              z-position
-  double                   coolWidth;       //              width
+  double                   coolZ;           //Cool insert   z-position
   std::vector<double>      coolRadShift;    //              
 
 
@@ -72,6 +61,8 @@ private:
   double sidSpacersZ;           //              z-position
   double sidSpacersWidth;       //              width
   double sidSpacersRadShift;    //              
+
+  const std::map<std::string, DDLogicalPart> * parts_;
 };
 
 #endif
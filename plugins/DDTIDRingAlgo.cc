@@ -13,6 +13,7 @@
 #include "DetectorDescription/Core/interface/DDCurrentNamespace.h"
 #include "DetectorDescription/Core/interface/DDSplit.h"
 #include "Geometry/TrackerCommonData/plugins/DDTIDRingAlgo.h"
+#include "Geometry/TrackerCommonData/plugins/DDTrackerEnvelopeCheck.h"
 #include "CLHEP/Units/GlobalPhysicalConstants.h"
 #include "CLHEP/Units/GlobalSystemOfUnits.h"
 
@@ -61,29 +62,29 @@ void DDTIDRingAlgo::execute(DDCompactView& cpv) {
   double dphi  = CLHEP::twopi/number;
 
   DDName mother = parent().name();
-  DDName module;
   DDName icc(DDSplit(iccName).first, DDSplit(iccName).second);
+  std::vector<DDName> modules;
+  for (unsigned int k=0; k<2; k++)
+    modules.push_back(DDName(DDSplit(moduleName[k]).first,
+			     DDSplit(moduleName[k]).second));
+
+  //Modules alternate in z, ICC's in z and in the tangential shift
+  double shift[2] = {sICC, -sICC};
+  DDTrackerEnvelopeCheck envelope("DDTIDRingAlgo", DDLogicalPart(mother));
 
   //Loop over modules
   for (int i=0; i<number; i++) {
 
     //First the module
     double phiz = startAngle + i*dphi;
-    double xpos = rModule*cos(phiz);
-    double ypos = rModule*sin(phiz);
-    double zpos, thetay, phix;
+    DDTranslation trmod(rModule*cos(phiz), rModule*sin(phiz), zModule[i%2]);
+    double thetay, phix;
     if (i%2 == 0) {
       phix   = phiz + 90.*CLHEP::deg;
       thetay = 0*CLHEP::deg;
-      zpos   = zModule[0];
-      module = DDName(DDSplit(moduleName[0]).first, 
-		      DDSplit(moduleName[0]).second);
     } else {
       phix   = phiz - 90.*CLHEP::deg;
       thetay = 180*CLHEP::deg;
-      zpos   = zModule[1];
-      module = DDName(DDSplit(moduleName[1]).first, 
-		      DDSplit(moduleName[1]).second);
     }
     
     // stereo face inside toward structure, rphi face outside
@@ -91,7 +92,6 @@ void DDTIDRingAlgo::execute(DDCompactView& cpv) {
     thetay = thetay + 180.*CLHEP::deg;
     //
     
-    DDTranslation trmod(xpos, ypos, zpos);
     double phideg = phiz/CLHEP::deg;
     DDRotation rotation;
     std::string rotstr = mother.name() + dbl_to_string(phideg*10.);
@@ -106,22 +106,17 @@ void DDTIDRingAlgo::execute(DDCompactView& cpv) {
 		       theta, phiz);
     }
   
-   cpv.position(module, mother, i+1, trmod, rotation);
-    LogDebug("TIDGeom") << "DDTIDRingAlgo test: " << module << " number "
+    envelope.checkPart(DDLogicalPart(modules[i%2]), i+1, trmod, rotation);
+   cpv.position(modules[i%2], mother, i+1, trmod, rotation);
+    LogDebug("TIDGeom") << "DDTIDRingAlgo test: " << modules[i%2] << " number "
 			<< i+1 << " positioned in " << mother << " at "
 			<< trmod << " with " << rotation;
 
     //Now the ICC
-    if (i%2 == 0 ) {
-      zpos = zICC[0];
-      xpos = rICC*cos(phiz) + sICC*sin(phiz);
-      ypos = rICC*sin(phiz) - sICC*cos(phiz);
-    } else {
-      zpos = zICC[1];
-      xpos = rICC*cos(phiz) - sICC*sin(phiz);
-      ypos = rICC*sin(phiz) + sICC*cos(phiz);
-    }
-    DDTranslation tricc(xpos, ypos, zpos);
+    double s = shift[i%2];
+    DDTranslation tricc(rICC*cos(phiz) + s*sin(phiz),
+			rICC*sin(phiz) - s*cos(phiz), zICC[i%2]);
+    envelope.checkPart(DDLogicalPart(icc), i+1, tricc, rotation);
    cpv.position(icc, mother, i+1, tricc, rotation);
     LogDebug("TIDGeom") << "DDTIDRingAlgo test: " << icc << " number " 
 			<< i+1 << " positioned in " << mother << " at "
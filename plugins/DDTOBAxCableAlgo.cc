@@ -13,12 +13,13 @@
 #include "DetectorDescription/Core/interface/DDCurrentNamespace.h"
 #include "DetectorDescription/Core/interface/DDSplit.h"
 #include "Geometry/TrackerCommonData/plugins/DDTOBAxCableAlgo.h"
+#include "Geometry/TrackerCommonData/plugins/DDTrackerMixture.h"
 #include "CLHEP/Units/GlobalPhysicalConstants.h"
 #include "CLHEP/Units/GlobalSystemOfUnits.h"
 
 
 DDTOBAxCableAlgo::DDTOBAxCableAlgo():
-  sectorRin(0),sectorRout(0),sectorDeltaPhi_B(0) {
+  coarse(false),sectorRin(0),sectorRout(0),sectorDeltaPhi_B(0) {
   LogDebug("TOBGeom") <<"DDTOBAxCableAlgo info: Creating an instance";
 }
 
@@ -31,9 +32,12 @@ void DDTOBAxCableAlgo::initialize(const DDNumericArguments & nArgs,
 				  const DDStringVectorArguments & vsArgs) {
   
   idNameSpace  = DDCurrentNamespace::ns();
+  coarse       = false;
+  if (nArgs.find("CoarseServices") != nArgs.end())
+    coarse     = (nArgs["CoarseServices"] > 0.5);
   DDName parentName = parent().name();
   LogDebug("TOBGeom") << "DDTOBAxCableAlgo debug: Parent " << parentName
-		      << " NameSpace " << idNameSpace;
+		      << " NameSpace " << idNameSpace << " Coarse " << coarse;
   
   sectorNumber     = vsArgs["SectorNumber"];      
   sectorRin        = nArgs["SectorRin"];
@@ -73,6 +77,10 @@ void DDTOBAxCableAlgo::initialize(const DDNumericArguments & nArgs,
 void DDTOBAxCableAlgo::execute(DDCompactView& cpv) {
   
   LogDebug("TOBGeom") << "==>> Constructing DDTOBAxCableAlgo...";
+  if (coarse) {
+    coarseServices(cpv);
+    return;
+  }
   DDName tubsName = parent().name();
   
   // Loop over sectors (sectorNumber vector)
@@ -177,3 +185,44 @@ void DDTOBAxCableAlgo::execute(DDCompactView& cpv) {
   
   LogDebug("TOBGeom") << "<<== End of DDTOBAxCableAlgo construction ...";
 }
+
+void DDTOBAxCableAlgo::coarseServices(DDCompactView& cpv) {
+
+  // The sectors go round the whole cylinder: one tubs of the mixture of
+  // their materials, weighted by the phi width of the parts
+  DDName tubsName = parent().name();
+  DDTrackerMixture mixture(parent().material().name().fullname());
+  double dz   = sectorDz;
+  double rin  = sectorRin;
+  double rout = sectorRout;
+  double area = (rout*rout-rin*rin)*dz;
+  for (int i=0; i<(int)(sectorNumber.size()); i++) {
+    double widthphi = ( (i+1 == (int)(sectorStartPhi.size())) ?
+			(sectorStartPhi[0]+CLHEP::twopi)-sectorStartPhi[i] :
+			(sectorStartPhi[i+1]-sectorStartPhi[i]) );
+    double deltaphi = 0.5 * (widthphi - sectorDeltaPhi_B);
+    mixture.add(sectorMaterial_A[i], area*deltaphi);
+    mixture.add(sectorMaterial_B[i], area*sectorDeltaPhi_B);
+    mixture.add(sectorMaterial_C[i], area*deltaphi);
+  }
+
+  std::string name = "TOBAxService";
+  DDSolid solid = DDSolidFactory::tubs(DDName(name, idNameSpace), dz, rin, 
+				       rout, 0, CLHEP::twopi);
+  DDMaterial sectorMatter = mixture.make(DDName(name+"Mixture", idNameSpace),
+					 area*CLHEP::twopi);
+  LogDebug("TOBGeom") << "DDTOBAxCableAlgo test: " 
+		      << DDName(name, idNameSpace) << " Tubs made of " 
+		      << sectorMatter.name() << " from 0 to " 
+		      << CLHEP::twopi/CLHEP::deg << " with Rin " << rin 
+		      << " Rout " << rout << " ZHalf " << dz;
+  DDLogicalPart sectorLogic(DDName(name, idNameSpace), sectorMatter, solid);
+
+  cpv.position(DDName(name,idNameSpace), tubsName, 1, DDTranslation(), 
+				DDRotation());
+  LogDebug("TOBGeom") << "DDTOBAxCableAlgo test: "
+		      << DDName(name,idNameSpace) << " number 1 positioned in "
+		      << tubsName << " with no translation and no rotation";
+
+  LogDebug("TOBGeom") << "<<== End of DDTOBAxCableAlgo construction ...";
+}
@@ -23,7 +23,10 @@ class DDTOBAxCableAlgo : public DDAlgorithm {
 
 private:
 
+  void coarseServices(DDCompactView& cpv);
+
   std::string         idNameSpace;    // Namespace of this and ALL sub-parts
+  bool                coarse;         // Services as one uniform volume
   
   std::vector<std::string> sectorNumber;     // Id. Number of the sectors
   
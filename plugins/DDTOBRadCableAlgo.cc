@@ -13,12 +13,14 @@
 #include "DetectorDescription/Core/interface/DDCurrentNamespace.h"
 #include "DetectorDescription/Core/interface/DDSplit.h"
 #include "Geometry/TrackerCommonData/plugins/DDTOBRadCableAlgo.h"
+#include "Geometry/TrackerCommonData/plugins/DDTrackerMixture.h"
+#include "Geometry/TrackerCommonData/plugins/DDTrackerNames.h"
 #include "CLHEP/Units/GlobalPhysicalConstants.h"
 #include "CLHEP/Units/GlobalSystemOfUnits.h"
 
 
 DDTOBRadCableAlgo::DDTOBRadCableAlgo():
-  rodRin(0),rodRout(0),cableM(0),connM(0),
+  coarse(false),rodRin(0),rodRout(0),cableM(0),connM(0),
   coolR1(0),coolR2(0),coolRin(0),coolRout1(0),coolRout2(0),
   coolStartPhi1(0),coolDeltaPhi1(0),
   coolStartPhi2(0),coolDeltaPhi2(0),
@@ -35,9 +37,12 @@ void DDTOBRadCableAlgo::initialize(const DDNumericArguments & nArgs,
 				   const DDStringVectorArguments & vsArgs) {
 
   idNameSpace  = DDCurrentNamespace::ns();
+  coarse       = false;
+  if (nArgs.find("CoarseServices") != nArgs.end())
+    coarse     = (nArgs["CoarseServices"] > 0.5);
   DDName parentName = parent().name();
   LogDebug("TOBGeom") << "DDTOBRadCableAlgo debug: Parent " << parentName
-		      << " NameSpace " << idNameSpace;
+		      << " NameSpace " << idNameSpace << " Coarse " << coarse;
 
   diskDz       = nArgs["DiskDz"];
   rMax         = nArgs["RMax"];
@@ -100,43 +105,47 @@ void DDTOBRadCableAlgo::initialize(const DDNumericArguments & nArgs,
 void DDTOBRadCableAlgo::execute(DDCompactView& cpv) {
   
   LogDebug("TOBGeom") << "==>> Constructing DDTOBRadCableAlgo...";
+  if (coarse) {
+    coarseServices(cpv);
+    return;
+  }
   DDName diskName = parent().name();
 
   // Loop over sub disks
   for (int i=0; i<(int)(names.size()); i++) {
 
     DDSolid solid;
-    std::string  name;
+    int          name;  //Interned, see DDTrackerNames
     double  dz, rin, rout;
     
     // Cooling Manifolds
-    name  = "TOBCoolingManifold" + names[i] + "a";
+    name  = DDTrackerNames::name("TOBCoolingManifold" + names[i] + "a");
     dz    = coolRout1;
-    DDName manifoldName_a(name, idNameSpace);
+    DDName manifoldName_a = DDTrackerNames::ddname(name, idNameSpace);
     solid = DDSolidFactory::torus(manifoldName_a,coolRin,coolRout1,coolR1[i],coolStartPhi1,coolDeltaPhi1);
     LogDebug("TOBGeom") << "DDTOBRadCableAlgo test: " 
-			<< DDName(name, idNameSpace) << " Torus made of " 
+			<< DDTrackerNames::ddname(name, idNameSpace) << " Torus made of " 
 			<< coolM1 << " from " << coolStartPhi1/CLHEP::deg 
 			<< " to " << (coolStartPhi1+coolDeltaPhi1)/CLHEP::deg 
 			<< " with Rin " << coolRin << " Rout " << coolRout1
 			<< " R torus " << coolR1[i];
     DDName coolManifoldName_a(DDSplit(coolM1).first, DDSplit(coolM1).second);
     DDMaterial coolManifoldMatter_a(coolManifoldName_a);
-    DDLogicalPart coolManifoldLogic_a(DDName(name, idNameSpace), 
+    DDLogicalPart coolManifoldLogic_a(DDTrackerNames::ddname(name, idNameSpace), 
 				      coolManifoldMatter_a, solid);
     
     DDTranslation r1(0, 0, (dz-diskDz));
-    cpv.position(DDName(name,idNameSpace), diskName, i+1, r1, DDRotation());
+    cpv.position(DDTrackerNames::ddname(name, idNameSpace), diskName, i+1, r1, DDRotation());
     LogDebug("TOBGeom") << "DDTOBRadCableAlgo test: " 
-			<< DDName(name,idNameSpace) << " number " << i+1 
+			<< DDTrackerNames::ddname(name, idNameSpace) << " number " << i+1 
 			<< " positioned in " << diskName << " at " << r1
 			<< " with no rotation";
     // Cooling Fluid (in Cooling Manifold)
-    name  = "TOBCoolingManifoldFluid" + names[i] + "a";
-    solid = DDSolidFactory::torus(DDName(name, idNameSpace),coolRin,coolRout2,
+    name  = DDTrackerNames::name("TOBCoolingManifoldFluid" + names[i] + "a");
+    solid = DDSolidFactory::torus(DDTrackerNames::ddname(name, idNameSpace),coolRin,coolRout2,
 				  coolR1[i],coolStartPhi2,coolDeltaPhi2);
     LogDebug("TOBGeom") << "DDTOBRadCableAlgo test: " 
-			<< DDName(name, idNameSpace) << " Torus made of " 
+			<< DDTrackerNames::ddname(name, idNameSpace) << " Torus made of " 
 			<< coolM2 << " from " << coolStartPhi2/CLHEP::deg 
 			<< " to " << (coolStartPhi2+coolDeltaPhi2)/CLHEP::deg 
 			<< " with Rin " << coolRin << " Rout " << coolRout2
@@ -144,43 +153,43 @@ void DDTOBRadCableAlgo::execute(DDCompactView& cpv) {
     DDName coolManifoldFluidName_a(DDSplit(coolM2).first, 
 				   DDSplit(coolM2).second);
     DDMaterial coolManifoldFluidMatter_a(coolManifoldFluidName_a);
-    DDLogicalPart coolManifoldFluidLogic_a(DDName(name, idNameSpace),
+    DDLogicalPart coolManifoldFluidLogic_a(DDTrackerNames::ddname(name, idNameSpace),
 					   coolManifoldFluidMatter_a, solid);
-    cpv.position(DDName(name,idNameSpace), manifoldName_a, i+1, DDTranslation(),
+    cpv.position(DDTrackerNames::ddname(name, idNameSpace), manifoldName_a, i+1, DDTranslation(),
 	  DDRotation());
     LogDebug("TOBGeom") << "DDTOBRadCableAlgo test: " 
-			<< DDName(name,idNameSpace) << " number " << i+1 
+			<< DDTrackerNames::ddname(name, idNameSpace) << " number " << i+1 
 			<< " positioned in " << coolManifoldName_a
 			<< " with no translation and no rotation";
     //
-    name  = "TOBCoolingManifold" + names[i] + "r";
+    name  = DDTrackerNames::name("TOBCoolingManifold" + names[i] + "r");
     dz    = coolRout1;
-    DDName manifoldName_r(name, idNameSpace);
+    DDName manifoldName_r = DDTrackerNames::ddname(name, idNameSpace);
     solid = DDSolidFactory::torus(manifoldName_r,coolRin,coolRout1,coolR2[i],
 				  coolStartPhi1,coolDeltaPhi1);
     LogDebug("TOBGeom") << "DDTOBRadCableAlgo test: " 
-			<< DDName(name, idNameSpace) << " Torus made of " 
+			<< DDTrackerNames::ddname(name, idNameSpace) << " Torus made of " 
 			<< coolM1 << " from " << coolStartPhi1/CLHEP::deg 
 			<< " to " << (coolStartPhi1+coolDeltaPhi1)/CLHEP::deg 
 			<< " with Rin " << coolRin << " Rout " << coolRout1
 			<< " R torus " << coolR2[i];
     DDName coolManifoldName_r(DDSplit(coolM1).first, DDSplit(coolM1).second);
     DDMaterial coolManifoldMatter_r(coolManifoldName_r);
-    DDLogicalPart coolManifoldLogic_r(DDName(name, idNameSpace), 
+    DDLogicalPart coolManifoldLogic_r(DDTrackerNames::ddname(name, idNameSpace), 
 				      coolManifoldMatter_r, solid);
     
     r1 = DDTranslation(0, 0, (dz-diskDz));
-    cpv.position(DDName(name,idNameSpace), diskName, i+1, r1, DDRotation());
+    cpv.position(DDTrackerNames::ddname(name, idNameSpace), diskName, i+1, r1, DDRotation());
     LogDebug("TOBGeom") << "DDTOBRadCableAlgo test: " 
-			<< DDName(name,idNameSpace) << " number " << i+1 
+			<< DDTrackerNames::ddname(name, idNameSpace) << " number " << i+1 
 			<< " positioned in " << diskName << " at " << r1
 			<< " with no rotation";
     // Cooling Fluid (in Cooling Manifold)
-    name  = "TOBCoolingManifoldFluid" + names[i] + "r";
-    solid = DDSolidFactory::torus(DDName(name, idNameSpace),coolRin,coolRout2,
+    name  = DDTrackerNames::name("TOBCoolingManifoldFluid" + names[i] + "r");
+    solid = DDSolidFactory::torus(DDTrackerNames::ddname(name, idNameSpace),coolRin,coolRout2,
 				  coolR2[i],coolStartPhi2,coolDeltaPhi2);
     LogDebug("TOBGeom") << "DDTOBRadCableAlgo test: " 
-			<< DDName(name, idNameSpace) << " Torus made of " 
+			<< DDTrackerNames::ddname(name, idNameSpace) << " Torus made of " 
 			<< coolM2 << " from " << coolStartPhi2/CLHEP::deg 
 			<< " to " << (coolStartPhi2+coolDeltaPhi2)/CLHEP::deg 
 			<< " with Rin " << coolRin << " Rout " << coolRout2
@@ -188,40 +197,40 @@ void DDTOBRadCableAlgo::execute(DDCompactView& cpv) {
     DDName coolManifoldFluidName_r(DDSplit(coolM2).first, 
 				   DDSplit(coolM2).second);
     DDMaterial coolManifoldFluidMatter_r(coolManifoldFluidName_r);
-    DDLogicalPart coolManifoldFluidLogic_r(DDName(name, idNameSpace), 
+    DDLogicalPart coolManifoldFluidLogic_r(DDTrackerNames::ddname(name, idNameSpace), 
 					   coolManifoldFluidMatter_r, solid);
-    cpv.position(DDName(name,idNameSpace), manifoldName_r, i+1, DDTranslation(), 
+    cpv.position(DDTrackerNames::ddname(name, idNameSpace), manifoldName_r, i+1, DDTranslation(), 
 	  DDRotation());
     LogDebug("TOBGeom") << "DDTOBRadCableAlgo test: " 
-			<< DDName(name,idNameSpace) << " number " << i+1 
+			<< DDTrackerNames::ddname(name, idNameSpace) << " number " << i+1 
 			<< " positioned in " << coolManifoldName_r
 			<< " with no translation and no rotation";
     
     // Connectors
-    name  = "TOBConn" + names[i];
+    name  = DDTrackerNames::name("TOBConn" + names[i]);
     dz    = 0.5*connT;
     rin   = 0.5*(rodRin[i]+rodRout[i])-0.5*connW;
     rout  = 0.5*(rodRin[i]+rodRout[i])+0.5*connW;
-    solid = DDSolidFactory::tubs(DDName(name, idNameSpace), dz, rin, 
+    solid = DDSolidFactory::tubs(DDTrackerNames::ddname(name, idNameSpace), dz, rin, 
 				 rout, 0, CLHEP::twopi);
     LogDebug("TOBGeom") << "DDTOBRadCableAlgo test: " 
-			<< DDName(name, idNameSpace) << " Tubs made of " 
+			<< DDTrackerNames::ddname(name, idNameSpace) << " Tubs made of " 
 			<< connM[i] << " from 0 to " << CLHEP::twopi/CLHEP::deg
 			<< " with Rin " << rin << " Rout " << rout 
 			<< " ZHalf " << dz;
     DDName connName(DDSplit(connM[i]).first, DDSplit(connM[i]).second);
     DDMaterial connMatter(connName);
-    DDLogicalPart connLogic(DDName(name, idNameSpace), connMatter, solid);
+    DDLogicalPart connLogic(DDTrackerNames::ddname(name, idNameSpace), connMatter, solid);
 
     DDTranslation r2(0, 0, (dz-diskDz));
-    cpv.position(DDName(name,idNameSpace), diskName, i+1, r2, DDRotation());
+    cpv.position(DDTrackerNames::ddname(name, idNameSpace), diskName, i+1, r2, DDRotation());
     LogDebug("TOBGeom") << "DDTOBRadCableAlgo test: " 
-			<< DDName(name,idNameSpace) << " number " << i+1 
+			<< DDTrackerNames::ddname(name, idNameSpace) << " number " << i+1 
 			<< " positioned in " << diskName << " at " << r2 
 			<< " with no rotation";
 
     // Now the radial cable
-    name  = "TOBRadServices" + names[i];
+    name  = DDTrackerNames::name("TOBRadServices" + names[i]);
     rin   = 0.5*(rodRin[i]+rodRout[i]);
     rout = ( i+1 == (int)(names.size()) ? rMax : 0.5*(rodRin[i+1]+rodRout[i+1]));
     std::vector<double> pgonZ;
@@ -236,10 +245,10 @@ void DDTOBRadCableAlgo::execute(DDCompactView& cpv) {
     pgonRmax.push_back(rout); 
     pgonRmax.push_back(rout); 
     pgonRmax.push_back(rout); 
-    solid = DDSolidFactory::polycone(DDName(name,idNameSpace), 0, CLHEP::twopi,
+    solid = DDSolidFactory::polycone(DDTrackerNames::ddname(name, idNameSpace), 0, CLHEP::twopi,
 				     pgonZ, pgonRmin, pgonRmax);
     LogDebug("TOBGeom") << "DDTOBRadCableAlgo test: " 
-			<< DDName(name, idNameSpace) <<" Polycone made of "
+			<< DDTrackerNames::ddname(name, idNameSpace) <<" Polycone made of "
 			<< cableM[i] << " from 0 to " 
 			<< CLHEP::twopi/CLHEP::deg << " and with " 
 			<< pgonZ.size() << " sections";
@@ -249,12 +258,12 @@ void DDTOBRadCableAlgo::execute(DDCompactView& cpv) {
 			  << pgonRmax[ii];
     DDName cableName(DDSplit(cableM[i]).first, DDSplit(cableM[i]).second);
     DDMaterial cableMatter(cableName);
-    DDLogicalPart cableLogic(DDName(name, idNameSpace), cableMatter, solid);
+    DDLogicalPart cableLogic(DDTrackerNames::ddname(name, idNameSpace), cableMatter, solid);
 
     DDTranslation r3(0, 0, (diskDz-(i+0.5)*cableT));
-    cpv.position(DDName(name,idNameSpace), diskName, i+1, r3, DDRotation());
+    cpv.position(DDTrackerNames::ddname(name, idNameSpace), diskName, i+1, r3, DDRotation());
     LogDebug("TOBGeom") << "DDTOBRadCableAlgo test: " 
-			<< DDName(name,idNameSpace) << " number " <<i+1
+			<< DDTrackerNames::ddname(name, idNameSpace) << " number " <<i+1
 			<< " positioned in " << diskName << " at " << r3
 			<< " with no rotation";
     
@@ -262,3 +271,88 @@ void DDTOBRadCableAlgo::execute(DDCompactView& cpv) {
 
   LogDebug("TOBGeom") << "<<== End of DDTOBRadCableAlgo construction ...";
 }
+
+void DDTOBRadCableAlgo::coarseServices(DDCompactView& cpv) {
+
+  // The services of each sub disk at the same radius (cooling manifolds
+  // with their fluid and connectors) are made into one tubs, the radial
+  // cables into one polycone following their steps; the materials are
+  // mixtures of the detailed ones with the same mass, the gaps being
+  // of the material of the disk
+  DDName diskName = parent().name();
+  std::string fill = parent().material().name().fullname();
+  double area1 = CLHEP::pi*(coolRout1*coolRout1-coolRin*coolRin);
+  double area2 = CLHEP::pi*(coolRout2*coolRout2-coolRin*coolRin);
+
+  DDSolid solid;
+  int          name;  //Interned, see DDTrackerNames
+  double  dz, rin, rout, rmid;
+  for (int i=0; i<(int)(names.size()); i++) {
+
+    // Cooling Manifolds and Connectors
+    rmid  = 0.5*(rodRin[i]+rodRout[i]);
+    DDTrackerMixture mixture(fill);
+    mixture.add(coolM1, (area1*coolDeltaPhi1-area2*coolDeltaPhi2)*
+		(coolR1[i]+coolR2[i]));
+    mixture.add(coolM2, area2*coolDeltaPhi2*(coolR1[i]+coolR2[i]));
+    mixture.add(connM[i], CLHEP::twopi*rmid*connW*connT);
+
+    name  = DDTrackerNames::name("TOBCoolingConn", names[i]);
+    dz    = 0.5*std::max(connT, 2*coolRout1);
+    rin   = std::min(rmid-0.5*connW, std::min(coolR1[i],coolR2[i])-coolRout1);
+    rout  = std::max(rmid+0.5*connW, std::max(coolR1[i],coolR2[i])+coolRout1);
+    solid = DDSolidFactory::tubs(DDTrackerNames::ddname(name, idNameSpace), dz, rin, 
+				 rout, 0, CLHEP::twopi);
+    DDMaterial matter = mixture.make(DDTrackerNames::ddname(DDTrackerNames::name(name, "Mixture"), idNameSpace),
+				     CLHEP::pi*(rout*rout-rin*rin)*2*dz);
+    LogDebug("TOBGeom") << "DDTOBRadCableAlgo test: " 
+			<< DDTrackerNames::ddname(name, idNameSpace) << " Tubs made of " 
+			<< matter.name() << " from 0 to " 
+			<< CLHEP::twopi/CLHEP::deg << " with Rin " << rin 
+			<< " Rout " << rout << " ZHalf " << dz;
+    DDLogicalPart coolConnLogic(DDTrackerNames::ddname(name, idNameSpace), matter, solid);
+
+    DDTranslation r1(0, 0, (dz-diskDz));
+    cpv.position(DDTrackerNames::ddname(name, idNameSpace), diskName, i+1, r1, DDRotation());
+    LogDebug("TOBGeom") << "DDTOBRadCableAlgo test: " 
+			<< DDTrackerNames::ddname(name, idNameSpace) << " number " << i+1 
+			<< " positioned in " << diskName << " at " << r1
+			<< " with no rotation";
+  }
+
+  // Radial cables: the cable of sub disk i at depth i from the face
+  DDTrackerMixture mixture(fill);
+  std::vector<double> pgonZ, pgonRmin, pgonRmax;
+  for (int i=(int)(names.size())-1; i>=0; i--) {
+    rin   = 0.5*(rodRin[i]+rodRout[i]);
+    rout  = ( i+1 == (int)(names.size()) ? rMax : 0.5*(rodRin[i+1]+rodRout[i+1]));
+    for (int k=1; k>=0; k--) {
+      pgonZ.push_back(diskDz-(i+k)*cableT);
+      pgonRmin.push_back(rin);
+      pgonRmax.push_back(rout);
+    }
+    mixture.add(cableM[i], CLHEP::pi*(rout*rout-rin*rin)*cableT);
+  }
+  name  = DDTrackerNames::name("TOBRadServices", "");
+  solid = DDSolidFactory::polycone(DDTrackerNames::ddname(name, idNameSpace), 0, CLHEP::twopi,
+				   pgonZ, pgonRmin, pgonRmax);
+  DDMaterial cableMatter = mixture.make(DDTrackerNames::ddname(DDTrackerNames::name(name, "Mixture"), idNameSpace),
+					mixture.volume());
+  LogDebug("TOBGeom") << "DDTOBRadCableAlgo test: " 
+		      << DDTrackerNames::ddname(name, idNameSpace) <<" Polycone made of "
+		      << cableMatter.name() << " from 0 to " 
+		      << CLHEP::twopi/CLHEP::deg << " and with " 
+		      << pgonZ.size() << " sections";
+  for (int ii = 0; ii < (int)(pgonZ.size()); ii++) 
+    LogDebug("TOBGeom") << "\t[" << ii << "]\tZ = " << pgonZ[ii] 
+			<< "\tRmin = " << pgonRmin[ii] << "\tRmax = " 
+			<< pgonRmax[ii];
+  DDLogicalPart cableLogic(DDTrackerNames::ddname(name, idNameSpace), cableMatter, solid);
+
+  cpv.position(DDTrackerNames::ddname(name, idNameSpace), diskName, 1, DDTranslation(), DDRotation());
+  LogDebug("TOBGeom") << "DDTOBRadCableAlgo test: " 
+		      << DDTrackerNames::ddname(name, idNameSpace) << " number 1 positioned in "
+		      << diskName << " with no translation and no rotation";
+
+  LogDebug("TOBGeom") << "<<== End of DDTOBRadCableAlgo construction ...";
+}
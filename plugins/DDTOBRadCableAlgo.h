@@ -23,7 +23,10 @@ class DDTOBRadCableAlgo : public DDAlgorithm {
 
 private:
 
+  void coarseServices(DDCompactView& cpv);
+
   std::string         idNameSpace;   // Namespace of this and ALL sub-parts
+  bool                coarse;        // Services as a few uniform volumes
 				       
   double              diskDz;        // Disk  thickness
   double              rMax;          // Maximum radius
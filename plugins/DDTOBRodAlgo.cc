@@ -10,6 +10,7 @@
 #include "DetectorDescription/Core/interface/DDCurrentNamespace.h"
 #include "DetectorDescription/Core/interface/DDSplit.h"
 #include "Geometry/TrackerCommonData/plugins/DDTOBRodAlgo.h"
+#include "Geometry/TrackerCommonData/plugins/DDTrackerSensorTable.h"
 #include "CLHEP/Units/GlobalPhysicalConstants.h"
 #include "CLHEP/Units/GlobalSystemOfUnits.h"
 
@@ -267,6 +268,9 @@ void DDTOBRodAlgo::execute(DDCompactView& cpv) {
 		      << " with no rotation";
 
   //Modules
+  DDName moduleName(DDSplit(module).first, DDSplit(module).second);
+  DDTrackerSensorTable::instance().defineModule(cpv,
+						DDLogicalPart(moduleName));
   for (int i=0; i<(int)(moduleRot.size()); i++) {
     DDTranslation r(0, moduleY[i], shift+moduleZ[i]);
     rotstr = DDSplit(moduleRot[i]).first;
@@ -7,10 +7,10 @@
 #include <algorithm>
 
 #include "FWCore/MessageLogger/interface/MessageLogger.h"
-#include "DetectorDescription/Base/interface/DDutils.h"
 #include "DetectorDescription/Core/interface/DDCurrentNamespace.h"
 #include "DetectorDescription/Core/interface/DDSplit.h"
 #include "Geometry/TrackerCommonData/plugins/DDTrackerAngular.h"
+#include "Geometry/TrackerCommonData/plugins/DDTrackerPlacements.h"
 #include "CLHEP/Units/GlobalPhysicalConstants.h"
 #include "CLHEP/Units/GlobalSystemOfUnits.h"
 
@@ -21,6 +21,12 @@ DDTrackerAngular::DDTrackerAngular() {
 
 DDTrackerAngular::~DDTrackerAngular() {}
 
+void DDTrackerAngular::reset() {
+  center.clear();
+  idNameSpace.clear();
+  childName.clear();
+}
+
 void DDTrackerAngular::initialize(const DDNumericArguments & nArgs,
 				  const DDVectorArguments & vArgs,
 				  const DDMapArguments & ,
@@ -65,27 +71,10 @@ void DDTrackerAngular::execute(DDCompactView& cpv) {
 
   DDName mother = parent().name();
   DDName child(DDSplit(childName).first, DDSplit(childName).second);
-  double theta  = 90.*CLHEP::deg;
   int    copy   = startCopyNo;
   double phi    = startAngle;
   for (int i=0; i<n; i++) {
-    double phix = phi;
-    double phiy = phix + 90.*CLHEP::deg;
-    double phideg = phix/CLHEP::deg;
-
-    DDRotation rotation;
-    if (phideg != 0) {
-      std::string rotstr = DDSplit(childName).first+dbl_to_string(phideg*10.);
-      rotation = DDRotation(DDName(rotstr, idNameSpace));
-      if (!rotation) {
-	LogDebug("TrackerGeom") << "DDTrackerAngular test: Creating a new "
-				<< "rotation: " << rotstr << "\t90., " 
-				<< phix/CLHEP::deg << ", 90.," 
-				<< phiy/CLHEP::deg <<", 0, 0";
-	rotation = DDrot(DDName(rotstr, idNameSpace), theta, phix, theta, phiy,
-			 0., 0.);
-      }
-    }
+    DDRotation rotation = DDTrackerPlacements::phiRotation(phi);
 	
     double xpos = radius*cos(phi) + center[0];
     double ypos = radius*sin(phi) + center[1];
@@ -21,6 +21,12 @@ DDTrackerAngularV1::DDTrackerAngularV1() {
 
 DDTrackerAngularV1::~DDTrackerAngularV1() {}
 
+void DDTrackerAngularV1::reset() {
+  center.clear();
+  idNameSpace.clear();
+  childName.clear();
+}
+
 void DDTrackerAngularV1::initialize(const DDNumericArguments & nArgs,
 				  const DDVectorArguments & vArgs,
 				  const DDMapArguments & ,
@@ -22,6 +22,9 @@ public:
 
   void execute(DDCompactView& cpv);
 
+  //Clears the arguments, keeping their storage (DDTrackerPooledAlgo)
+  void reset();
+
 private:
 
   int           n;              //Number of copies
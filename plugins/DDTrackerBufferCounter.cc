@@ -0,0 +1,134 @@
+///////////////////////////////////////////////////////////////////////////////
+// File: DDTrackerBufferCounter.cc
+// Description: Reusable work buffers of the algorithms, with per-plugin
+//              counts of their use
+///////////////////////////////////////////////////////////////////////////////
+
+#include <cstdio>
+#include <cstring>
+
+#include "FWCore/MessageLogger/interface/MessageLogger.h"
+#include "Geometry/TrackerCommonData/plugins/DDTrackerBufferCounter.h"
+
+DDTrackerBufferCounter::Buffers::Buffers() : usedVectors(0), usedStrings(0),
+				     plugin("") {}
+
+DDTrackerBufferCounter::Buffers::~Buffers() {
+  for (unsigned int i=0; i<vectors.size(); i++) delete vectors[i];
+  for (unsigned int i=0; i<strings.size(); i++) delete strings[i];
+}
+
+DDTrackerBufferCounter::Scope::Scope(const char* plugin) {
+  Buffers & b = buffers();
+  previous_   = b.plugin;
+  vectors_    = b.usedVectors;
+  strings_    = b.usedStrings;
+  b.plugin    = plugin;
+  count(plugin).executes++;
+}
+
+DDTrackerBufferCounter::Scope::~Scope() {
+
+  //Buffers which had to grow since they were taken
+  Buffers & b = buffers();
+  Counts & c  = count(b.plugin);
+  for (unsigned int i=vectors_; i<b.usedVectors; i++) {
+    if (b.vectors[i]->capacity() > b.vectorCapacity[i]) c.grown++;
+    b.vectors[i]->clear();
+  }
+  for (unsigned int i=strings_; i<b.usedStrings; i++) {
+    if (b.strings[i]->capacity() > b.stringCapacity[i]) c.grown++;
+    b.strings[i]->clear();
+  }
+  LogDebug("TrackerGeom") << "DDTrackerBufferCounter debug: " << b.plugin
+			  << " used "
+			  << b.usedVectors-vectors_ << " vectors and "
+			  << b.usedStrings-strings_ << " strings; "
+			  << c.grown << " made or grown in "
+			  << c.executes << " executes";
+  b.usedVectors = vectors_;
+  b.usedStrings = strings_;
+  b.plugin      = previous_;
+}
+
+std::vector<double> & DDTrackerBufferCounter::doubles() {
+
+  Buffers & b = buffers();
+  count(b.plugin).buffers++;
+  if (b.usedVectors == b.vectors.size()) {
+    b.vectors.push_back(new std::vector<double>());
+    b.vectorCapacity.push_back(0);
+    count(b.plugin).grown++;
+  }
+  std::vector<double> & v = *(b.vectors[b.usedVectors]);
+  b.vectorCapacity[b.usedVectors++] = v.capacity();
+  return v;
+}
+
+std::string & DDTrackerBufferCounter::string() {
+
+  Buffers & b = buffers();
+  count(b.plugin).buffers++;
+  if (b.usedStrings == b.strings.size()) {
+    b.strings.push_back(new std::string());
+    b.stringCapacity.push_back(0);
+    count(b.plugin).grown++;
+  }
+  std::string & s = *(b.strings[b.usedStrings]);
+  b.stringCapacity[b.usedStrings++] = s.capacity();
+  return s;
+}
+
+void DDTrackerBufferCounter::append(std::string & text, int n) {
+  char buf[16];
+  sprintf(buf, "%d", n);
+  text += buf;
+}
+
+bool DDTrackerBufferCounter::TextLess::operator()(const char* a, const char* b) const {
+  return strcmp(a, b) < 0;
+}
+
+const DDTrackerBufferCounter::CountMap & DDTrackerBufferCounter::counts() {
+  return table();
+}
+
+void DDTrackerBufferCounter::report() {
+
+  for (CountMap::const_iterator it=table().begin(); it!=table().end(); ++it)
+    edm::LogInfo("TrackerGeom") << "DDTrackerBufferCounter: " << it->first << " "
+				<< it->second.executes << " executes, "
+				<< it->second.buffers << " buffers taken, "
+				<< it->second.grown
+				<< " buffers made or grown, "
+				<< it->second.handoffs
+				<< " objects handed over";
+}
+
+void DDTrackerBufferCounter::clear() {
+  table().clear();
+}
+
+DDTrackerBufferCounter::CountMap & DDTrackerBufferCounter::table() {
+  static CountMap theTable;
+  return theTable;
+}
+
+DDTrackerBufferCounter::Buffers & DDTrackerBufferCounter::buffers() {
+  static Buffers theBuffers;
+  return theBuffers;
+}
+
+DDTrackerBufferCounter::Counts & DDTrackerBufferCounter::count(const char* plugin) {
+  CountMap & all = table();
+  CountMap::iterator it = all.find(plugin);
+  if (it == all.end()) {
+    Counts c = {0, 0, 0, 0};
+    it = all.insert(std::make_pair(plugin, c)).first;
+  }
+  return it->second;
+}
+
+void DDTrackerBufferCounter::handoff() {
+  count(buffers().plugin).handoffs++;
+}
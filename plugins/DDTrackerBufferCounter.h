@@ -0,0 +1,98 @@
+#ifndef DD_TrackerBufferCounter_h
+#define DD_TrackerBufferCounter_h
+
+/*
+
+  Reusable work buffers of the tracker algorithms, with per-plugin counts
+  of their use. The algorithm opens a scope at the start of execute()
+
+    DDTrackerBufferCounter::Scope buffers("DDTECAxialCableAlgo");
+
+  and takes its work vectors (polycone sections, ...) and name strings
+  from it. Each buffer is an ordinary std::vector or std::string kept
+  from one execute() to the next: it is handed out empty and cleared,
+  with its capacity kept, when the scope closes. This is not an
+  allocator: the buffers still grow on the heap as usual, and only the
+  reuse of their capacity is gained.
+
+  Objects which must outlive the algorithm (rotation matrices and
+  constants owned by DDD after DDrot or DDConstant) are made on the heap
+  as before and passed through keep(), which only counts them.
+
+  The counts are kept per plugin: executes, buffers taken, buffers made
+  or grown, and objects passed through keep(). They say nothing about
+  the memory used by DDD itself or by the rest of the algorithm. The
+  plugin names are not copied: a scope must be given a string literal.
+  DDTrackerBuildReport writes the counts to the log at the end of the
+  build with report() and clear()s them.
+
+*/
+
+#include <map>
+#include <string>
+#include <vector>
+
+class DDTrackerBufferCounter {
+
+public:
+
+  struct Counts {
+    int executes;
+    int buffers;
+    int grown;
+    int handoffs;
+  };
+
+  class Scope {
+  public:
+    explicit Scope(const char* plugin);
+    ~Scope();
+  private:
+    Scope(const Scope &);
+    const Scope & operator=(const Scope &);
+    const char*  previous_;   //Plugin of the enclosing scope
+    unsigned int vectors_, strings_;
+  };
+
+  //Empty buffers, valid until the scope which took them closes
+  static std::vector<double> & doubles();
+  static std::string &         string();
+
+  //Appends the decimal value of n (as int_to_string)
+  static void append(std::string & text, int n);
+
+  //Counts a heap object handed over to its owner (DDD)
+  template <class T> static T* keep(T* object) {
+    handoff();
+    return object;
+  }
+
+  struct TextLess {
+    bool operator()(const char* a, const char* b) const;
+  };
+  typedef std::map<const char*, Counts, TextLess> CountMap;
+
+  static const CountMap & counts();
+  static void report();
+  static void clear();
+
+private:
+
+  struct Buffers {
+    std::vector<std::vector<double>*> vectors;
+    std::vector<unsigned int>         vectorCapacity;
+    std::vector<std::string*>         strings;
+    std::vector<unsigned int>         stringCapacity;
+    unsigned int                      usedVectors, usedStrings;
+    const char*                       plugin;
+    Buffers();
+    ~Buffers();
+  };
+
+  static Buffers &  buffers();
+  static CountMap & table();
+  static Counts &   count(const char* plugin);
+  static void       handoff();
+};
+
+#endif
@@ -0,0 +1,41 @@
+///////////////////////////////////////////////////////////////////////////////
+// File: DDTrackerBuildReport.cc
+// Description: Log the statistics of the tracker build at its end
+///////////////////////////////////////////////////////////////////////////////
+
+#include "FWCore/MessageLogger/interface/MessageLogger.h"
+#include "Geometry/TrackerCommonData/interface/DDTrackerTransformCache.h"
+#include "Geometry/TrackerCommonData/plugins/DDTrackerBufferCounter.h"
+#include "Geometry/TrackerCommonData/plugins/DDTrackerBuildReport.h"
+#include "Geometry/TrackerCommonData/plugins/DDTrackerEnvelopeCheck.h"
+#include "Geometry/TrackerCommonData/plugins/DDTrackerNames.h"
+#include "Geometry/TrackerCommonData/plugins/DDTrackerSensorTable.h"
+
+
+DDTrackerBuildReport::DDTrackerBuildReport() {
+  LogDebug("TrackerGeom") <<"DDTrackerBuildReport info: Creating an instance";
+}
+
+DDTrackerBuildReport::~DDTrackerBuildReport() {}
+
+void DDTrackerBuildReport::initialize(const DDNumericArguments & ,
+				      const DDVectorArguments & ,
+				      const DDMapArguments & ,
+				      const DDStringArguments & ,
+				      const DDStringVectorArguments & ) {
+
+  LogDebug("TrackerGeom") << "DDTrackerBuildReport debug: Parent "
+			  << parent().name();
+}
+
+void DDTrackerBuildReport::execute(DDCompactView& ) {
+
+  DDTrackerNames::report();
+  DDTrackerNames::clear();
+  DDTrackerBufferCounter::report();
+  DDTrackerBufferCounter::clear();
+  DDTrackerEnvelopeCheck::report();
+  DDTrackerEnvelopeCheck::clear();
+  DDTrackerTransformCache::release();
+  DDTrackerSensorTable::instance().clear();
+}
@@ -0,0 +1,44 @@
+#ifndef DD_TrackerBuildReport_h
+#define DD_TrackerBuildReport_h
+
+/*
+
+  Last step of the tracker build, listed as the last file of every
+  tracker geomXMLFiles configuration (data/trackerBuildReport.xml), so
+  that it runs once all the tracker algorithms have run:
+
+    <Algorithm name="track:DDTrackerBuildReport">
+      <rParent name="tracker:Tracker"/>
+    </Algorithm>
+
+  It writes the statistics of the interned names (DDTrackerNames), the
+  counts of the work buffers of the algorithms (DDTrackerBufferCounter)
+  and the summary of the envelope checks of the daughters made by the
+  algorithms (DDTrackerEnvelopeCheck) to the log, and releases their
+  tables, which are not needed once the volumes are made, as well as
+  the transformation caches shared by the post-build steps
+  (DDTrackerTransformCache::shared) and the sensor types recorded by the
+  algorithms (DDTrackerSensorTable); the post-build steps must therefore
+  all be listed before it.
+
+*/
+
+#include "DetectorDescription/Base/interface/DDTypes.h"
+#include "DetectorDescription/Algorithm/interface/DDAlgorithm.h"
+
+class DDTrackerBuildReport : public DDAlgorithm {
+ public:
+  //Constructor and Destructor
+  DDTrackerBuildReport();
+  virtual ~DDTrackerBuildReport();
+
+  void initialize(const DDNumericArguments & nArgs,
+		  const DDVectorArguments & vArgs,
+		  const DDMapArguments & mArgs,
+		  const DDStringArguments & sArgs,
+		  const DDStringVectorArguments & vsArgs);
+
+  void execute(DDCompactView& cpv);
+};
+
+#endif
@@ -0,0 +1,275 @@
+///////////////////////////////////////////////////////////////////////////////
+// File: DDTrackerEnvelopeCheck.cc
+// Description: Analytic check of daughters against the tubs envelope of
+//              their mother
+///////////////////////////////////////////////////////////////////////////////
+
+#include <cmath>
+#include <algorithm>
+#include <map>
+
+#include "FWCore/MessageLogger/interface/MessageLogger.h"
+#include "DetectorDescription/Core/interface/DDSolid.h"
+#include "Geometry/TrackerCommonData/plugins/DDTrackerEnvelopeCheck.h"
+#include "Geometry/TrackerCommonData/interface/DDTrackerBoundingBox.h"
+#include "CLHEP/Units/GlobalPhysicalConstants.h"
+
+namespace {
+
+  //Distance of the origin to the convex hull of points in the xy plane
+  double hullDistance(const std::vector<double> & x,
+		      const std::vector<double> & y) {
+
+    //The origin is inside if the points leave no gap of pi in azimuth
+    std::vector<double> phi;
+    for (unsigned int i=0; i<x.size(); i++)
+      if (x[i] != 0 || y[i] != 0) phi.push_back(atan2(y[i], x[i]));
+    if (phi.size() < x.size()) return 0;
+    std::sort(phi.begin(), phi.end());
+    double gap = phi.front() + CLHEP::twopi - phi.back();
+    for (unsigned int i=1; i<phi.size(); i++)
+      gap = std::max(gap, phi[i]-phi[i-1]);
+    if (gap < CLHEP::pi) return 0;
+
+    //Otherwise the closest point lies on a segment between two vertices
+    double dmin = 1.e30;
+    for (unsigned int i=0; i<x.size(); i++) {
+      for (unsigned int j=i; j<x.size(); j++) {
+	double ex = x[j]-x[i], ey = y[j]-y[i];
+	double l2 = ex*ex + ey*ey;
+	double t  = (l2 > 0) ? -(x[i]*ex+y[i]*ey)/l2 : 0;
+	t = std::max(0., std::min(1., t));
+	double px = x[i]+t*ex, py = y[i]+t*ey;
+	dmin = std::min(dmin, sqrt(px*px+py*py));
+      }
+    }
+    return dmin;
+  }
+
+  //Checks of one algorithm for the report
+  struct Summary {
+    Summary() : checks(0), failures(0), tightest(0) {}
+    int                                  checks, failures;
+    const DDTrackerEnvelopeCheck::Entry* tightest;
+  };
+
+  void addCorners(double xmin, double ymin, double zmin, double xmax,
+		  double ymax, double zmax, std::vector<DDTranslation> & v) {
+    for (int i=0; i<8; i++)
+      v.push_back(DDTranslation((i&1) ? xmax : xmin, (i&2) ? ymax : ymin,
+				(i&4) ? zmax : zmin));
+  }
+}
+
+DDTrackerEnvelopeCheck::DDTrackerEnvelopeCheck(const std::string & algorithm,
+					       const DDName & mother,
+					       double rmin, double rmax,
+					       double zhalf, double tolerance) :
+  algorithm_(algorithm), mother_(mother), rmin_(rmin), rmax_(rmax),
+  zmin_(-zhalf), zmax_(zhalf), tolerance_(tolerance), active_(true),
+  failures_(0) {}
+
+DDTrackerEnvelopeCheck::DDTrackerEnvelopeCheck(const std::string & algorithm,
+					       const DDLogicalPart & mother,
+					       double tolerance) :
+  algorithm_(algorithm), mother_(mother.ddname()), rmin_(0), rmax_(0),
+  zmin_(0), zmax_(0), tolerance_(tolerance), active_(false), failures_(0) {
+
+  if (!mother.isDefined().second || !mother.solid().isDefined().second)
+    return;
+  const DDSolid & solid = mother.solid();
+  std::vector<double> zv, rminv, rmaxv;
+  double scale = 1;
+  if (solid.shape() == ddtubs) {
+    DDTubs tubs(solid);
+    rminv.push_back(tubs.rIn());
+    rmaxv.push_back(tubs.rOut());
+    zv.push_back(-tubs.zhalf());
+    zv.push_back(tubs.zhalf());
+  } else if (solid.shape() == ddcons) {
+    DDCons cons(solid);
+    rminv.push_back(cons.rInMinusZ());
+    rminv.push_back(cons.rInPlusZ());
+    rmaxv.push_back(cons.rOutMinusZ());
+    rmaxv.push_back(cons.rOutPlusZ());
+    zv.push_back(-cons.zhalf());
+    zv.push_back(cons.zhalf());
+  } else if (solid.shape() == ddpolycone_rrz) {
+    DDPolycone pcon(solid);
+    zv    = pcon.zVec();
+    rminv = pcon.rMinVec();
+    rmaxv = pcon.rMaxVec();
+  } else if (solid.shape() == ddpolyhedra_rrz) {
+    DDPolyhedra phed(solid);
+    zv    = phed.zVec();
+    rminv = phed.rMinVec();
+    rmaxv = phed.rMaxVec();
+    if (phed.sides() > 0) scale = 1./cos(0.5*phed.deltaPhi()/phed.sides());
+  }
+  if (zv.empty() || rminv.empty() || rmaxv.empty()) {
+    LogDebug("TrackerGeom") << algorithm_ << ": no envelope check in "
+			    << mother_ << " (solid " << solid.shape() << ")";
+    return;
+  }
+
+  rmin_   = *std::min_element(rminv.begin(), rminv.end());
+  rmax_   = scale*(*std::max_element(rmaxv.begin(), rmaxv.end()));
+  zmin_   = *std::min_element(zv.begin(), zv.end());
+  zmax_   = *std::max_element(zv.begin(), zv.end());
+  active_ = true;
+}
+
+bool DDTrackerEnvelopeCheck::checkTubs(const DDName & child, int copyNo,
+				       double rin, double rout, double zhalf,
+				       double z) {
+  return record(child, copyNo, rin, rout, z-zhalf, z+zhalf);
+}
+
+bool DDTrackerEnvelopeCheck::checkBox(const DDName & child, int copyNo,
+				      double dx, double dy, double dz,
+				      const DDTranslation & tran,
+				      const DDRotation & rot) {
+
+  std::vector<DDTranslation> local;
+  addCorners(-dx, -dy, -dz, dx, dy, dz, local);
+  return checkVertices(child, copyNo, local, tran, rot);
+}
+
+bool DDTrackerEnvelopeCheck::checkPart(const DDLogicalPart & child,
+				       int copyNo, const DDTranslation & tran,
+				       const DDRotation & rot) {
+
+  std::vector<DDTranslation> local;
+  if (child.isDefined().second && child.solid().isDefined().second) {
+    const DDSolid & solid = child.solid();
+    const DDRotationMatrix* matrix = rot ? rot.rotation() : 0;
+    double r[9] = {1, 0, 0, 0, 1, 0, 0, 0, 1};
+    if (matrix) matrix->GetComponents(r);
+    bool coaxial = (tran.x() == 0 && tran.y() == 0 && std::fabs(r[8]) > 1-1.e-9);
+    if (solid.shape() == ddtubs && coaxial) {
+      DDTubs tubs(solid);
+      return checkTubs(child.ddname(), copyNo, tubs.rIn(), tubs.rOut(),
+		       tubs.zhalf(), tran.z());
+    } else if (solid.shape() == ddbox) {
+      DDBox box(solid);
+      addCorners(-box.halfX(), -box.halfY(), -box.halfZ(), box.halfX(),
+		 box.halfY(), box.halfZ(), local);
+    } else if (solid.shape() == ddtrap) {
+      DDTrap trap(solid);
+      double dz  = trap.halfZ();
+      double tx  = tan(trap.theta())*cos(trap.phi());
+      double ty  = tan(trap.theta())*sin(trap.phi());
+      double ta1 = tan(trap.alpha1());
+      double ta2 = tan(trap.alpha2());
+      for (int s=-1; s<=1; s+=2) {
+	local.push_back(DDTranslation(-dz*tx-trap.y1()*ta1+s*trap.x1(),
+				      -dz*ty-trap.y1(), -dz));
+	local.push_back(DDTranslation(-dz*tx+trap.y1()*ta1+s*trap.x2(),
+				      -dz*ty+trap.y1(), -dz));
+	local.push_back(DDTranslation( dz*tx-trap.y2()*ta2+s*trap.x3(),
+				       dz*ty-trap.y2(),  dz));
+	local.push_back(DDTranslation( dz*tx+trap.y2()*ta2+s*trap.x4(),
+				       dz*ty+trap.y2(),  dz));
+      }
+    } else {
+      DDTrackerBoundingBox box(solid);
+      if (box.valid())
+	addCorners(box.lo[0], box.lo[1], box.lo[2], box.hi[0], box.hi[1],
+		   box.hi[2], local);
+    }
+  }
+  if (local.empty()) local.push_back(DDTranslation());
+  return checkVertices(child.ddname(), copyNo, local, tran, rot);
+}
+
+const std::vector<DDTrackerEnvelopeCheck::Entry> &
+DDTrackerEnvelopeCheck::entries() {
+  return report_();
+}
+
+void DDTrackerEnvelopeCheck::report() {
+
+  std::map<std::string, Summary> summary;
+  const std::vector<Entry> & all = report_();
+  for (unsigned int i=0; i<all.size(); i++) {
+    Summary & s = summary[all[i].algorithm];
+    s.checks++;
+    if (all[i].margin < 0) s.failures++;
+    if (s.tightest == 0 || all[i].margin < s.tightest->margin)
+      s.tightest = &all[i];
+  }
+
+  edm::LogInfo("TrackerGeom") << "DDTrackerEnvelopeCheck: " << all.size()
+			      << " daughters checked by " << summary.size()
+			      << " algorithms";
+  for (std::map<std::string, Summary>::const_iterator it=summary.begin();
+       it != summary.end(); it++) {
+    const Entry & t = *(it->second.tightest);
+    edm::LogInfo("TrackerGeom") << "\t" << it->first << ": "
+				<< it->second.checks << " checks, "
+				<< it->second.failures << " outside; tightest "
+				<< t.child << "[" << t.copyNo << "] in "
+				<< t.mother << " at " << t.margin
+				<< " from its " << t.limit;
+  }
+}
+
+void DDTrackerEnvelopeCheck::clear() {
+  report_().clear();
+}
+
+bool DDTrackerEnvelopeCheck::checkVertices(const DDName & child, int copyNo,
+					   const std::vector<DDTranslation> & local,
+					   const DDTranslation & tran,
+					   const DDRotation & rot) {
+
+  const DDRotationMatrix* matrix = rot ? rot.rotation() : 0;
+  DDRotationMatrix rm = matrix ? *matrix : DDRotationMatrix();
+  std::vector<double> x, y;
+  double rhi = 0, zlo = 1.e30, zhi = -1.e30;
+  for (unsigned int i=0; i<local.size(); i++) {
+    DDTranslation v = rm*local[i] + tran;
+    x.push_back(v.x());
+    y.push_back(v.y());
+    rhi = std::max(rhi, sqrt(v.x()*v.x()+v.y()*v.y()));
+    zlo = std::min(zlo, v.z());
+    zhi = std::max(zhi, v.z());
+  }
+  return record(child, copyNo, hullDistance(x, y), rhi, zlo, zhi);
+}
+
+bool DDTrackerEnvelopeCheck::record(const DDName & child, int copyNo,
+				    double rlo, double rhi, double zlo,
+				    double zhi) {
+
+  if (!active_) return true;
+  Entry entry;
+  entry.algorithm = algorithm_;
+  entry.mother    = mother_;
+  entry.child     = child;
+  entry.copyNo    = copyNo;
+  entry.limit     = "rmin";
+  entry.margin    = rlo - rmin_;
+  if (rmax_-rhi < entry.margin)  { entry.limit = "rmax"; entry.margin = rmax_-rhi; }
+  if (zlo-zmin_ < entry.margin)  { entry.limit = "zmin"; entry.margin = zlo-zmin_; }
+  if (zmax_-zhi < entry.margin)  { entry.limit = "zmax"; entry.margin = zmax_-zhi; }
+  report_().push_back(entry);
+
+  bool ok = (entry.margin >= -tolerance_);
+  if (!ok) {
+    failures_++;
+    edm::LogWarning("TrackerGeom") << algorithm_ << ": " << child << "["
+				   << copyNo << "] extends beyond the "
+				   << entry.limit << " of " << mother_
+				   << " by " << -entry.margin << " (r "
+				   << rlo << ":" << rhi << " z " << zlo << ":"
+				   << zhi << " in r " << rmin_ << ":" << rmax_
+				   << " z " << zmin_ << ":" << zmax_ << ")";
+  }
+  return ok;
+}
+
+std::vector<DDTrackerEnvelopeCheck::Entry> & DDTrackerEnvelopeCheck::report_() {
+  static std::vector<Entry> entries;
+  return entries;
+}
@@ -0,0 +1,87 @@
+#ifndef DD_TrackerEnvelopeCheck_h
+#define DD_TrackerEnvelopeCheck_h
+
+/*
+
+  Analytic check that the daughters positioned by an algorithm fit in
+  the tubs envelope (rmin, rmax, zmin, zmax) of their mother. The
+  algorithm creates one check per envelope, either with the envelope
+  given explicitly or taken from the solid of the mother (tubs, cons,
+  polycone or polyhedra with r-r-z sections; a polyhedra is bounded by
+  the radius of its corners), and calls it for every daughter before
+  positioning it. Mothers of other shapes, or not yet defined, make an
+  inactive check which accepts everything. The radial and z extent of
+  the daughter in the mother frame is computed from its vertices:
+
+    tubs (coaxial)       : rin, rout, z +- zhalf
+    box, trap            : the 8 vertices
+    other defined solids : the 8 corners of their bounding box
+    undefined solids     : the position of the daughter only
+
+  The smallest radius is the distance of the axis to the convex hull of
+  the vertices projected on the xy plane. Every check adds one entry to
+  a report shared by all algorithms, with the tightest limit and its
+  margin (negative if the daughter sticks out); violations beyond the
+  tolerance are also reported as warnings. DDTrackerBuildReport writes
+  a summary per algorithm of the report to the log (report()) and then
+  clears it.
+
+*/
+
+#include <string>
+#include <vector>
+#include "DetectorDescription/Core/interface/DDName.h"
+#include "DetectorDescription/Core/interface/DDLogicalPart.h"
+#include "DetectorDescription/Core/interface/DDTransform.h"
+
+class DDTrackerEnvelopeCheck {
+
+public:
+
+  struct Entry {
+    std::string algorithm;
+    DDName      mother;
+    DDName      child;
+    int         copyNo;
+    std::string limit;    //Tightest limit: rmin, rmax, zmin or zmax
+    double      margin;   //Distance to that limit (< 0: outside)
+  };
+
+  DDTrackerEnvelopeCheck(const std::string & algorithm, const DDName & mother,
+			 double rmin, double rmax, double zhalf,
+			 double tolerance=0);
+  DDTrackerEnvelopeCheck(const std::string & algorithm,
+			 const DDLogicalPart & mother, double tolerance=0);
+
+  bool checkTubs(const DDName & child, int copyNo, double rin, double rout,
+		 double zhalf, double z=0);
+  bool checkBox(const DDName & child, int copyNo, double dx, double dy,
+		double dz, const DDTranslation & tran, const DDRotation & rot);
+  bool checkPart(const DDLogicalPart & child, int copyNo,
+		 const DDTranslation & tran, const DDRotation & rot);
+
+  bool active()   const {return active_;}
+  int  failures() const {return failures_;}
+
+  static const std::vector<Entry> & entries();
+  static void report();
+  static void clear();
+
+private:
+
+  bool checkVertices(const DDName & child, int copyNo,
+		     const std::vector<DDTranslation> & local,
+		     const DDTranslation & tran, const DDRotation & rot);
+  bool record(const DDName & child, int copyNo, double rlo, double rhi,
+	      double zlo, double zhi);
+
+  std::string algorithm_;
+  DDName      mother_;
+  double      rmin_, rmax_, zmin_, zmax_, tolerance_;
+  bool        active_;
+  int         failures_;
+
+  static std::vector<Entry> & report_();
+};
+
+#endif
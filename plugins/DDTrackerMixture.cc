@@ -0,0 +1,79 @@
+///////////////////////////////////////////////////////////////////////////////
+// File: DDTrackerMixture.cc
+// Description: Homogenized material of several detailed volumes
+///////////////////////////////////////////////////////////////////////////////
+
+#include "FWCore/MessageLogger/interface/MessageLogger.h"
+#include "DetectorDescription/Core/interface/DDSolid.h"
+#include "DetectorDescription/Core/interface/DDSplit.h"
+#include "Geometry/TrackerCommonData/plugins/DDTrackerMixture.h"
+#include "CLHEP/Units/GlobalSystemOfUnits.h"
+
+DDTrackerMixture::DDTrackerMixture(const std::string & fill) :
+  fill_(DDName(DDSplit(fill).first, DDSplit(fill).second)), volume_(0) {}
+
+void DDTrackerMixture::add(const std::string & material, double volume,
+			   double copies) {
+  add(DDMaterial(DDName(DDSplit(material).first, DDSplit(material).second)),
+      volume, copies);
+}
+
+void DDTrackerMixture::add(const DDMaterial & material, double volume,
+			   double copies) {
+
+  volume *= copies;
+  volume_ += volume;
+  for (unsigned int i=0; i<materials_.size(); i++) {
+    if (materials_[i].name() == material.name()) {
+      volumes_[i] += volume;
+      return;
+    }
+  }
+  materials_.push_back(material);
+  volumes_.push_back(volume);
+}
+
+void DDTrackerMixture::add(const DDLogicalPart & part, double copies) {
+
+  double volume = part.solid().volume();
+  if (volume < 0) {
+    edm::LogWarning("TrackerGeom") << "DDTrackerMixture: no volume for "
+				   << part.name() << ": not included";
+    return;
+  }
+  add(part.material(), volume, copies);
+}
+
+double DDTrackerMixture::mass() const {
+
+  double mass = 0;
+  for (unsigned int i=0; i<materials_.size(); i++)
+    mass += materials_[i].density()*volumes_[i];
+  return mass;
+}
+
+DDMaterial DDTrackerMixture::make(const DDName & name, double volume) const {
+
+  double fill = volume - volume_;
+  if (fill < -1.e-6*volume) {
+    edm::LogError("TrackerGeom") << "DDTrackerMixture: " << name 
+				 << " of volume " << volume << " stands for "
+				 << volume_ << " of detailed volumes";
+  }
+  if (fill < 0) fill = 0;
+  double mass = this->mass() + fill_.density()*fill;
+  double density = mass/volume;
+
+  DDMaterial mixture(name, density);
+  for (unsigned int i=0; i<materials_.size(); i++)
+    mixture.addMaterial(materials_[i], materials_[i].density()*volumes_[i]/mass);
+  if (fill > 0)
+    mixture.addMaterial(fill_, fill_.density()*fill/mass);
+
+  LogDebug("TrackerGeom") << "DDTrackerMixture: " << name << " of "
+			  << materials_.size() << " materials (+ "
+			  << fill_.name() << ") for a volume of " << volume
+			  << " mass " << mass/CLHEP::g << " g density "
+			  << density/(CLHEP::g/CLHEP::cm3) << " g/cm3";
+  return mixture;
+}
@@ -0,0 +1,51 @@
+#ifndef DD_TrackerMixture_h
+#define DD_TrackerMixture_h
+
+/*
+
+  Homogenized material of a volume standing for several detailed ones.
+  The detailed volumes are added with their material and volume (or as
+  logical parts, with the volume of their solid); make() creates the
+  mixture filling the given volume, the rest being of the fill material
+  (the general material of the algorithm), with the mass fractions of
+  the constituents and the density preserving the total mass:
+
+    density = (sum mass(i) + density(fill) * volume(fill)) / volume
+
+  Constituents of the same material are merged. Detailed volumes larger
+  than the homogenized one are an error in the description: they are
+  reported, and the mixture is made without fill, still with the mass
+  of all the constituents in the homogenized volume.
+
+*/
+
+#include <string>
+#include <vector>
+#include "DetectorDescription/Core/interface/DDName.h"
+#include "DetectorDescription/Core/interface/DDMaterial.h"
+#include "DetectorDescription/Core/interface/DDLogicalPart.h"
+
+class DDTrackerMixture {
+
+public:
+
+  DDTrackerMixture(const std::string & fill);
+
+  void add(const std::string & material, double volume, double copies=1);
+  void add(const DDMaterial & material, double volume, double copies=1);
+  void add(const DDLogicalPart & part, double copies=1);
+
+  double volume() const {return volume_;}
+  double mass()   const;
+
+  DDMaterial make(const DDName & name, double volume) const;
+
+private:
+
+  DDMaterial              fill_;
+  std::vector<DDMaterial> materials_;
+  std::vector<double>     volumes_;
+  double                  volume_;
+};
+
+#endif
@@ -0,0 +1,71 @@
+///////////////////////////////////////////////////////////////////////////////
+// File: DDTrackerModuleIndexExport.cc
+// Description: Write the module index of the placed layers and rings
+///////////////////////////////////////////////////////////////////////////////
+
+#include "FWCore/MessageLogger/interface/MessageLogger.h"
+#include "DetectorDescription/Core/interface/DDSplit.h"
+#include "Geometry/TrackerCommonData/plugins/DDTrackerModuleIndexExport.h"
+#include "Geometry/TrackerCommonData/plugins/DDTrackerSensorTable.h"
+#include "Geometry/TrackerCommonData/interface/DDTrackerModuleIndex.h"
+#include "Geometry/TrackerCommonData/interface/DDTrackerTransformCache.h"
+
+
+DDTrackerModuleIndexExport::DDTrackerModuleIndexExport() {
+  LogDebug("TrackerGeom") << "DDTrackerModuleIndexExport info: Creating an "
+			  << "instance";
+}
+
+DDTrackerModuleIndexExport::~DDTrackerModuleIndexExport() {}
+
+void DDTrackerModuleIndexExport::initialize(const DDNumericArguments & ,
+					    const DDVectorArguments & ,
+					    const DDMapArguments & ,
+					    const DDStringArguments & sArgs,
+					    const DDStringVectorArguments & vsArgs) {
+
+  fileName = sArgs["File"];
+  layers   = vsArgs["Layers"];
+  children.clear();
+  if (vsArgs.find("Children") != vsArgs.end()) children = vsArgs["Children"];
+
+  LogDebug("TrackerGeom") << "DDTrackerModuleIndexExport debug: Parent "
+			  << parent().name() << " File " << fileName
+			  << " with " << layers.size() << " layers and "
+			  << children.size() << " module names";
+  for (unsigned int i=0; i<layers.size(); i++)
+    LogDebug("TrackerGeom") << "\tlayers[" << i << "] = " << layers[i];
+}
+
+void DDTrackerModuleIndexExport::execute(DDCompactView& cpv) {
+
+  std::vector<DDName> layerNames, childNames;
+  for (unsigned int i=0; i<layers.size(); i++)
+    layerNames.push_back(DDName(DDSplit(layers[i]).first,
+				DDSplit(layers[i]).second));
+  for (unsigned int i=0; i<children.size(); i++)
+    childNames.push_back(DDName(DDSplit(children[i]).first,
+				DDSplit(children[i]).second));
+
+  //Only the modules holding a sensor recorded by the module algorithms
+  const std::vector<DDTrackerSensorTable::Sensor> & sensors =
+    DDTrackerSensorTable::instance().sensors();
+  std::vector<DDName> sensorNames;
+  for (unsigned int i=0; i<sensors.size(); i++)
+    sensorNames.push_back(sensors[i].name);
+  if (sensorNames.empty())
+    edm::LogWarning("TrackerGeom") << "DDTrackerModuleIndexExport: no sensor "
+				   << "is recorded; all the modules are "
+				   << "indexed";
+
+  const DDTrackerTransformCache & cache =
+    DDTrackerTransformCache::shared(cpv, parent().name());
+  DDTrackerModuleIndex index;
+  int found = index.fill(cache, layerNames, childNames, sensorNames);
+  if (found < (int)(layerNames.size()))
+    edm::LogWarning("TrackerGeom") << "DDTrackerModuleIndexExport: "
+				   << found << " of the " << layerNames.size()
+				   << " layers are placed below "
+				   << parent().name();
+  index.write(fileName);
+}
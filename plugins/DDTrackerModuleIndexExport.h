@@ -0,0 +1,54 @@
+#ifndef DD_TrackerModuleIndexExport_h
+#define DD_TrackerModuleIndexExport_h
+
+/*
+
+  Fills the module index (DDTrackerModuleIndex) of the given layers and
+  rings placed below the parent and writes it to a binary file, which
+  DDTrackerModuleIndex::open() reads back. The parent is expanded from
+  the compact view, so it must come after all the files which place the
+  layers and their modules. The modules are the volumes placed in a
+  layer off its axis, or only those of the names in Children if given,
+  which hold one of the sensors recorded in DDTrackerSensorTable by the
+  module algorithms; the other daughters of the layers (cooling pipes,
+  ICCs, cables, ...) are not indexed:
+
+    <Algorithm name="track:DDTrackerModuleIndexExport">
+      <rParent name="tracker:Tracker"/>
+      <String name="File" value="TrackerModuleIndex.bin"/>
+      <Vector name="Layers" type="string" nEntries="2">
+        tiblayer0:TIBLayer0Down, tiblayer0:TIBLayer0Up</Vector>
+      <Vector name="Children" type="string" nEntries="2">
+        tibstring0:TIBString0Lo1, tibstring0:TIBString0Up1</Vector>
+    </Algorithm>
+
+*/
+
+#include <map>
+#include <string>
+#include <vector>
+#include "DetectorDescription/Base/interface/DDTypes.h"
+#include "DetectorDescription/Algorithm/interface/DDAlgorithm.h"
+
+class DDTrackerModuleIndexExport : public DDAlgorithm {
+ public:
+  //Constructor and Destructor
+  DDTrackerModuleIndexExport();
+  virtual ~DDTrackerModuleIndexExport();
+
+  void initialize(const DDNumericArguments & nArgs,
+		  const DDVectorArguments & vArgs,
+		  const DDMapArguments & mArgs,
+		  const DDStringArguments & sArgs,
+		  const DDStringVectorArguments & vsArgs);
+
+  void execute(DDCompactView& cpv);
+
+private:
+
+  std::string              fileName;     //Output file
+  std::vector<std::string> layers;       //Layer/ring volumes
+  std::vector<std::string> children;     //Module volumes (all if empty)
+};
+
+#endif
@@ -0,0 +1,146 @@
+///////////////////////////////////////////////////////////////////////////////
+// File: DDTrackerNames.cc
+// Description: Interned names of the parts made by the tracker algorithms
+///////////////////////////////////////////////////////////////////////////////
+
+#include <cstdio>
+#include <cstring>
+#include <deque>
+#include <map>
+#include <utility>
+#include <vector>
+
+#include "FWCore/MessageLogger/interface/MessageLogger.h"
+#include "Geometry/TrackerCommonData/plugins/DDTrackerNames.h"
+
+namespace {
+
+  struct TextLess {
+    bool operator()(const char* a, const char* b) const {
+      return strcmp(a, b) < 0;
+    }
+  };
+
+  //Compared by the characters of the parts, so that a request is looked
+  //up without interning its parts first
+  struct Key {
+    const char* prefix;
+    const char* suffix;
+    bool        numbered;
+    int         number;
+    bool operator<(const Key & k) const {
+      int c = strcmp(prefix, k.prefix);
+      if (c != 0) return c < 0;
+      c = strcmp(suffix, k.suffix);
+      if (c != 0) return c < 0;
+      if (numbered != k.numbered) return k.numbered;
+      return number < k.number;
+    }
+  };
+
+  //The strings are kept in a deque, which never moves them; the keys of
+  //the names point to the strings of their parts
+  struct Table {
+    std::deque<std::string>              texts;
+    std::map<const char*, int, TextLess> ids;
+    std::map<Key, int>                   names;
+    std::deque<DDName>                   ddnames;
+    std::vector<int>                     ddnameOf;  //-1 if not made
+    DDTrackerNames::Stats                stats;
+    Table() { reset(); }
+    void reset() {
+      texts.clear(); ids.clear(); names.clear();
+      ddnames.clear(); ddnameOf.clear();
+      stats.requests = stats.names = 0;
+    }
+  };
+
+  Table & table() {
+    static Table theTable;
+    return theTable;
+  }
+}
+
+const char* DDTrackerNames::Part::text() const {
+  return (id_ >= 0) ? table().texts[id_].c_str() : text_;
+}
+
+int DDTrackerNames::name(const Part & text) {
+  table().stats.requests++;
+  return (text.id_ >= 0) ? text.id_ : intern(text.text());
+}
+
+int DDTrackerNames::name(const Part & prefix, const Part & suffix) {
+  return name(prefix, suffix, false, 0);
+}
+
+int DDTrackerNames::name(const Part & prefix, const Part & suffix, int number) {
+  return name(prefix, suffix, true, number);
+}
+
+int DDTrackerNames::name(const Part & prefix, const Part & suffix,
+			 bool numbered, int number) {
+
+  Table & t = table();
+  t.stats.requests++;
+  Key key = {prefix.text(), suffix.text(), numbered, number};
+  std::map<Key, int>::const_iterator it = t.names.find(key);
+  if (it != t.names.end()) return it->second;
+
+  char buf[16] = "";
+  if (numbered) sprintf(buf, "%d", number);
+  std::string text;
+  text.reserve(strlen(key.prefix)+strlen(key.suffix)+strlen(buf));
+  text.append(key.prefix).append(key.suffix).append(buf);
+  int id = intern(text.c_str());
+  //The key keeps the interned copies of its parts
+  key.prefix = t.texts[prefix.id_ >= 0 ? prefix.id_ : intern(key.prefix)].c_str();
+  key.suffix = t.texts[suffix.id_ >= 0 ? suffix.id_ : intern(key.suffix)].c_str();
+  t.names.insert(std::make_pair(key, id));
+  return id;
+}
+
+const std::string & DDTrackerNames::text(int id) {
+  return table().texts[id];
+}
+
+DDName DDTrackerNames::ddname(int id, const std::string & ns) {
+
+  Table & t = table();
+  int & k = t.ddnameOf[id];
+  if (k < 0) {
+    k = (int)(t.ddnames.size());
+    t.ddnames.push_back(DDName(t.texts[id], ns));
+  } else if (t.ddnames[k].ns() != ns) {
+    t.ddnames[k] = DDName(t.texts[id], ns);
+  }
+  return t.ddnames[k];
+}
+
+DDTrackerNames::Stats DDTrackerNames::stats() {
+  return table().stats;
+}
+
+void DDTrackerNames::report() {
+  Stats s = stats();
+  edm::LogInfo("TrackerGeom") << "DDTrackerNames: " << s.requests 
+			      << " names asked for, " << s.names 
+			      << " distinct strings interned";
+}
+
+void DDTrackerNames::clear() {
+  table().reset();
+}
+
+int DDTrackerNames::intern(const char* text) {
+
+  Table & t = table();
+  std::map<const char*, int, TextLess>::const_iterator it = t.ids.find(text);
+  if (it != t.ids.end()) return it->second;
+  int id = (int)(t.texts.size());
+  t.texts.push_back(text);
+  t.ddnameOf.push_back(-1);
+  t.ids.insert(std::make_pair(t.texts.back().c_str(), id));
+  t.stats.names++;
+  return id;
+}
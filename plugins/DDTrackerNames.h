@@ -0,0 +1,72 @@
+#ifndef DD_TrackerNames_h
+#define DD_TrackerNames_h
+
+/*
+
+  Interned names of the volumes, solids and materials made by the
+  tracker algorithms. A name is built from a prefix, a suffix and an
+  optional number (any int, negative ones included)
+
+    int id = DDTrackerNames::name(idName, "SuppliesBox", i);
+    DDSolid solid = DDSolidFactory::trap(DDTrackerNames::ddname(id, idNameSpace), ...);
+
+  where the prefix and the suffix are strings or ids of names already
+  made. A name built by the caller is interned as it is with name(text).
+  The (prefix, suffix, number) tuples are kept with the id of their
+  name, and compared by their characters: a repeated request costs one
+  lookup, without interning its parts, allocating or concatenating. The
+  DDName of a name is kept with it, so that ddname() does not query the
+  DDName registry again while the namespace is the same.
+
+  The ids are valid until the end of the build: DDTrackerBuildReport
+  writes the counts of stats() to the log and clear()s the table. They
+  are those of the table only: DDName keeps its own copy of every name
+  in its registry, which is not counted.
+
+*/
+
+#include <string>
+#include "DetectorDescription/Core/interface/DDName.h"
+
+class DDTrackerNames {
+
+public:
+
+  //Prefix or suffix: a string or the id of a name. A string is not
+  //copied: it must outlive the call of name() it is given to
+  class Part {
+  public:
+    Part(const char* text) : id_(-1), text_(text) {}
+    Part(const std::string & text) : id_(-1), text_(text.c_str()) {}
+    Part(int id) : id_(id), text_(0) {}
+    const char* text() const;
+  private:
+    friend class DDTrackerNames;
+    int         id_;
+    const char* text_;
+  };
+
+  struct Stats {
+    int           requests;   //Names asked for
+    int           names;      //Distinct strings kept
+  };
+
+  static int                 name(const Part & text);
+  static int                 name(const Part & prefix, const Part & suffix);
+  static int                 name(const Part & prefix, const Part & suffix,
+				  int number);
+  static const std::string & text(int id);
+  static DDName              ddname(int id, const std::string & ns);
+
+  static Stats stats();
+  static void  report();
+  static void  clear();
+
+private:
+
+  static int name(const Part & prefix, const Part & suffix,
+		  bool numbered, int number);
+  static int intern(const char* text);
+};
+
+#endif
@@ -0,0 +1,708 @@
+///////////////////////////////////////////////////////////////////////////////
+// File: DDTrackerOverlapCheck.cc
+// Description: Overlap check of the siblings positioned by the tracker
+//              algorithms, restricted to neighbours in phi
+///////////////////////////////////////////////////////////////////////////////
+
+#include <cmath>
+#include <algorithm>
+#include <set>
+#include <boost/bind.hpp>
+#include <boost/thread/thread.hpp>
+
+#include "FWCore/MessageLogger/interface/MessageLogger.h"
+#include "DetectorDescription/Core/interface/DDLogicalPart.h"
+#include "DetectorDescription/Core/interface/DDSolid.h"
+#include "Geometry/TrackerCommonData/plugins/DDTrackerOverlapCheck.h"
+#include "Geometry/TrackerCommonData/interface/DDTrackerBoundingBox.h"
+#include "Geometry/TrackerCommonData/interface/DDTrackerTransformCache.h"
+#include "CLHEP/Units/GlobalPhysicalConstants.h"
+#include "CLHEP/Units/GlobalSystemOfUnits.h"
+
+namespace {
+
+  const double coaxial = 1.e-6*CLHEP::mm;   //Tolerance on the axis
+
+  struct Sibling {
+    int                  node;
+    DDTrackerBoundingBox box;      //Bounding box in the mother frame
+    bool                 isBox;    //Oriented box below is exact
+    bool                 isCoaxial; //Sections below are exact
+    double               c[3];     //Centre
+    double               a[9];     //Axes (a[3*k+i]: component i of axis k)
+    double               h[3];     //Half lengths along the axes
+    bool                 full;     //Encloses the axis of the mother
+    double               phi0, phi1;
+    std::vector<double>  z, rmin, rmax; //Sections along the mother z axis
+    double               sector0, sector; //Phi sector in the mother frame
+    bool                 isConvex; //Polytope below is exact
+    std::vector<double>  vertex;   //Vertices in the mother frame (x,y,z)
+    std::vector<double>  normal;   //Face normals (unit, one per plane)
+    std::vector<double>  edge;     //Edge directions (unit, one per line)
+  };
+
+  //Siblings of one mother and the result of their comparison
+  struct Mother {
+    int                  node;
+    std::vector<Sibling> sibs;
+    int                  pairs;
+    std::vector<std::pair<std::pair<int,int>,double> > overlaps;
+    std::vector<std::pair<int,int> >                   unchecked;
+  };
+
+  struct PhiRange {
+    PhiRange(double p0, double p1, int i) : phi0(p0), phi1(p1), index(i) {}
+    bool operator<(const PhiRange & o) const {return phi0 < o.phi0;}
+    double phi0, phi1;
+    int    index;
+  };
+
+  //Sections and phi sector of a tubs, cons or polycone whose axis is
+  //the z axis of the mother
+  void makeCoaxial(Sibling & sib, const DDSolid & solid) {
+
+    std::vector<double> z, rmin, rmax;
+    double phi0 = 0, dphi = CLHEP::twopi;
+    if (solid.shape() == ddtubs) {
+      DDTubs tubs(solid);
+      z.push_back(-tubs.zhalf());
+      z.push_back(tubs.zhalf());
+      rmin.assign(2, tubs.rIn());
+      rmax.assign(2, tubs.rOut());
+      phi0 = tubs.startPhi();
+      dphi = tubs.deltaPhi();
+    } else if (solid.shape() == ddcons) {
+      DDCons cons(solid);
+      z.push_back(-cons.zhalf());
+      z.push_back(cons.zhalf());
+      rmin.push_back(cons.rInMinusZ());
+      rmin.push_back(cons.rInPlusZ());
+      rmax.push_back(cons.rOutMinusZ());
+      rmax.push_back(cons.rOutPlusZ());
+      phi0 = cons.phiFrom();
+      dphi = cons.deltaPhi();
+    } else if (solid.shape() == ddpolycone_rrz) {
+      DDPolycone pcon(solid);
+      z    = pcon.zVec();
+      rmin = pcon.rMinVec();
+      rmax = pcon.rMaxVec();
+      phi0 = pcon.startPhi();
+      dphi = pcon.deltaPhi();
+    } else {
+      return;
+    }
+    if (z.size() < 2 || rmin.size() != z.size() || rmax.size() != z.size())
+      return;
+    if (std::fabs(std::fabs(sib.a[8])-1) > 1.e-9 ||
+	std::fabs(sib.c[0]) > coaxial || std::fabs(sib.c[1]) > coaxial)
+      return;
+
+    bool flip = (sib.a[8] < 0);
+    for (unsigned int i=0; i<z.size(); i++)
+      z[i] = flip ? sib.c[2]-z[i] : sib.c[2]+z[i];
+    if (flip) {
+      std::reverse(z.begin(), z.end());
+      std::reverse(rmin.begin(), rmin.end());
+      std::reverse(rmax.begin(), rmax.end());
+    }
+    for (unsigned int i=1; i<z.size(); i++)
+      if (z[i] < z[i-1]) return;
+
+    //Angle of the x axis of the solid and sense of its phi in the xy
+    //plane of the mother
+    double alpha = atan2(sib.a[1], sib.a[0]);
+    double sense = sib.a[0]*sib.a[4] - sib.a[1]*sib.a[3];
+    sib.z         = z;
+    sib.rmin      = rmin;
+    sib.rmax      = rmax;
+    sib.sector0   = (sense > 0) ? alpha+phi0 : alpha-phi0-dphi;
+    sib.sector    = dphi;
+    sib.isCoaxial = true;
+  }
+
+  //Adds the unit vector (x,y,z) to a list of directions unless it is
+  //parallel to one already there
+  void addDirection(std::vector<double> & dirs, double x, double y,
+		    double z) {
+
+    double len = sqrt(x*x+y*y+z*z);
+    if (len < 1.e-12) return;
+    x /= len; y /= len; z /= len;
+    for (unsigned int i=0; i<dirs.size(); i+=3) {
+      double cx = y*dirs[i+2]-z*dirs[i+1];
+      double cy = z*dirs[i]  -x*dirs[i+2];
+      double cz = x*dirs[i+1]-y*dirs[i];
+      if (cx*cx+cy*cy+cz*cz < 1.e-18) return;
+    }
+    dirs.push_back(x);
+    dirs.push_back(y);
+    dirs.push_back(z);
+  }
+
+  //Convex polytope given by its vertices in the frame of the solid and
+  //its faces (vertex indices in order around the face), moved to the
+  //frame of the mother with the local transformation m
+  void makeConvex(Sibling & sib, const double* m, const std::vector<double> & v,
+		  const std::vector<std::vector<int> > & faces) {
+
+    sib.vertex.resize(v.size());
+    for (unsigned int i=0; i<v.size(); i+=3)
+      for (int k=0; k<3; k++)
+	sib.vertex[i+k] = m[4*k]*v[i] + m[4*k+1]*v[i+1] + m[4*k+2]*v[i+2] +
+	  m[4*k+3];
+    const std::vector<double> & p = sib.vertex;
+    for (unsigned int f=0; f<faces.size(); f++) {
+      const std::vector<int> & face = faces[f];
+      double nx = 0, ny = 0, nz = 0;
+      for (unsigned int i=0; i<face.size(); i++) {
+	const double* a = &p[3*face[i]];
+	const double* b = &p[3*face[(i+1)%face.size()]];
+	nx += (a[1]-b[1])*(a[2]+b[2]);
+	ny += (a[2]-b[2])*(a[0]+b[0]);
+	nz += (a[0]-b[0])*(a[1]+b[1]);
+	addDirection(sib.edge, b[0]-a[0], b[1]-a[1], b[2]-a[2]);
+      }
+      addDirection(sib.normal, nx, ny, nz);
+    }
+    sib.isConvex = true;
+  }
+
+  //Polytope of 8 vertices ordered by z, then y, then x
+  void makeHexahedron(Sibling & sib, const double* m,
+		      const std::vector<double> & v) {
+
+    const int index[6][4] = {{0,2,3,1}, {4,5,7,6}, {0,1,5,4}, {2,6,7,3},
+			     {0,4,6,2}, {1,3,7,5}};
+    std::vector<std::vector<int> > faces;
+    for (int f=0; f<6; f++)
+      faces.push_back(std::vector<int>(index[f], index[f]+4));
+    makeConvex(sib, m, v, faces);
+  }
+
+  //Vertices and faces of a DDTrap (as in G4Trap)
+  void makeTrap(Sibling & sib, const double* m, const DDTrap & trap) {
+
+    double dz = trap.halfZ();
+    double tx = tan(trap.theta())*cos(trap.phi());
+    double ty = tan(trap.theta())*sin(trap.phi());
+    double dy[2] = {trap.y1(), trap.y2()};
+    double dxl[2] = {trap.x1(), trap.x3()};   //Half widths at -y
+    double dxh[2] = {trap.x2(), trap.x4()};   //Half widths at +y
+    double ta[2] = {tan(trap.alpha1()), tan(trap.alpha2())};
+    std::vector<double> v;
+    for (int iz=0; iz<2; iz++) {
+      double z = (iz == 0) ? -dz : dz;
+      for (int iy=0; iy<2; iy++) {
+	double y  = (iy == 0) ? -dy[iz] : dy[iz];
+	double dx = (iy == 0) ? dxl[iz] : dxh[iz];
+	for (int ix=0; ix<2; ix++) {
+	  v.push_back(z*tx + y*ta[iz] + ((ix == 0) ? -dx : dx));
+	  v.push_back(z*ty + y);
+	  v.push_back(z);
+	}
+      }
+    }
+    makeHexahedron(sib, m, v);
+  }
+
+  //Vertices and faces of a polyhedra (zplanes, rmin, rmax) which is
+  //convex: no inner surface, full phi range and an outer profile which
+  //is concave in z
+  void makePolyhedra(Sibling & sib, const double* m, const DDPolyhedra & phed) {
+
+    std::vector<double> z = phed.zVec(), rmin = phed.rMinVec(),
+      rmax = phed.rMaxVec();
+    int ns = phed.sides();
+    int np = (int)(z.size());
+    if (ns < 3 || np < 2 || (int)(rmin.size()) != np ||
+	(int)(rmax.size()) != np ||
+	phed.deltaPhi() < CLHEP::twopi-1.e-9) return;
+    for (int j=0; j<np; j++)
+      if (rmin[j] > 0 || rmax[j] < 0 || (j > 0 && !(z[j] > z[j-1]))) return;
+    for (int j=1; j+1<np; j++) {
+      double t = (z[j]-z[j-1])/(z[j+1]-z[j-1]);
+      if (rmax[j] < rmax[j-1] + t*(rmax[j+1]-rmax[j-1]) - 1.e-9) return;
+    }
+
+    //The radii are the distances of the sides to the axis
+    double dphi = CLHEP::twopi/ns;
+    double conv = 1./cos(0.5*dphi);
+    std::vector<double> v;
+    for (int j=0; j<np; j++) {
+      for (int k=0; k<ns; k++) {
+	double phi = phed.startPhi() + k*dphi;
+	v.push_back(rmax[j]*conv*cos(phi));
+	v.push_back(rmax[j]*conv*sin(phi));
+	v.push_back(z[j]);
+      }
+    }
+    std::vector<std::vector<int> > faces;
+    std::vector<int> bottom, top;
+    for (int k=0; k<ns; k++) {
+      bottom.push_back(ns-1-k);
+      top.push_back((np-1)*ns+k);
+    }
+    faces.push_back(bottom);
+    faces.push_back(top);
+    for (int j=0; j+1<np; j++) {
+      for (int k=0; k<ns; k++) {
+	std::vector<int> face(4);
+	face[0] = j*ns+k;
+	face[1] = j*ns+(k+1)%ns;
+	face[2] = (j+1)*ns+(k+1)%ns;
+	face[3] = (j+1)*ns+k;
+	faces.push_back(face);
+      }
+    }
+    makeConvex(sib, m, v, faces);
+  }
+
+  Sibling makeSibling(const DDTrackerTransformCache & cache, int node) {
+
+    Sibling sib;
+    sib.node      = node;
+    sib.isBox     = false;
+    sib.isCoaxial = false;
+    sib.isConvex  = false;
+    sib.full      = true;
+    sib.phi0  = -CLHEP::pi;
+    sib.phi1  = CLHEP::pi;
+    DDLogicalPart part(cache.part(node));
+    if (!part.isDefined().second) return sib;
+
+    DDRotationMatrix rotation;
+    DDTranslation    translation;
+    DDTrackerTransformCache::transform(cache.local(node), rotation,
+				       translation);
+    DDSolid solid = part.solid();
+    sib.box = DDTrackerBoundingBox(solid).transformed(rotation, translation);
+    const double* m = cache.local(node);
+    for (int k=0; k<3; k++)
+      for (int i=0; i<3; i++) sib.a[3*k+i] = m[4*i+k];
+    sib.c[0] = m[3];
+    sib.c[1] = m[7];
+    sib.c[2] = m[11];
+    if (solid.isDefined().second && solid.shape() == ddbox) {
+      DDBox box(solid);
+      sib.isBox = true;
+      sib.h[0]  = box.halfX();
+      sib.h[1]  = box.halfY();
+      sib.h[2]  = box.halfZ();
+      std::vector<double> v;
+      for (int i=0; i<8; i++) {
+	v.push_back((i&1) ? sib.h[0] : -sib.h[0]);
+	v.push_back((i&2) ? sib.h[1] : -sib.h[1]);
+	v.push_back((i&4) ? sib.h[2] : -sib.h[2]);
+      }
+      makeHexahedron(sib, m, v);
+    }
+    if (solid.isDefined().second) {
+      if (solid.shape() == ddtrap)
+	makeTrap(sib, m, DDTrap(solid));
+      else if (solid.shape() == ddpolyhedra_rrz)
+	makePolyhedra(sib, m, DDPolyhedra(solid));
+      else
+	makeCoaxial(sib, solid);
+    }
+
+    //Phi range subtended by the box (less than pi if it misses the axis)
+    if (!sib.box.valid()) return sib;
+    if (sib.box.lo[0] <= 0 && sib.box.hi[0] >= 0 &&
+	sib.box.lo[1] <= 0 && sib.box.hi[1] >= 0) return sib;
+    double phic = atan2(sib.box.center(1), sib.box.center(0));
+    double dmin = 0, dmax = 0;
+    for (int ix=0; ix<2; ix++) {
+      for (int iy=0; iy<2; iy++) {
+	double x = (ix == 0) ? sib.box.lo[0] : sib.box.hi[0];
+	double y = (iy == 0) ? sib.box.lo[1] : sib.box.hi[1];
+	double d = atan2(y, x) - phic;
+	if (d >   CLHEP::pi) d -= CLHEP::twopi;
+	if (d <= -CLHEP::pi) d += CLHEP::twopi;
+	dmin = std::min(dmin, d);
+	dmax = std::max(dmax, d);
+      }
+    }
+    sib.full = false;
+    sib.phi0 = phic + dmin;
+    sib.phi1 = phic + dmax;
+    return sib;
+  }
+
+  //Penetration depth of two oriented boxes (negative if separated)
+  double boxDepth(const Sibling & s1, const Sibling & s2) {
+
+    double axes[15][3];
+    int    n = 0;
+    for (int k=0; k<3; k++) {
+      for (int i=0; i<3; i++) {
+	axes[n][i]   = s1.a[3*k+i];
+	axes[n+1][i] = s2.a[3*k+i];
+      }
+      n += 2;
+    }
+    for (int k1=0; k1<3; k1++) {
+      for (int k2=0; k2<3; k2++) {
+	const double* u = s1.a + 3*k1;
+	const double* v = s2.a + 3*k2;
+	double w[3] = {u[1]*v[2]-u[2]*v[1], u[2]*v[0]-u[0]*v[2],
+		       u[0]*v[1]-u[1]*v[0]};
+	double len = sqrt(w[0]*w[0]+w[1]*w[1]+w[2]*w[2]);
+	if (len < 1.e-9) continue;
+	for (int i=0; i<3; i++) axes[n][i] = w[i]/len;
+	n++;
+      }
+    }
+
+    double d[3] = {s2.c[0]-s1.c[0], s2.c[1]-s1.c[1], s2.c[2]-s1.c[2]};
+    double depth = 1.e30;
+    for (int l=0; l<n; l++) {
+      const double* L = axes[l];
+      double r1 = 0, r2 = 0;
+      for (int k=0; k<3; k++) {
+	r1 += s1.h[k]*std::fabs(s1.a[3*k]*L[0]+s1.a[3*k+1]*L[1]+s1.a[3*k+2]*L[2]);
+	r2 += s2.h[k]*std::fabs(s2.a[3*k]*L[0]+s2.a[3*k+1]*L[1]+s2.a[3*k+2]*L[2]);
+      }
+      double ov = r1 + r2 - std::fabs(d[0]*L[0]+d[1]*L[1]+d[2]*L[2]);
+      if (ov < depth) depth = ov;
+      if (depth <= 0) break;
+    }
+    return depth;
+  }
+
+  void project(const std::vector<double> & v, const double* L, double & lo,
+	       double & hi) {
+
+    lo = 1.e30; hi = -1.e30;
+    for (unsigned int i=0; i<v.size(); i+=3) {
+      double d = v[i]*L[0] + v[i+1]*L[1] + v[i+2]*L[2];
+      if (d < lo) lo = d;
+      if (d > hi) hi = d;
+    }
+  }
+
+  //Penetration depth of two convex polytopes (negative if separated):
+  //the smallest overlap of their projections on the face normals and on
+  //the cross products of the edge directions
+  double convexDepth(const Sibling & s1, const Sibling & s2) {
+
+    std::vector<double> axes(s1.normal);
+    axes.insert(axes.end(), s2.normal.begin(), s2.normal.end());
+    for (unsigned int i=0; i<s1.edge.size(); i+=3) {
+      const double* u = &s1.edge[i];
+      for (unsigned int j=0; j<s2.edge.size(); j+=3) {
+	const double* v = &s2.edge[j];
+	double w[3] = {u[1]*v[2]-u[2]*v[1], u[2]*v[0]-u[0]*v[2],
+		       u[0]*v[1]-u[1]*v[0]};
+	double len = sqrt(w[0]*w[0]+w[1]*w[1]+w[2]*w[2]);
+	if (len < 1.e-9) continue;
+	for (int k=0; k<3; k++) axes.push_back(w[k]/len);
+      }
+    }
+
+    double depth = 1.e30;
+    for (unsigned int l=0; l<axes.size(); l+=3) {
+      double lo1, hi1, lo2, hi2;
+      project(s1.vertex, &axes[l], lo1, hi1);
+      project(s2.vertex, &axes[l], lo2, hi2);
+      double ov = std::min(hi1, hi2) - std::max(lo1, lo2);
+      if (ov < depth) depth = ov;
+      if (depth <= 0) break;
+    }
+    return depth;
+  }
+
+  bool sectorsOverlap(const Sibling & s1, const Sibling & s2) {
+
+    if (s1.sector >= CLHEP::twopi-1.e-9 || s2.sector >= CLHEP::twopi-1.e-9)
+      return true;
+    double d = fmod(s2.sector0-s1.sector0, CLHEP::twopi);
+    if (d < 0) d += CLHEP::twopi;
+    return (d < s1.sector || d+s2.sector > CLHEP::twopi);
+  }
+
+  //Radius of the section boundary r (rmin or rmax) at zl and zr, which
+  //lie in the same section
+  void radii(const Sibling & s, const std::vector<double> & r, double zl,
+	     double zr, double & rl, double & rr) {
+
+    double zm = 0.5*(zl+zr);
+    unsigned int j = 0;
+    while (j+2 < s.z.size() && !(zm < s.z[j+1])) j++;
+    double dz = s.z[j+1] - s.z[j];
+    double t  = (dz > 0) ? (r[j+1]-r[j])/dz : 0;
+    rl = r[j] + t*(zl-s.z[j]);
+    rr = r[j] + t*(zr-s.z[j]);
+  }
+
+  //Penetration depth of two coaxial solids (negative if separated): the
+  //overlap in z or the largest radial overlap over the common z range,
+  //whichever is smaller
+  double coaxialDepth(const Sibling & s1, const Sibling & s2) {
+
+    if (!sectorsOverlap(s1, s2)) return -1;
+    double zlo = std::max(s1.z.front(), s2.z.front());
+    double zhi = std::min(s1.z.back(), s2.z.back());
+    if (zhi <= zlo) return zhi-zlo;
+
+    std::vector<double> zs;
+    zs.push_back(zlo);
+    zs.push_back(zhi);
+    for (unsigned int i=0; i<s1.z.size(); i++)
+      if (s1.z[i] > zlo && s1.z[i] < zhi) zs.push_back(s1.z[i]);
+    for (unsigned int i=0; i<s2.z.size(); i++)
+      if (s2.z[i] > zlo && s2.z[i] < zhi) zs.push_back(s2.z[i]);
+    std::sort(zs.begin(), zs.end());
+
+    //The radial overlap is linear between the section boundaries and
+    //the crossings of the inner and of the outer radii
+    double radial = -1.e30;
+    for (unsigned int k=0; k+1<zs.size(); k++) {
+      if (zs[k+1] <= zs[k]) continue;
+      double in1[2], in2[2], out1[2], out2[2];
+      radii(s1, s1.rmin, zs[k], zs[k+1], in1[0], in1[1]);
+      radii(s1, s1.rmax, zs[k], zs[k+1], out1[0], out1[1]);
+      radii(s2, s2.rmin, zs[k], zs[k+1], in2[0], in2[1]);
+      radii(s2, s2.rmax, zs[k], zs[k+1], out2[0], out2[1]);
+      double t[4] = {0, 1, 0, 0};
+      int    nt   = 2;
+      double din0 = in1[0]-in2[0], din1 = in1[1]-in2[1];
+      if (din0*din1 < 0) t[nt++] = din0/(din0-din1);
+      double dout0 = out1[0]-out2[0], dout1 = out1[1]-out2[1];
+      if (dout0*dout1 < 0) t[nt++] = dout0/(dout0-dout1);
+      for (int i=0; i<nt; i++) {
+	double rin  = std::max(in1[0]+t[i]*(in1[1]-in1[0]),
+			       in2[0]+t[i]*(in2[1]-in2[0]));
+	double rout = std::min(out1[0]+t[i]*(out1[1]-out1[0]),
+			       out2[0]+t[i]*(out2[1]-out2[0]));
+	radial = std::max(radial, rout-rin);
+      }
+    }
+    return std::min(zhi-zlo, radial);
+  }
+
+  //Siblings of a mother; the solids are read from the compact view, so
+  //this is done before the comparisons are shared out among threads
+  void gather(const DDTrackerTransformCache & cache, int node, Mother & mother) {
+
+    mother.node  = node;
+    mother.pairs = 0;
+    for (int i=node+1; i<node+cache.size(node); i+=cache.size(i))
+      mother.sibs.push_back(makeSibling(cache, i));
+  }
+
+  //Compares the siblings of one mother
+  void compare(Mother & mother, double tol) {
+
+    const std::vector<Sibling> & sibs = mother.sibs;
+    //Candidate pairs: overlapping phi ranges (with wrap around at +-pi)
+    std::vector<PhiRange> ranges;
+    std::vector<int>      full;
+    for (unsigned int i=0; i<sibs.size(); i++) {
+      if (!sibs[i].box.valid()) continue;
+      if (sibs[i].full) {
+	full.push_back(i);
+	continue;
+      }
+      ranges.push_back(PhiRange(sibs[i].phi0, sibs[i].phi1, i));
+      if (sibs[i].phi1 > CLHEP::pi)
+	ranges.push_back(PhiRange(sibs[i].phi0-CLHEP::twopi,
+				  sibs[i].phi1-CLHEP::twopi, i));
+      if (sibs[i].phi0 < -CLHEP::pi)
+	ranges.push_back(PhiRange(sibs[i].phi0+CLHEP::twopi,
+				  sibs[i].phi1+CLHEP::twopi, i));
+    }
+    std::sort(ranges.begin(), ranges.end());
+
+    std::set<std::pair<int,int> > pairs;
+    for (unsigned int i=0; i<ranges.size(); i++) {
+      for (unsigned int j=i+1; j<ranges.size() &&
+	     ranges[j].phi0 <= ranges[i].phi1; j++) {
+	int i1 = std::min(ranges[i].index, ranges[j].index);
+	int i2 = std::max(ranges[i].index, ranges[j].index);
+	if (i1 != i2) pairs.insert(std::pair<int,int>(i1, i2));
+      }
+    }
+    for (unsigned int i=0; i<full.size(); i++) {
+      for (unsigned int j=0; j<sibs.size(); j++) {
+	int i1 = std::min(full[i], (int)(j));
+	int i2 = std::max(full[i], (int)(j));
+	if (i1 != i2 && sibs[j].box.valid())
+	  pairs.insert(std::pair<int,int>(i1, i2));
+      }
+    }
+    mother.pairs = (int)(pairs.size());
+
+    //Only the pairs with an exact test are counted
+    for (std::set<std::pair<int,int> >::const_iterator it=pairs.begin();
+	 it != pairs.end(); ++it) {
+      const Sibling & s1 = sibs[it->first];
+      const Sibling & s2 = sibs[it->second];
+      if (!s1.box.overlaps(s2.box, tol)) continue;
+      double depth;
+      if (s1.isBox && s2.isBox) {
+	depth = boxDepth(s1, s2);
+      } else if (s1.isConvex && s2.isConvex) {
+	depth = convexDepth(s1, s2);
+      } else if (s1.isCoaxial && s2.isCoaxial) {
+	depth = coaxialDepth(s1, s2);
+      } else {
+	mother.unchecked.push_back(*it);
+	continue;
+      }
+      if (depth > tol)
+	mother.overlaps.push_back(std::pair<std::pair<int,int>,double>(*it, depth));
+    }
+  }
+
+  //Compares the siblings of every step-th mother from first
+  void compareAll(std::vector<Mother> * mothers, unsigned int first,
+		  unsigned int step, double tol) {
+    for (unsigned int i=first; i<mothers->size(); i+=step)
+      compare((*mothers)[i], tol);
+  }
+
+  //Results of one mother, in the order of its sibling pairs
+  int collect(const DDTrackerTransformCache & cache, const Mother & mother,
+	      std::vector<DDTrackerOverlapCheck::Overlap> & result,
+	      std::vector<DDTrackerOverlapCheck::Overlap> * unchecked) {
+
+    const DDName & name = cache.part(mother.node);
+    for (unsigned int k=0; k<mother.overlaps.size(); k++) {
+      DDTrackerOverlapCheck::Overlap ov;
+      int n1 = mother.sibs[mother.overlaps[k].first.first].node;
+      int n2 = mother.sibs[mother.overlaps[k].first.second].node;
+      ov.mother     = name;
+      ov.first      = cache.part(n1);
+      ov.firstCopy  = cache.copyNo(n1);
+      ov.second     = cache.part(n2);
+      ov.secondCopy = cache.copyNo(n2);
+      ov.depth      = mother.overlaps[k].second;
+      result.push_back(ov);
+    }
+    for (unsigned int k=0; unchecked && k<mother.unchecked.size(); k++) {
+      DDTrackerOverlapCheck::Overlap ov;
+      int n1 = mother.sibs[mother.unchecked[k].first].node;
+      int n2 = mother.sibs[mother.unchecked[k].second].node;
+      ov.mother     = name;
+      ov.first      = cache.part(n1);
+      ov.firstCopy  = cache.copyNo(n1);
+      ov.second     = cache.part(n2);
+      ov.secondCopy = cache.copyNo(n2);
+      ov.depth      = 0;
+      unchecked->push_back(ov);
+    }
+    LogDebug("TrackerGeom") << "DDTrackerOverlapCheck: " << name << " with "
+			    << mother.sibs.size() << " siblings, "
+			    << mother.pairs << " neighbour pairs, "
+			    << mother.overlaps.size() << " overlaps, "
+			    << mother.unchecked.size() << " pairs with "
+			    << "overlapping bounding boxes not checked";
+    return (int)(mother.overlaps.size());
+  }
+}
+
+DDTrackerOverlapCheck::DDTrackerOverlapCheck() : tolerance(0.001*CLHEP::mm) {
+  LogDebug("TrackerGeom") <<"DDTrackerOverlapCheck info: Creating an instance";
+}
+
+DDTrackerOverlapCheck::~DDTrackerOverlapCheck() {}
+
+void DDTrackerOverlapCheck::initialize(const DDNumericArguments & nArgs,
+				       const DDVectorArguments & ,
+				       const DDMapArguments & ,
+				       const DDStringArguments & ,
+				       const DDStringVectorArguments & vsArgs) {
+
+  if (nArgs.find("Tolerance") != nArgs.end()) tolerance = nArgs["Tolerance"];
+  if (vsArgs.find("Subdetectors") != vsArgs.end())
+    subdetectors = vsArgs["Subdetectors"];
+  if (subdetectors.empty()) subdetectors.push_back("");
+
+  LogDebug("TrackerGeom") << "DDTrackerOverlapCheck debug: Parent "
+			  << parent().name() << " Tolerance " << tolerance
+			  << " for " << subdetectors.size() << " subdetectors";
+  for (unsigned int i=0; i<subdetectors.size(); i++)
+    LogDebug("TrackerGeom") << "\tSubdetector[" << i << "] = "
+			    << subdetectors[i];
+}
+
+void DDTrackerOverlapCheck::execute(DDCompactView& cpv) {
+
+  const DDTrackerTransformCache & cache =
+    DDTrackerTransformCache::shared(cpv, parent().name());
+  for (unsigned int i=0; i<subdetectors.size(); i++) {
+    std::vector<Overlap> overlaps, unchecked;
+    int n = check(cache, subdetectors[i], tolerance, overlaps, &unchecked);
+    for (unsigned int k=0; k<overlaps.size(); k++) {
+      const Overlap & ov = overlaps[k];
+      edm::LogWarning("TrackerGeom") << "DDTrackerOverlapCheck: "
+				     << "overlap in " << ov.mother << " of "
+				     << ov.first << "[" << ov.firstCopy
+				     << "] and " << ov.second << "["
+				     << ov.secondCopy << "] by "
+				     << ov.depth/CLHEP::mm << " mm";
+    }
+    for (unsigned int k=0; k<unchecked.size(); k++) {
+      const Overlap & ov = unchecked[k];
+      edm::LogWarning("TrackerGeom") << "DDTrackerOverlapCheck: "
+				     << "no exact test in " << ov.mother
+				     << " of " << ov.first << "["
+				     << ov.firstCopy << "] and " << ov.second
+				     << "[" << ov.secondCopy << "] whose "
+				     << "bounding boxes overlap";
+    }
+    LogDebug("TrackerGeom") << "DDTrackerOverlapCheck: " << n
+			    << " overlaps in subdetector " << subdetectors[i];
+  }
+}
+
+
+int DDTrackerOverlapCheck::check(const DDTrackerTransformCache & cache,
+				 const std::string & subdetector,
+				 double tol, std::vector<Overlap> & result,
+				 std::vector<Overlap> * unchecked) {
+
+  //Every mother is checked once, at its first instance
+  std::set<DDName>    checked;
+  std::vector<Mother> mothers;
+  for (int i=0; i<cache.nodes(); i++) {
+    if (cache.size(i) == 1) continue;
+    const DDName & mother = cache.part(i);
+    if (!subdetector.empty() && mother.ns() != subdetector) continue;
+    if (checked.insert(mother).second) {
+      mothers.push_back(Mother());
+      gather(cache, i, mothers.back());
+    }
+  }
+
+  //The mothers are independent once their siblings are gathered
+  unsigned int threads = boost::thread::hardware_concurrency();
+  if (threads > mothers.size()) threads = mothers.size();
+  if (threads > 1) {
+    boost::thread_group group;
+    for (unsigned int t=0; t<threads; t++)
+      group.create_thread(boost::bind(&compareAll, &mothers, t, threads, tol));
+    group.join_all();
+  } else {
+    compareAll(&mothers, 0, 1, tol);
+  }
+
+  int n = 0;
+  for (unsigned int i=0; i<mothers.size(); i++)
+    n += collect(cache, mothers[i], result, unchecked);
+  LogDebug("TrackerGeom") << "DDTrackerOverlapCheck: " << mothers.size()
+			  << " mothers of " << subdetector << " checked with "
+			  << std::max(threads, 1U) << " threads";
+  return n;
+}
+
+int DDTrackerOverlapCheck::check(const DDTrackerTransformCache & cache,
+				 int node, double tol,
+				 std::vector<Overlap> & result,
+				 std::vector<Overlap> * unchecked) {
+
+  Mother mother;
+  gather(cache, node, mother);
+  compare(mother, tol);
+  return collect(cache, mother, result, unchecked);
+}
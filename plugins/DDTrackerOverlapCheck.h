@@ -0,0 +1,97 @@
+#ifndef DD_TrackerOverlapCheck_h
+#define DD_TrackerOverlapCheck_h
+
+/*
+
+  Overlap check of the sibling volumes below the parent, expanded from
+  the finished compact view (DDTrackerTransformCache) so that the XML
+  placements are checked as well; every mother is checked once. The
+  daughters of the tracker algorithms are arranged in rings (alternating
+  radius or z, strings at two radii, ...) and each of them only subtends
+  a small phi range in the frame of its mother. The siblings are
+  therefore sorted by the phi range of their bounding box and only
+  those with overlapping phi ranges are compared, which reduces the
+  check to a few neighbours per copy. Siblings which enclose the axis of
+  the mother are compared with all the others.
+
+  Pairs of convex solids (boxes, traps, and polyhedra without an inner
+  surface over the full phi range whose profile is convex) are tested
+  exactly with the separating axis theorem, on the face normals and on
+  the cross products of the edges. A pair of tubs, cons or polycones
+  (rmin, rmax, z) whose axis is the z axis of the mother is tested
+  exactly by comparing their phi sectors, their z ranges and their
+  radial ranges section by section. Other pairs whose bounding boxes
+  overlap are not counted as overlaps; they are reported by name as
+  warnings. Overlaps with a depth below the tolerance (touching
+  surfaces) are ignored.
+
+  The siblings of all the mothers are read from the compact view first;
+  the mothers are then compared in parallel (boost::thread, one share of
+  the mothers per hardware thread) and the results are reported in the
+  order of the mothers.
+
+  The check runs on one subdetector (namespace) at a time, so that the
+  subdetectors can be validated in separate jobs. Used as an algorithm
+  it must come after all the files whose placements it checks:
+
+    <Algorithm name="track:DDTrackerOverlapCheck">
+      <rParent name="tracker:Tracker"/>
+      <Numeric name="Tolerance" value="1*micron"/>
+      <Vector name="Subdetectors" type="string" nEntries="2">
+        tidmodule0, tidring </Vector>
+    </Algorithm>
+
+*/
+
+#include <map>
+#include <string>
+#include <vector>
+#include "DetectorDescription/Base/interface/DDTypes.h"
+#include "DetectorDescription/Algorithm/interface/DDAlgorithm.h"
+#include "DetectorDescription/Core/interface/DDName.h"
+
+class DDTrackerTransformCache;
+
+class DDTrackerOverlapCheck : public DDAlgorithm {
+ public:
+
+  struct Overlap {
+    DDName mother;
+    DDName first, second;          //Siblings
+    int    firstCopy, secondCopy;  //and their copy numbers
+    double depth;                  //Penetration depth
+  };
+
+  //Constructor and Destructor
+  DDTrackerOverlapCheck();
+  virtual ~DDTrackerOverlapCheck();
+
+  void initialize(const DDNumericArguments & nArgs,
+		  const DDVectorArguments & vArgs,
+		  const DDMapArguments & mArgs,
+		  const DDStringArguments & sArgs,
+		  const DDStringVectorArguments & vsArgs);
+
+  void execute(DDCompactView& cpv);
+
+  //Checks the siblings in all mothers of a subdetector ("" for all);
+  //returns the number of overlaps added to result. The pairs without an
+  //exact test whose bounding boxes overlap are added to unchecked (with
+  //a depth of 0) if it is given
+  static int check(const DDTrackerTransformCache & cache,
+		   const std::string & subdetector, double tolerance,
+		   std::vector<Overlap> & result,
+		   std::vector<Overlap> * unchecked=0);
+
+  //Checks the daughters of one node of the cache
+  static int check(const DDTrackerTransformCache & cache, int mother,
+		   double tolerance, std::vector<Overlap> & result,
+		   std::vector<Overlap> * unchecked=0);
+
+private:
+
+  std::vector<std::string> subdetectors; //Namespaces to be checked
+  double                   tolerance;    //Minimum depth of an overlap
+};
+
+#endif
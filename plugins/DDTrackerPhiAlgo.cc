@@ -11,6 +11,7 @@
 #include "DetectorDescription/Core/interface/DDCurrentNamespace.h"
 #include "DetectorDescription/Core/interface/DDSplit.h"
 #include "Geometry/TrackerCommonData/plugins/DDTrackerPhiAlgo.h"
+#include "Geometry/TrackerCommonData/plugins/DDTrackerEnvelopeCheck.h"
 #include "CLHEP/Units/GlobalPhysicalConstants.h"
 #include "CLHEP/Units/GlobalSystemOfUnits.h"
 
@@ -77,6 +78,7 @@ void DDTrackerPhiAlgo::execute(DDCompactView& cpv) {
 
   DDName mother = parent().name();
   DDName child(DDSplit(childName).first, DDSplit(childName).second);
+  DDTrackerEnvelopeCheck envelope("DDTrackerPhiAlgo", DDLogicalPart(mother));
   double theta  = 90.*CLHEP::deg;
   size_t i  = 0;
   int ci = startcn;
@@ -100,6 +102,7 @@ void DDTrackerPhiAlgo::execute(DDCompactView& cpv) {
     double ypos = radius*sin(phi[i]);
     DDTranslation tran(xpos, ypos, zpos[i]);
   
+    envelope.checkPart(DDLogicalPart(child), ci, tran, rotation);
    cpv.position(child, mother, ci, tran, rotation);
     LogDebug("TrackerGeom") << "DDTrackerPhiAlgo test: " << child << " number "
 			    << ci << " positioned in " << mother << " at "
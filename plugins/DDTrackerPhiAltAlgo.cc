@@ -11,6 +11,7 @@
 #include "DetectorDescription/Core/interface/DDCurrentNamespace.h"
 #include "DetectorDescription/Core/interface/DDSplit.h"
 #include "Geometry/TrackerCommonData/plugins/DDTrackerPhiAltAlgo.h"
+#include "Geometry/TrackerCommonData/plugins/DDTrackerEnvelopeCheck.h"
 #include "CLHEP/Units/GlobalPhysicalConstants.h"
 #include "CLHEP/Units/GlobalSystemOfUnits.h"
 
@@ -67,6 +68,8 @@ void DDTrackerPhiAltAlgo::execute(DDCompactView& cpv) {
 
     DDName mother = parent().name();
     DDName child(DDSplit(childName).first, DDSplit(childName).second);
+    DDTrackerEnvelopeCheck envelope("DDTrackerPhiAltAlgo",
+				    DDLogicalPart(mother));
     for (int i=0; i<number; i++) {
       double phi  = startAngle + i*dphi;
       double phix = phi - tilt + 90.*CLHEP::deg;
@@ -97,6 +100,7 @@ void DDTrackerPhiAltAlgo::execute(DDCompactView& cpv) {
       }
       DDTranslation tran(xpos, ypos, zpos);
   
+      envelope.checkPart(DDLogicalPart(child), copyNo, tran, rotation);
      cpv.position(child, mother, copyNo, tran, rotation);
       LogDebug("TrackerGeom") << "DDTrackerPhiAltAlgo test: " << child 
 			      << " number " << copyNo << " positioned in " 
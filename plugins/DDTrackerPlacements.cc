@@ -0,0 +1,33 @@
+///////////////////////////////////////////////////////////////////////////////
+// File: DDTrackerPlacements.cc
+// Description: Rotations shared by the tracker algorithms
+///////////////////////////////////////////////////////////////////////////////
+
+#include <cmath>
+#include <string>
+
+#include "FWCore/MessageLogger/interface/MessageLogger.h"
+#include "DetectorDescription/Base/interface/DDutils.h"
+#include "Geometry/TrackerCommonData/plugins/DDTrackerPlacements.h"
+#include "CLHEP/Units/GlobalPhysicalConstants.h"
+#include "CLHEP/Units/GlobalSystemOfUnits.h"
+
+DDRotation DDTrackerPlacements::phiRotation(double phi) {
+
+  int key = (int)(floor(phi/CLHEP::deg*1.e6+0.5)) % 360000000;
+  if (key < 0) key += 360000000;
+  if (key == 0) return DDRotation();
+
+  std::string rotstr = "Phi" + int_to_string(key);
+  DDRotation rotation = DDRotation(DDName(rotstr, "tracker"));
+  if (!rotation) {
+    double theta = 90.*CLHEP::deg;
+    LogDebug("TrackerGeom") << "DDTrackerPlacements: Creating a new "
+			    << "rotation: " << rotstr << "\t90., " 
+			    << phi/CLHEP::deg << ", 90.," 
+			    << phi/CLHEP::deg+90. << ", 0, 0";
+    rotation = DDrot(DDName(rotstr, "tracker"), theta, phi, theta, 
+		     phi+90.*CLHEP::deg, 0., 0.);
+  }
+  return rotation;
+}
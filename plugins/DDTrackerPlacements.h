@@ -0,0 +1,26 @@
+#ifndef DD_TrackerPlacements_h
+#define DD_TrackerPlacements_h
+
+/*
+
+  Helpers shared by the tracker algorithms when they position their
+  daughters. The volumes placed are not recorded here: the checks and
+  tables which need the placed volumes walk the finished compact view
+  (DDExpandedView) instead, so that the placements of the XML files are
+  seen as well as those of the algorithms.
+
+*/
+
+#include "DetectorDescription/Core/interface/DDTransform.h"
+
+class DDTrackerPlacements {
+
+public:
+
+  //Rotation (90, phi, 90, phi+90, 0, 0) placing a volume at phi about
+  //z, one per phi (to 1e-6 deg) shared by all the algorithms; the null
+  //rotation for phi = 0
+  static DDRotation phiRotation(double phi);
+};
+
+#endif
@@ -0,0 +1,119 @@
+#ifndef DD_TrackerPooledAlgo_h
+#define DD_TrackerPooledAlgo_h
+
+/*
+
+  Pooled factory path for the tracker algorithms invoked hundreds of
+  times in a build (DDTrackerAngularV1, DDTrackerAngular). The parser
+  creates, runs and deletes one algorithm per Algorithm block;
+  registered as
+
+    typedef DDTrackerPooledAlgo<DDTrackerAngular> DDTrackerAngularPooled;
+    DEFINE_EDM_PLUGIN (DDAlgorithmFactory, DDTrackerAngularPooled,
+                       "track:DDTrackerAngular");
+
+  the object created is only a forwarder, which takes an instance of the
+  algorithm from a free list of its type (made on first use) and gives
+  it back when deleted. The instances are therefore reused by all the
+  invocations of the algorithm, together with the capacity of their
+  strings and vectors. Before going back to the free list an instance is
+  reset by its reset() method, which clears its arguments but keeps
+  their storage; initialize() sets all of them again. The factory makes
+  the forwarder with new: its memory is recycled as well, through a free
+  list of blocks used by its operator new and delete.
+
+  Thread safety: the free lists are static, shared by all the builds of
+  the process, and every access to them holds the mutex of the pool. An
+  instance taken from a list belongs to one forwarder until it is given
+  back, so the algorithms themselves run unlocked.
+
+*/
+
+#include <cstddef>
+#include <new>
+#include <vector>
+#include <boost/thread/mutex.hpp>
+#include "DetectorDescription/Base/interface/DDTypes.h"
+#include "DetectorDescription/Algorithm/interface/DDAlgorithm.h"
+
+template <class T> class DDTrackerPooledAlgo : public DDAlgorithm {
+
+public:
+  //Constructor and Destructor
+  DDTrackerPooledAlgo() : algo_(take()) {}
+  virtual ~DDTrackerPooledAlgo() {
+    algo_->reset();
+    Pool & p = pool();
+    boost::mutex::scoped_lock lock(p.mutex);
+    p.free.push_back(algo_);
+  }
+
+  void initialize(const DDNumericArguments & nArgs,
+		  const DDVectorArguments & vArgs,
+		  const DDMapArguments & mArgs,
+		  const DDStringArguments & sArgs,
+		  const DDStringVectorArguments & vsArgs) {
+    algo_->setParent(parent());
+    algo_->initialize(nArgs, vArgs, mArgs, sArgs, vsArgs);
+  }
+
+  void execute(DDCompactView& cpv) {algo_->execute(cpv);}
+
+  static void* operator new(std::size_t size) {
+    if (size != sizeof(DDTrackerPooledAlgo)) return ::operator new(size);
+    Pool & p = pool();
+    boost::mutex::scoped_lock lock(p.mutex);
+    if (p.blocks.empty()) return ::operator new(size);
+    void* block = p.blocks.back();
+    p.blocks.pop_back();
+    return block;
+  }
+
+  static void operator delete(void* block, std::size_t size) {
+    if (block == 0) return;
+    if (size != sizeof(DDTrackerPooledAlgo)) {
+      ::operator delete(block);
+    } else {
+      Pool & p = pool();
+      boost::mutex::scoped_lock lock(p.mutex);
+      p.blocks.push_back(block);
+    }
+  }
+
+private:
+
+  DDTrackerPooledAlgo(const DDTrackerPooledAlgo &);
+  const DDTrackerPooledAlgo & operator=(const DDTrackerPooledAlgo &);
+
+  struct Pool {
+    std::vector<T*>    free;
+    std::vector<void*> blocks;   //Memory of deleted forwarders
+    boost::mutex       mutex;    //Guards free and blocks
+    ~Pool() {
+      for (unsigned int i=0; i<free.size(); i++) delete free[i];
+      for (unsigned int i=0; i<blocks.size(); i++) ::operator delete(blocks[i]);
+    }
+  };
+
+  static Pool & pool() {
+    static Pool thePool;
+    return thePool;
+  }
+
+  static T* take() {
+    Pool & p = pool();
+    {
+      boost::mutex::scoped_lock lock(p.mutex);
+      if (!p.free.empty()) {
+	T* algo = p.free.back();
+	p.free.pop_back();
+	return algo;
+      }
+    }
+    return new T();
+  }
+
+  T* algo_;
+};
+
+#endif
@@ -0,0 +1,47 @@
+///////////////////////////////////////////////////////////////////////////////
+// File: DDTrackerSensorExport.cc
+// Description: Write the sensor surface table of the placed sensors
+///////////////////////////////////////////////////////////////////////////////
+
+#include "FWCore/MessageLogger/interface/MessageLogger.h"
+#include "DetectorDescription/Core/interface/DDSplit.h"
+#include "Geometry/TrackerCommonData/plugins/DDTrackerSensorExport.h"
+#include "Geometry/TrackerCommonData/plugins/DDTrackerSensorTable.h"
+#include "Geometry/TrackerCommonData/interface/DDTrackerTransformCache.h"
+
+
+DDTrackerSensorExport::DDTrackerSensorExport() {
+  LogDebug("TrackerGeom") <<"DDTrackerSensorExport info: Creating an instance";
+}
+
+DDTrackerSensorExport::~DDTrackerSensorExport() {}
+
+void DDTrackerSensorExport::initialize(const DDNumericArguments & ,
+				       const DDVectorArguments & ,
+				       const DDMapArguments & ,
+				       const DDStringArguments & sArgs,
+				       const DDStringVectorArguments & vsArgs) {
+
+  fileName = sArgs["File"];
+  if (vsArgs.find("Roots") != vsArgs.end()) roots = vsArgs["Roots"];
+  if (roots.empty()) roots.push_back(parent().name().fullname());
+
+  LogDebug("TrackerGeom") << "DDTrackerSensorExport debug: Parent "
+			  << parent().name() << " File " << fileName
+			  << " with " << roots.size() << " roots";
+  for (unsigned int i=0; i<roots.size(); i++)
+    LogDebug("TrackerGeom") << "\troots[" << i << "] = " << roots[i];
+}
+
+void DDTrackerSensorExport::execute(DDCompactView& cpv) {
+
+  DDTrackerSensorTable & table = DDTrackerSensorTable::instance();
+  if (table.sensors().empty())
+    edm::LogWarning("TrackerGeom") << "DDTrackerSensorExport: no sensor type "
+				   << "was recorded by the algorithms";
+  for (unsigned int i=0; i<roots.size(); i++) {
+    DDName root(DDSplit(roots[i]).first, DDSplit(roots[i]).second);
+    table.compose(DDTrackerTransformCache::shared(cpv, root));
+  }
+  table.write(fileName);
+}
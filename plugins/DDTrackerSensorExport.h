@@ -0,0 +1,47 @@
+#ifndef DD_TrackerSensorExport_h
+#define DD_TrackerSensorExport_h
+
+/*
+
+  Fills the sensor surface table (DDTrackerSensorTable) with the sensors
+  placed below the given roots (default: the parent) and writes it to a
+  flat binary file (data/trackerSensors.xml). The sensor types are those
+  recorded by the module, layer and rod algorithms when they ran; their
+  instances are taken from the transform cache of each root shared by
+  the post-build steps (DDTrackerTransformCache::shared), so it must
+  come after all the files which place the sensors:
+
+    <Algorithm name="track:DDTrackerSensorExport">
+      <rParent name="tracker:Tracker"/>
+      <String name="File" value="TrackerSensors.bin"/>
+    </Algorithm>
+
+*/
+
+#include <map>
+#include <string>
+#include <vector>
+#include "DetectorDescription/Base/interface/DDTypes.h"
+#include "DetectorDescription/Algorithm/interface/DDAlgorithm.h"
+
+class DDTrackerSensorExport : public DDAlgorithm {
+ public:
+  //Constructor and Destructor
+  DDTrackerSensorExport();
+  virtual ~DDTrackerSensorExport();
+
+  void initialize(const DDNumericArguments & nArgs,
+		  const DDVectorArguments & vArgs,
+		  const DDMapArguments & mArgs,
+		  const DDStringArguments & sArgs,
+		  const DDStringVectorArguments & vsArgs);
+
+  void execute(DDCompactView& cpv);
+
+private:
+
+  std::vector<std::string> roots;        //Volumes below which to look
+  std::string              fileName;     //Output file
+};
+
+#endif
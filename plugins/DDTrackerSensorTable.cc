@@ -0,0 +1,197 @@
+///////////////////////////////////////////////////////////////////////////////
+// File: DDTrackerSensorTable.cc
+// Description: Structure of arrays of the silicon sensor surfaces
+///////////////////////////////////////////////////////////////////////////////
+
+#include <algorithm>
+#include <fstream>
+#include <set>
+
+#include "FWCore/MessageLogger/interface/MessageLogger.h"
+#include "DetectorDescription/Core/interface/DDCompactView.h"
+#include "DetectorDescription/Core/interface/DDSolid.h"
+#include "Geometry/TrackerCommonData/plugins/DDTrackerSensorTable.h"
+#include "Geometry/TrackerCommonData/interface/DDTrackerTransformCache.h"
+
+namespace {
+
+  const unsigned int version = 1;
+
+  void writeUInt(std::ofstream & out, unsigned int value) {
+    out.write(reinterpret_cast<const char*>(&value), sizeof(value));
+  }
+
+  void pad(std::ofstream & out, unsigned int & offset) {
+    static const char zero[8] = {0, 0, 0, 0, 0, 0, 0, 0};
+    unsigned int n = (8 - offset%8)%8;
+    out.write(zero, n);
+    offset += n;
+  }
+}
+
+DDTrackerSensorTable & DDTrackerSensorTable::instance() {
+  static DDTrackerSensorTable table;
+  return table;
+}
+
+bool DDTrackerSensorTable::defineSensor(const DDLogicalPart & active) {
+
+  if (index_.find(active.ddname()) != index_.end()) return true;
+  const DDSolid & solid = active.solid();
+  Sensor sensor;
+  sensor.name = active.ddname();
+  if (solid.shape() == ddtrap) {
+    DDTrap trap(solid);
+    sensor.axis[0] = 0;
+    sensor.axis[1] = 1;
+    sensor.axis[2] = 2;
+    sensor.halfU0  = std::max(trap.x1(), trap.x3());
+    sensor.halfU1  = std::max(trap.x2(), trap.x4());
+    sensor.halfV   = std::max(trap.y1(), trap.y2());
+    sensor.halfW   = trap.halfZ();
+  } else if (solid.shape() == ddbox) {
+    DDBox box(solid);
+    double h[3] = {box.halfX(), box.halfY(), box.halfZ()};
+    int    w    = (int)(std::min_element(h, h+3) - h);
+    sensor.axis[0] = (w+1)%3;
+    sensor.axis[1] = (w+2)%3;
+    sensor.axis[2] = w;
+    sensor.halfU0  = h[sensor.axis[0]];
+    sensor.halfU1  = h[sensor.axis[0]];
+    sensor.halfV   = h[sensor.axis[1]];
+    sensor.halfW   = h[w];
+  } else {
+    edm::LogWarning("TrackerGeom") << "DDTrackerSensorTable: " << sensor.name
+				   << " is neither a box nor a trap and is "
+				   << "not registered as a sensor";
+    return false;
+  }
+  index_[sensor.name] = (int)(sensors_.size());
+  sensors_.push_back(sensor);
+  LogDebug("TrackerGeom") << "DDTrackerSensorTable: sensor type "
+			  << sensors_.size()-1 << " " << sensor.name
+			  << " half widths " << sensor.halfU0 << "/"
+			  << sensor.halfU1 << ", " << sensor.halfV << ", "
+			  << sensor.halfW;
+  return true;
+}
+
+int DDTrackerSensorTable::defineModule(const DDCompactView & cpv,
+				       const DDLogicalPart & module) {
+
+  typedef DDCompactView::graph_type Graph;
+  const Graph & graph = cpv.graph();
+  int n = 0;
+  std::set<DDName> seen;
+  std::vector<DDLogicalPart> stack(1, module);
+  while (!stack.empty()) {
+    DDLogicalPart part = stack.back();
+    stack.pop_back();
+    if (!seen.insert(part.ddname()).second) continue;
+    if (part.ddname().name().find("Active") != std::string::npos) {
+      if (defineSensor(part)) n++;
+      continue;
+    }
+    Graph::index_type index;
+    if (!graph.nodeIndex(part, index)) continue;
+    const Graph::edge_list & edges = graph.edges(index);
+    for (Graph::edge_list::const_iterator it=edges.begin(); it != edges.end();
+	 ++it)
+      stack.push_back(graph.nodeData(it->first));
+  }
+  if (n == 0)
+    edm::LogWarning("TrackerGeom") << "DDTrackerSensorTable: no active volume "
+				   << "below " << module.ddname();
+  return n;
+}
+
+int DDTrackerSensorTable::compose(const DDTrackerTransformCache & cache) {
+
+  std::vector<int> nodes, types;
+  for (int i=0; i<cache.nodes(); i++) {
+    std::map<DDName, int>::const_iterator type = index_.find(cache.part(i));
+    if (type == index_.end()) continue;
+    nodes.push_back(i);
+    types.push_back(type->second);
+  }
+
+  int first = rows();
+  int n     = (int)(types.size());
+  if (n == 0) return 0;
+  for (int c=0; c<NColumns; c++) column_[c].resize(first+n);
+  double* col[NColumns];
+  for (int c=0; c<NColumns; c++) col[c] = &(column_[c][0]) + first;
+
+  //Centres and axes of all the new rows: column k of the rotation is
+  //the solid axis k in the global frame
+  for (int i=0; i<n; i++) {
+    const double* t = cache.global(nodes[i]);
+    const Sensor & s = sensors_[types[i]];
+    int u = s.axis[0], v = s.axis[1], w = s.axis[2];
+    col[Type][i]    = types[i];
+    col[Copy][i]    = cache.copyNo(nodes[i]);
+    col[CenterX][i] = t[3];
+    col[CenterY][i] = t[7];
+    col[CenterZ][i] = t[11];
+    col[UX][i]      = t[u];
+    col[UY][i]      = t[4+u];
+    col[UZ][i]      = t[8+u];
+    col[VX][i]      = t[v];
+    col[VY][i]      = t[4+v];
+    col[VZ][i]      = t[8+v];
+    col[NormalX][i] = t[w];
+    col[NormalY][i] = t[4+w];
+    col[NormalZ][i] = t[8+w];
+    col[HalfU0][i]  = s.halfU0;
+    col[HalfU1][i]  = s.halfU1;
+    col[HalfV][i]   = s.halfV;
+    col[HalfW][i]   = s.halfW;
+  }
+
+  LogDebug("TrackerGeom") << "DDTrackerSensorTable: " << n << " sensors below "
+			  << cache.root() << " (" << rows() << " in total)";
+  return n;
+}
+
+bool DDTrackerSensorTable::write(const std::string & file) const {
+
+  std::ofstream out(file.c_str(), std::ios::out | std::ios::binary);
+  if (!out) {
+    edm::LogError("TrackerGeom") << "DDTrackerSensorTable: cannot open "
+				 << file;
+    return false;
+  }
+
+  unsigned int nrow   = (unsigned int)(rows());
+  unsigned int header = 8 + sizeof(unsigned int)*(4+NColumns+1);
+  header += (8 - header%8)%8;
+  out.write("TKSENS01", 8);
+  writeUInt(out, version);
+  writeUInt(out, nrow);
+  writeUInt(out, NColumns);
+  writeUInt(out, (unsigned int)(sensors_.size()));
+  for (int c=0; c<NColumns; c++) writeUInt(out, header+c*nrow*sizeof(double));
+  writeUInt(out, header+NColumns*nrow*sizeof(double));
+  unsigned int offset = 8 + sizeof(unsigned int)*(4+NColumns+1);
+  pad(out, offset);
+
+  for (int c=0; c<NColumns; c++)
+    if (nrow > 0)
+      out.write(reinterpret_cast<const char*>(&column_[c][0]),
+		nrow*sizeof(double));
+  for (unsigned int i=0; i<sensors_.size(); i++) {
+    const std::string & name = sensors_[i].name.fullname();
+    out.write(name.c_str(), name.size()+1);
+  }
+
+  LogDebug("TrackerGeom") << "DDTrackerSensorTable: " << nrow << " sensors of "
+			  << sensors_.size() << " types written to " << file;
+  return out.good();
+}
+
+void DDTrackerSensorTable::clear() {
+
+  sensors_.clear();
+  index_.clear();
+  for (int c=0; c<NColumns; c++) column_[c].clear();
+}
@@ -0,0 +1,90 @@
+#ifndef DD_TrackerSensorTable_h
+#define DD_TrackerSensorTable_h
+
+/*
+
+  Table of the silicon sensor surfaces. The sensor types are recorded
+  by the algorithms when they make or place the modules: the module
+  algorithms which make the active volumes (DDTECModuleAlgo,
+  DDTIDModuleAlgo, DDTrackerStackedModuleAlgo) define them directly
+  (defineSensor), and the algorithms which place modules made in the
+  XML files (DDTIBLayerAlgo, DDTOBRodAlgo, DDPixBarLayerAlgo) define the
+  active volumes found below the module in the compact view
+  (defineModule): these are named ...Active... in all the tracker XML
+  files. The surface is described in the frame of the active solid by
+  the axes u, v and the normal w, the half widths along them and, for
+  trapezoids, the half width in u at -v and +v. For a DDTrap the normal
+  is the z axis and v its y axis; for a box the normal is the thinnest
+  axis and (u, v, w) is a cyclic permutation of (x, y, z).
+
+  compose(cache) adds one row per instance of a sensor type among the
+  volumes of a transform cache (DDTrackerTransformCache), with the
+  global transformation of the sensor. The centres and axes are
+  computed in a single pass over contiguous arrays. The
+  rows are kept as a structure of arrays (one vector per column) and
+  can be written to a flat binary file (write) which can be mapped in
+  memory as it is. clear() forgets the sensor types as well as the rows
+  (end of the build):
+
+    header      : char magic[8] = "TKSENS01", unsigned int version,
+                  rows, columns, types, then the byte offset of every
+                  column and of the type names (unsigned int each)
+    columns     : rows doubles each, 8-byte aligned, in the order of
+                  Column below (type and copy are stored as doubles)
+    type names  : null terminated names of the active volumes
+
+*/
+
+#include <map>
+#include <string>
+#include <vector>
+#include "DetectorDescription/Core/interface/DDName.h"
+#include "DetectorDescription/Core/interface/DDLogicalPart.h"
+
+class DDCompactView;
+class DDTrackerTransformCache;
+
+class DDTrackerSensorTable {
+
+public:
+
+  enum Column { Type, Copy, CenterX, CenterY, CenterZ, NormalX, NormalY,
+		NormalZ, UX, UY, UZ, VX, VY, VZ, HalfU0, HalfU1, HalfV,
+		HalfW, NColumns };
+
+  struct Sensor {
+    DDName name;          //Active volume
+    int    axis[3];       //Solid axes along u, v and w
+    double halfU0;        //Half width in u at -v
+    double halfU1;        //Half width in u at +v
+    double halfV;         //Half width in v
+    double halfW;         //Half thickness
+  };
+
+  static DDTrackerSensorTable & instance();
+
+  //Registers an active volume (box or trap) as a sensor type
+  bool defineSensor(const DDLogicalPart & active);
+  //Registers the active volumes below a module of the compact view;
+  //returns the number of them
+  int  defineModule(const DDCompactView & cpv, const DDLogicalPart & module);
+
+  //Adds the sensors of the cache; returns the number of rows added
+  int  compose(const DDTrackerTransformCache & cache);
+  bool write(const std::string & file) const;
+  void clear();
+
+  const std::vector<Sensor> & sensors() const {return sensors_;}
+  int                         rows()    const {return (int)(column_[Type].size());}
+  const std::vector<double> & column(Column c) const {return column_[c];}
+
+private:
+
+  DDTrackerSensorTable() {}
+
+  std::vector<Sensor>     sensors_;
+  std::map<DDName, int>   index_;        //Sensor type of an active volume
+  std::vector<double>     column_[NColumns];
+};
+
+#endif
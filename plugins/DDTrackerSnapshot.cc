@@ -0,0 +1,785 @@
+///////////////////////////////////////////////////////////////////////////////
+// File: DDTrackerSnapshot.cc
+// Description: Read-only binary snapshot of a compiled subdetector
+///////////////////////////////////////////////////////////////////////////////
+
+#include <cmath>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <set>
+#include <map>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+#include "FWCore/MessageLogger/interface/MessageLogger.h"
+#include "DetectorDescription/Core/interface/DDCompactView.h"
+#include "DetectorDescription/Core/interface/DDLogicalPart.h"
+#include "DetectorDescription/Core/interface/DDMaterial.h"
+#include "DetectorDescription/Core/interface/DDSolid.h"
+#include "DetectorDescription/Core/interface/DDSplit.h"
+#include "Geometry/TrackerCommonData/plugins/DDTrackerSnapshot.h"
+#include "Geometry/TrackerCommonData/interface/DDTrackerSpecParMatcher.h"
+#include "Geometry/TrackerCommonData/interface/DDTrackerTransformCache.h"
+
+namespace {
+
+  const char         magic[8] = {'T', 'K', 'S', 'N', 'A', 'P', '0', '2'};
+  const unsigned int version  = 2;
+
+  struct Builder {
+
+    unsigned int intern(const std::string & name) {
+      std::map<std::string, unsigned int>::const_iterator it = stringIndex.find(name);
+      if (it != stringIndex.end()) return it->second;
+      unsigned int n = strings.size();
+      stringIndex[name] = n;
+      strings.push_back(name);
+      return n;
+    }
+
+    int addMaterial(const DDMaterial & material) {
+      if (!material.isDefined().second) return -1;
+      std::map<DDName, int>::const_iterator it = materialIndex.find(material.ddname());
+      if (it != materialIndex.end()) return it->second;
+      //Constituents first, so that they are made before the mixture
+      std::vector<DDTrackerSnapshot::Constituent> parts;
+      for (int i=0; i<material.noOfConstituents(); i++) {
+	std::pair<DDMaterial,double> c = material.constituent(i);
+	DDTrackerSnapshot::Constituent part;
+	part.material = addMaterial(c.first);
+	part.pad      = 0;
+	part.fraction = c.second;
+	parts.push_back(part);
+      }
+      DDTrackerSnapshot::Material m;
+      m.name             = intern(material.ddname().fullname());
+      m.firstConstituent = constituents.size();
+      m.nConstituents    = parts.size();
+      m.pad              = 0;
+      m.density          = material.density();
+      m.z                = parts.empty() ? material.z() : 0;
+      m.a                = parts.empty() ? material.a() : 0;
+      constituents.insert(constituents.end(), parts.begin(), parts.end());
+      materialIndex[material.ddname()] = (int)(materials.size());
+      materials.push_back(m);
+      return (int)(materials.size()) - 1;
+    }
+
+    void addSections(std::vector<double> & values, const std::vector<double> & z,
+		     const std::vector<double> & r1,
+		     const std::vector<double> & r2) {
+      values.push_back(z.size());
+      values.insert(values.end(), z.begin(), z.end());
+      values.insert(values.end(), r1.begin(), r1.end());
+      values.insert(values.end(), r2.begin(), r2.end());
+    }
+
+    int addSolid(const DDSolid & solid) {
+      if (!solid.isDefined().second) return -1;
+      std::map<DDName, int>::const_iterator it = solidIndex.find(solid.ddname());
+      if (it != solidIndex.end()) return it->second;
+      DDTrackerSnapshot::Solid s;
+      s.shape  = (int)(solid.shape());
+      s.solidA = -1;
+      s.solidB = -1;
+      std::vector<double> values;
+      switch (solid.shape()) {
+      case ddbox: {
+	DDBox box(solid);
+	values.push_back(box.halfX());
+	values.push_back(box.halfY());
+	values.push_back(box.halfZ());
+	break;
+      }
+      case ddtubs: {
+	DDTubs tubs(solid);
+	values.push_back(tubs.zhalf());
+	values.push_back(tubs.rIn());
+	values.push_back(tubs.rOut());
+	values.push_back(tubs.startPhi());
+	values.push_back(tubs.deltaPhi());
+	break;
+      }
+      case ddcons: {
+	DDCons cons(solid);
+	values.push_back(cons.zhalf());
+	values.push_back(cons.rInMinusZ());
+	values.push_back(cons.rOutMinusZ());
+	values.push_back(cons.rInPlusZ());
+	values.push_back(cons.rOutPlusZ());
+	values.push_back(cons.phiFrom());
+	values.push_back(cons.deltaPhi());
+	break;
+      }
+      case ddtrap: {
+	DDTrap trap(solid);
+	values.push_back(trap.halfZ());
+	values.push_back(trap.theta());
+	values.push_back(trap.phi());
+	values.push_back(trap.y1());
+	values.push_back(trap.x1());
+	values.push_back(trap.x2());
+	values.push_back(trap.alpha1());
+	values.push_back(trap.y2());
+	values.push_back(trap.x3());
+	values.push_back(trap.x4());
+	values.push_back(trap.alpha2());
+	break;
+      }
+      case ddpseudotrap: {
+	DDPseudoTrap trap(solid);
+	values.push_back(trap.x1());
+	values.push_back(trap.x2());
+	values.push_back(trap.y1());
+	values.push_back(trap.y2());
+	values.push_back(trap.halfZ());
+	values.push_back(trap.radius());
+	values.push_back(trap.atMinusZ() ? 1 : 0);
+	break;
+      }
+      case ddtorus: {
+	DDTorus torus(solid);
+	values.push_back(torus.rMin());
+	values.push_back(torus.rMax());
+	values.push_back(torus.rTorus());
+	values.push_back(torus.startPhi());
+	values.push_back(torus.deltaPhi());
+	break;
+      }
+      case ddpolycone_rrz:
+      case ddpolycone_rz: {
+	DDPolycone pcon(solid);
+	values.push_back(pcon.startPhi());
+	values.push_back(pcon.deltaPhi());
+	if (solid.shape() == ddpolycone_rrz)
+	  addSections(values, pcon.zVec(), pcon.rMinVec(), pcon.rMaxVec());
+	else
+	  addSections(values, pcon.zVec(), pcon.rVec(), std::vector<double>());
+	break;
+      }
+      case ddpolyhedra_rrz:
+      case ddpolyhedra_rz: {
+	DDPolyhedra phed(solid);
+	values.push_back(phed.sides());
+	values.push_back(phed.startPhi());
+	values.push_back(phed.deltaPhi());
+	if (solid.shape() == ddpolyhedra_rrz)
+	  addSections(values, phed.zVec(), phed.rMinVec(), phed.rMaxVec());
+	else
+	  addSections(values, phed.zVec(), phed.rVec(), std::vector<double>());
+	break;
+      }
+      case ddunion:
+      case ddsubtraction:
+      case ddintersection: {
+	DDBooleanSolid bs(solid);
+	s.solidA = addSolid(bs.solidA());
+	s.solidB = addSolid(bs.solidB());
+	DDTranslation tran = bs.translation();
+	values.push_back(tran.x());
+	values.push_back(tran.y());
+	values.push_back(tran.z());
+	DDRotation rot = bs.rotation();
+	const DDRotationMatrix* matrix = rot ? rot.rotation() : 0;
+	double r[9];
+	(matrix ? *matrix : DDRotationMatrix()).GetComponents(r);
+	values.insert(values.end(), r, r+9);
+	break;
+      }
+      default: {
+	const std::vector<double> & par = solid.parameters();
+	values.insert(values.end(), par.begin(), par.end());
+	break;
+      }
+      }
+      s.name       = intern(solid.ddname().fullname());
+      s.firstParam = params.size();
+      s.nParams    = values.size();
+      params.insert(params.end(), values.begin(), values.end());
+      solidIndex[solid.ddname()] = (int)(solids.size());
+      solids.push_back(s);
+      return (int)(solids.size()) - 1;
+    }
+
+    int addRotation(const DDRotationMatrix & rot) {
+      double r[9];
+      rot.GetComponents(r);
+      std::vector<double> key(r, r+9);
+      std::map<std::vector<double>, int>::const_iterator it = rotationIndex.find(key);
+      if (it != rotationIndex.end()) return it->second;
+      int n = (int)(rotations.size()/9);
+      rotationIndex[key] = n;
+      rotations.insert(rotations.end(), r, r+9);
+      return n;
+    }
+
+    std::vector<std::string>             strings;
+    std::map<std::string, unsigned int>  stringIndex;
+    std::vector<DDTrackerSnapshot::Material> materials;
+    std::vector<DDTrackerSnapshot::Constituent> constituents;
+    std::map<DDName, int>                materialIndex;
+    std::vector<DDTrackerSnapshot::Solid> solids;
+    std::map<DDName, int>                solidIndex;
+    std::vector<double>                  params;
+    std::vector<double>                  rotations;
+    std::map<std::vector<double>, int>   rotationIndex;
+  };
+
+  unsigned int align(unsigned int offset) {
+    return offset + (8 - offset%8)%8;
+  }
+
+  void writeBlock(std::ofstream & out, const void* data, unsigned int size,
+		  unsigned int & offset) {
+    static const char zero[8] = {0, 0, 0, 0, 0, 0, 0, 0};
+    if (size > 0) out.write(reinterpret_cast<const char*>(data), size);
+    offset += size;
+    unsigned int n = align(offset) - offset;
+    out.write(zero, n);
+    offset += n;
+  }
+
+  //Section of n records of the given size within the mapped file
+  bool inside(unsigned int offset, unsigned int n, unsigned int size,
+	      unsigned long total) {
+    return (offset%8 == 0 && offset <= total &&
+	    (unsigned long)(n) <= (total-offset)/size);
+  }
+
+  bool identity(const double* r) {
+    static const double tol = 1.e-12;
+    for (int k=0; k<9; k++)
+      if (std::abs(r[k] - ((k%4 == 0) ? 1. : 0.)) > tol) return false;
+    return true;
+  }
+
+  DDName splitName(const char* fullname) {
+    std::pair<std::string,std::string> names = DDSplit(std::string(fullname));
+    return DDName(names.first, names.second);
+  }
+
+  //Parameters p[0 ... n) are those of a solid of this shape
+  bool shapeParams(int shape, const double* p, unsigned int n) {
+    switch ((DDSolidShape)(shape)) {
+    case ddbox:           return n == 3;
+    case ddtubs:          return n == 5;
+    case ddcons:          return n == 7;
+    case ddtrap:          return n == 11;
+    case ddpseudotrap:    return n == 7;
+    case ddtorus:         return n == 5;
+    case ddunion:
+    case ddsubtraction:
+    case ddintersection:  return n == 12;
+    case ddpolycone_rrz:  return n >= 3 && p[2] >= 0 && p[2] <= n && n == 3+3*(unsigned int)(p[2]);
+    case ddpolycone_rz:   return n >= 3 && p[2] >= 0 && p[2] <= n && n == 3+2*(unsigned int)(p[2]);
+    case ddpolyhedra_rrz: return n >= 4 && p[3] >= 0 && p[3] <= n && n == 4+3*(unsigned int)(p[3]);
+    case ddpolyhedra_rz:  return n >= 4 && p[3] >= 0 && p[3] <= n && n == 4+2*(unsigned int)(p[3]);
+    default:              return true;
+    }
+  }
+
+  //One anonymous rotation per distinct matrix
+  DDRotation makeRotation(const double* r,
+			  std::map<std::vector<double>, DDRotation> & made) {
+    if (identity(r)) return DDRotation();
+    std::vector<double> key(r, r+9);
+    std::map<std::vector<double>, DDRotation>::const_iterator it = made.find(key);
+    if (it != made.end()) return it->second;
+    DDRotation rot = DDanonymousRot(new DDRotationMatrix(r[0], r[1], r[2], r[3],
+							 r[4], r[5], r[6], r[7],
+							 r[8]));
+    made[key] = rot;
+    return rot;
+  }
+}
+
+unsigned int DDTrackerSnapshot::formatVersion() {
+  return version;
+}
+
+std::string DDTrackerSnapshot::path(const std::string & file) {
+
+  std::string result;
+  std::string::size_type pos = 0;
+  while (pos < file.size()) {
+    std::string::size_type open = file.find("${", pos);
+    std::string::size_type end  = (open == std::string::npos) ?
+      std::string::npos : file.find('}', open);
+    if (end == std::string::npos) {
+      result += file.substr(pos);
+      break;
+    }
+    result += file.substr(pos, open-pos);
+    const char* value = getenv(file.substr(open+2, end-open-2).c_str());
+    if (value) result += value;
+    pos = end+1;
+  }
+  return result;
+}
+
+bool DDTrackerSnapshot::write(const DDCompactView & cpv, const DDName & root,
+			      const std::string & file,
+			      const std::vector<std::string> & specParFiles) {
+
+  //Expanded tree below the root in depth first order
+  const DDTrackerTransformCache & cache =
+    DDTrackerTransformCache::shared(cpv, root);
+  if (cache.nodes() == 0) {
+    edm::LogError("TrackerGeom") << "DDTrackerSnapshot: " << root
+				 << " not found in the compact view";
+    return false;
+  }
+  Builder                  builder;
+  std::vector<Node>        nodes;
+  std::vector<int>         parents;
+  std::vector<std::string> names;
+  for (int i=0; i<cache.nodes(); i++) {
+    DDLogicalPart part(cache.part(i));
+    DDRotationMatrix rot;
+    DDTranslation    tran;
+    DDTrackerTransformCache::transform(cache.global(i), rot, tran);
+    Node node;
+    node.parent   = cache.parent(i);
+    node.name     = builder.intern(part.ddname().fullname());
+    node.solid    = builder.addSolid(part.solid());
+    node.material = builder.addMaterial(part.material());
+    node.copyNo   = cache.copyNo(i);
+    node.rotation = builder.addRotation(rot);
+    node.translation[0] = tran.x();
+    node.translation[1] = tran.y();
+    node.translation[2] = tran.z();
+    nodes.push_back(node);
+    parents.push_back(node.parent);
+    names.push_back(part.ddname().fullname());
+  }
+
+  //SpecPars and the nodes they select
+  DDTrackerSpecParMatcher matcher;
+  for (unsigned int i=0; i<specParFiles.size(); i++)
+    matcher.readFile(specParFiles[i]);
+  matcher.compile();
+  std::vector<int> offsets, ids;
+  matcher.match(parents, names, offsets, ids);
+  matcher.report(ids);
+  const std::vector<DDTrackerSpecParMatcher::SpecPar> & specs = matcher.specPars();
+  std::vector<std::vector<int> > selected(specs.size());
+  for (unsigned int i=0; i+1<offsets.size(); i++)
+    for (int k=offsets[i]; k<offsets[i+1]; k++) selected[ids[k]].push_back(i);
+  std::vector<SpecPar>   specPars;
+  std::vector<SpecParam> specParams;
+  std::vector<int>       matches;
+  for (unsigned int s=0; s<specs.size(); s++) {
+    SpecPar sp;
+    sp.name       = builder.intern(specs[s].name);
+    sp.firstParam = specParams.size();
+    sp.nParams    = specs[s].parameters.size();
+    sp.firstMatch = matches.size();
+    sp.nMatches   = selected[s].size();
+    sp.pad        = 0;
+    for (unsigned int k=0; k<specs[s].parameters.size(); k++) {
+      SpecParam par;
+      par.name  = builder.intern(specs[s].parameters[k].first);
+      par.value = builder.intern(specs[s].parameters[k].second);
+      specParams.push_back(par);
+    }
+    matches.insert(matches.end(), selected[s].begin(), selected[s].end());
+    specPars.push_back(sp);
+  }
+  unsigned int rootName = builder.intern(root.fullname());
+
+  //String table
+  std::vector<unsigned int> strOffsets(1, 0);
+  std::string chars;
+  for (unsigned int i=0; i<builder.strings.size(); i++) {
+    chars += builder.strings[i];
+    chars += '\0';
+    strOffsets.push_back(chars.size());
+  }
+
+  Header header;
+  std::memset(&header, 0, sizeof(header));
+  std::memcpy(header.magic, magic, 8);
+  header.version         = version;
+  header.nStrings        = builder.strings.size();
+  header.nMaterials      = builder.materials.size();
+  header.nConstituents   = builder.constituents.size();
+  header.nSolids         = builder.solids.size();
+  header.nParams         = builder.params.size();
+  header.nRotations      = builder.rotations.size()/9;
+  header.nNodes          = nodes.size();
+  header.nSpecPars       = specPars.size();
+  header.nSpecParams     = specParams.size();
+  header.nMatches        = matches.size();
+  header.offStrings      = align(sizeof(Header));
+  header.offChars        = align(header.offStrings + strOffsets.size()*sizeof(unsigned int));
+  header.offMaterials    = align(header.offChars + chars.size());
+  header.offConstituents = align(header.offMaterials + header.nMaterials*sizeof(Material));
+  header.offSolids       = align(header.offConstituents + header.nConstituents*sizeof(Constituent));
+  header.offParams       = align(header.offSolids + header.nSolids*sizeof(Solid));
+  header.offRotations    = align(header.offParams + header.nParams*sizeof(double));
+  header.offNodes        = align(header.offRotations + 9*header.nRotations*sizeof(double));
+  header.offSpecPars     = align(header.offNodes + header.nNodes*sizeof(Node));
+  header.offSpecParams   = align(header.offSpecPars + header.nSpecPars*sizeof(SpecPar));
+  header.offMatches      = align(header.offSpecParams + header.nSpecParams*sizeof(SpecParam));
+  header.size            = align(header.offMatches + header.nMatches*sizeof(int));
+  header.root            = rootName;
+
+  std::ofstream out(file.c_str(), std::ios::out | std::ios::binary);
+  if (!out) {
+    edm::LogError("TrackerGeom") << "DDTrackerSnapshot: cannot open " << file;
+    return false;
+  }
+  unsigned int offset = 0;
+  writeBlock(out, &header, sizeof(header), offset);
+  writeBlock(out, &strOffsets[0], strOffsets.size()*sizeof(unsigned int), offset);
+  writeBlock(out, chars.data(), chars.size(), offset);
+  writeBlock(out, builder.materials.empty() ? 0 : &builder.materials[0],
+	     header.nMaterials*sizeof(Material), offset);
+  writeBlock(out, builder.constituents.empty() ? 0 : &builder.constituents[0],
+	     header.nConstituents*sizeof(Constituent), offset);
+  writeBlock(out, builder.solids.empty() ? 0 : &builder.solids[0],
+	     header.nSolids*sizeof(Solid), offset);
+  writeBlock(out, builder.params.empty() ? 0 : &builder.params[0],
+	     header.nParams*sizeof(double), offset);
+  writeBlock(out, builder.rotations.empty() ? 0 : &builder.rotations[0],
+	     9*header.nRotations*sizeof(double), offset);
+  writeBlock(out, nodes.empty() ? 0 : &nodes[0], header.nNodes*sizeof(Node),
+	     offset);
+  writeBlock(out, specPars.empty() ? 0 : &specPars[0],
+	     header.nSpecPars*sizeof(SpecPar), offset);
+  writeBlock(out, specParams.empty() ? 0 : &specParams[0],
+	     header.nSpecParams*sizeof(SpecParam), offset);
+  writeBlock(out, matches.empty() ? 0 : &matches[0],
+	     header.nMatches*sizeof(int), offset);
+
+  LogDebug("TrackerGeom") << "DDTrackerSnapshot: " << header.nNodes
+			  << " nodes below " << root << ", "
+			  << header.nSolids << " solids, "
+			  << header.nMaterials << " materials, "
+			  << header.nRotations << " rotations and "
+			  << header.nSpecPars << " SpecPars written to " << file
+			  << " (" << offset << " bytes)";
+  return out.good() && offset == header.size;
+}
+
+DDTrackerSnapshot::DDTrackerSnapshot() : base_(0), size_(0), header_(0) {}
+
+DDTrackerSnapshot::~DDTrackerSnapshot() {
+  close();
+}
+
+bool DDTrackerSnapshot::open(const std::string & file) {
+
+  close();
+  int fd = ::open(file.c_str(), O_RDONLY);
+  if (fd < 0) {
+    edm::LogError("TrackerGeom") << "DDTrackerSnapshot: cannot open " << file;
+    return false;
+  }
+  struct stat st;
+  void* base = MAP_FAILED;
+  if (fstat(fd, &st) == 0 && st.st_size >= (off_t)(sizeof(Header)))
+    base = mmap(0, st.st_size, PROT_READ, MAP_SHARED, fd, 0);
+  ::close(fd);
+  if (base == MAP_FAILED) {
+    edm::LogError("TrackerGeom") << "DDTrackerSnapshot: cannot map " << file;
+    return false;
+  }
+
+  base_   = static_cast<const char*>(base);
+  size_   = st.st_size;
+  header_ = reinterpret_cast<const Header*>(base_);
+  if (std::memcmp(header_->magic, magic, 8) != 0 ||
+      header_->version != version || header_->size != size_) {
+    edm::LogError("TrackerGeom") << "DDTrackerSnapshot: " << file
+				 << " is not a snapshot of version "
+				 << version;
+    close();
+    return false;
+  }
+
+  //All the sections and strings must be within the file
+  const Header & h = *header_;
+  bool valid = (inside(h.offStrings, h.nStrings+1, sizeof(unsigned int), size_) &&
+		h.offChars >= h.offStrings + (h.nStrings+1)*sizeof(unsigned int) &&
+		h.offMaterials >= h.offChars && h.offMaterials <= size_ &&
+		inside(h.offMaterials, h.nMaterials, sizeof(Material), size_) &&
+		inside(h.offConstituents, h.nConstituents, sizeof(Constituent), size_) &&
+		inside(h.offSolids, h.nSolids, sizeof(Solid), size_) &&
+		inside(h.offParams, h.nParams, sizeof(double), size_) &&
+		inside(h.offRotations, h.nRotations, 9*sizeof(double), size_) &&
+		inside(h.offNodes, h.nNodes, sizeof(Node), size_) &&
+		inside(h.offSpecPars, h.nSpecPars, sizeof(SpecPar), size_) &&
+		inside(h.offSpecParams, h.nSpecParams, sizeof(SpecParam), size_) &&
+		inside(h.offMatches, h.nMatches, sizeof(int), size_) &&
+		h.root < h.nStrings);
+  if (valid) {
+    const unsigned int* strings = at<unsigned int>(h.offStrings);
+    unsigned int        nChars  = h.offMaterials - h.offChars;
+    valid = (strings[0] == 0 && strings[h.nStrings] <= nChars &&
+	     (h.nStrings == 0 || at<char>(h.offChars)[strings[h.nStrings]-1] == '\0'));
+    for (unsigned int i=0; valid && i<h.nStrings; i++)
+      valid = (strings[i] < strings[i+1]);
+  }
+  if (!valid) {
+    edm::LogError("TrackerGeom") << "DDTrackerSnapshot: " << file
+				 << " has sections outside the file";
+    close();
+    return false;
+  }
+  if (!checkRecords()) {
+    edm::LogError("TrackerGeom") << "DDTrackerSnapshot: " << file
+				 << " has records with indices out of range";
+    close();
+    return false;
+  }
+  LogDebug("TrackerGeom") << "DDTrackerSnapshot: " << file << " mapped with "
+			  << header_->nNodes << " nodes";
+  return true;
+}
+
+bool DDTrackerSnapshot::checkRecords() const {
+
+  //Every index refers to a record of its section; the constituents,
+  //operands and parents come before the records using them
+  const Header & h = *header_;
+  for (unsigned int i=0; i<h.nMaterials; i++) {
+    const Material & m = material(i);
+    if (m.name >= h.nStrings || m.firstConstituent > h.nConstituents ||
+	m.nConstituents > h.nConstituents-m.firstConstituent) return false;
+    for (unsigned int k=0; k<m.nConstituents; k++) {
+      int c = constituent(m.firstConstituent+k).material;
+      if (c < 0 || c >= (int)(i)) return false;
+    }
+  }
+  for (unsigned int i=0; i<h.nSolids; i++) {
+    const Solid & s = solid(i);
+    if (s.name >= h.nStrings || s.firstParam > h.nParams ||
+	s.nParams > h.nParams-s.firstParam ||
+	!shapeParams(s.shape, params()+s.firstParam, s.nParams)) return false;
+    bool boolean = (s.shape == ddunion || s.shape == ddsubtraction ||
+		    s.shape == ddintersection);
+    if (boolean && (s.solidA < 0 || s.solidA >= (int)(i) ||
+		    s.solidB < 0 || s.solidB >= (int)(i))) return false;
+  }
+  for (unsigned int i=0; i<h.nNodes; i++) {
+    const Node & nd = node(i);
+    if (nd.parent >= (int)(i) || (nd.parent < 0 && i > 0) ||
+	(nd.parent >= 0 && i == 0) || nd.name >= h.nStrings ||
+	nd.solid < -1 || nd.solid >= (int)(h.nSolids) ||
+	nd.material < -1 || nd.material >= (int)(h.nMaterials) ||
+	nd.rotation < 0 || nd.rotation >= (int)(h.nRotations)) return false;
+  }
+  for (unsigned int i=0; i<h.nSpecPars; i++) {
+    const SpecPar & sp = specPar(i);
+    if (sp.name >= h.nStrings || sp.firstParam > h.nSpecParams ||
+	sp.nParams > h.nSpecParams-sp.firstParam ||
+	sp.firstMatch > h.nMatches || sp.nMatches > h.nMatches-sp.firstMatch)
+      return false;
+  }
+  for (unsigned int i=0; i<h.nSpecParams; i++)
+    if (specParam(i).name >= h.nStrings || specParam(i).value >= h.nStrings)
+      return false;
+  for (unsigned int i=0; i<h.nMatches; i++)
+    if (matches()[i] < 0 || matches()[i] >= (int)(h.nNodes)) return false;
+  return true;
+}
+
+void DDTrackerSnapshot::close() {
+
+  if (base_) munmap(const_cast<char*>(base_), size_);
+  base_   = 0;
+  size_   = 0;
+  header_ = 0;
+}
+
+const char* DDTrackerSnapshot::string(unsigned int i) const {
+  return at<char>(header_->offChars) + at<unsigned int>(header_->offStrings)[i];
+}
+
+bool DDTrackerSnapshot::build(DDCompactView & cpv,
+			      const DDLogicalPart & mother) const {
+
+  if (!isOpen()) return false;
+  const Header & h = *header_;
+
+  //Materials (constituents come before their mixtures)
+  std::vector<DDMaterial> materials(h.nMaterials);
+  for (unsigned int i=0; i<h.nMaterials; i++) {
+    const Material & m = material(i);
+    DDName name = splitName(string(m.name));
+    materials[i] = DDMaterial(name);
+    if (materials[i].isDefined().second) continue;
+    if (m.nConstituents == 0) {
+      materials[i] = DDMaterial(name, m.z, m.a, m.density);
+    } else {
+      materials[i] = DDMaterial(name, m.density);
+      for (unsigned int k=0; k<m.nConstituents; k++) {
+	const Constituent & c = constituent(m.firstConstituent+k);
+	materials[i].addMaterial(materials[c.material], c.fraction);
+      }
+    }
+  }
+
+  //Solids (operands come before their boolean solids)
+  std::map<std::vector<double>, DDRotation> rotations;
+  std::vector<DDSolid> solids(h.nSolids);
+  for (unsigned int i=0; i<h.nSolids; i++) {
+    const Solid & s = solid(i);
+    DDName name = splitName(string(s.name));
+    solids[i] = DDSolid(name);
+    if (solids[i].isDefined().second) continue;
+    const double* p = params() + s.firstParam;
+    int           n = 0;
+    switch ((DDSolidShape)(s.shape)) {
+    case ddbox:
+      solids[i] = DDSolidFactory::box(name, p[0], p[1], p[2]);
+      break;
+    case ddtubs:
+      solids[i] = DDSolidFactory::tubs(name, p[0], p[1], p[2], p[3], p[4]);
+      break;
+    case ddcons:
+      solids[i] = DDSolidFactory::cons(name, p[0], p[1], p[2], p[3], p[4],
+				       p[5], p[6]);
+      break;
+    case ddtrap:
+      solids[i] = DDSolidFactory::trap(name, p[0], p[1], p[2], p[3], p[4],
+				       p[5], p[6], p[7], p[8], p[9], p[10]);
+      break;
+    case ddpseudotrap:
+      solids[i] = DDSolidFactory::pseudoTrap(name, p[0], p[1], p[2], p[3],
+					     p[4], p[5], p[6] != 0);
+      break;
+    case ddtorus:
+      solids[i] = DDSolidFactory::torus(name, p[0], p[1], p[2], p[3], p[4]);
+      break;
+    case ddpolycone_rrz:
+      n = (int)(p[2]);
+      solids[i] = DDSolidFactory::polycone(name, p[0], p[1],
+					   std::vector<double>(p+3, p+3+n),
+					   std::vector<double>(p+3+n, p+3+2*n),
+					   std::vector<double>(p+3+2*n, p+3+3*n));
+      break;
+    case ddpolycone_rz:
+      n = (int)(p[2]);
+      solids[i] = DDSolidFactory::polycone(name, p[0], p[1],
+					   std::vector<double>(p+3, p+3+n),
+					   std::vector<double>(p+3+n, p+3+2*n));
+      break;
+    case ddpolyhedra_rrz:
+      n = (int)(p[3]);
+      solids[i] = DDSolidFactory::polyhedra(name, (int)(p[0]), p[1], p[2],
+					    std::vector<double>(p+4, p+4+n),
+					    std::vector<double>(p+4+n, p+4+2*n),
+					    std::vector<double>(p+4+2*n, p+4+3*n));
+      break;
+    case ddpolyhedra_rz:
+      n = (int)(p[3]);
+      solids[i] = DDSolidFactory::polyhedra(name, (int)(p[0]), p[1], p[2],
+					    std::vector<double>(p+4, p+4+n),
+					    std::vector<double>(p+4+n, p+4+2*n));
+      break;
+    case ddunion:
+    case ddsubtraction:
+    case ddintersection: {
+      DDTranslation tran(p[0], p[1], p[2]);
+      DDRotation    rot = makeRotation(p+3, rotations);
+      if (s.shape == ddunion)
+	solids[i] = DDSolidFactory::unionSolid(name, solids[s.solidA],
+					       solids[s.solidB], tran, rot);
+      else if (s.shape == ddsubtraction)
+	solids[i] = DDSolidFactory::subtraction(name, solids[s.solidA],
+						solids[s.solidB], tran, rot);
+      else
+	solids[i] = DDSolidFactory::intersection(name, solids[s.solidA],
+						 solids[s.solidB], tran, rot);
+      break;
+    }
+    default:
+      edm::LogError("TrackerGeom") << "DDTrackerSnapshot: solid " << name
+				   << " of shape " << s.shape
+				   << " cannot be made from a snapshot";
+      return false;
+    }
+  }
+
+  //Logical parts; only those made here are filled with their daughters
+  std::map<unsigned int, DDLogicalPart> parts;
+  std::set<unsigned int>                made;
+  for (unsigned int i=0; i<h.nNodes; i++) {
+    const Node & nd = node(i);
+    if (parts.find(nd.name) != parts.end()) continue;
+    DDName name = splitName(string(nd.name));
+    DDLogicalPart part(name);
+    if (!part.isDefined().second) {
+      if (nd.solid < 0 || nd.material < 0) {
+	edm::LogError("TrackerGeom") << "DDTrackerSnapshot: " << name
+				     << " has no solid or material";
+	return false;
+      }
+      part = DDLogicalPart(name, materials[nd.material], solids[nd.solid]);
+      made.insert(nd.name);
+    }
+    parts[nd.name] = part;
+  }
+
+  //The root is not placed again if the mother already holds it (as
+  //cms:CMSE holds tracker:Tracker in the cms.xml of the geometry files)
+  bool rootPlaced = false;
+  typedef DDCompactView::graph_type Graph;
+  const Graph & graph = cpv.graph();
+  Graph::index_type index;
+  if (h.nNodes > 0 && graph.nodeIndex(mother, index)) {
+    DDName rootName = splitName(string(node(0).name));
+    const Graph::edge_list & edges = graph.edges(index);
+    for (Graph::edge_list::const_iterator it=edges.begin();
+	 it != edges.end() && !rootPlaced; ++it)
+      rootPlaced = (graph.nodeData(it->first).ddname() == rootName);
+  }
+
+  //Placements, each (mother, child, copy) once; the local transformation
+  //is obtained from the global ones, the root keeps its global one
+  std::set<std::pair<std::pair<unsigned int,unsigned int>,int> > placed;
+  int positioned = 0;
+  for (unsigned int i=0; i<h.nNodes; i++) {
+    const Node &  nd = node(i);
+    const double* g  = rotation(nd.rotation);
+    double        r[9];
+    DDTranslation tran;
+    if (nd.parent < 0) {
+      if (rootPlaced) continue;
+      for (int k=0; k<9; k++) r[k] = g[k];
+      tran = DDTranslation(nd.translation[0], nd.translation[1],
+			   nd.translation[2]);
+    } else {
+      const Node & pn = node(nd.parent);
+      if (made.find(pn.name) == made.end()) continue;
+      std::pair<std::pair<unsigned int,unsigned int>,int> key(std::make_pair(pn.name, nd.name), nd.copyNo);
+      if (!placed.insert(key).second) continue;
+      const double* p = rotation(pn.rotation);
+      double        t[3];
+      for (int k=0; k<3; k++) t[k] = nd.translation[k] - pn.translation[k];
+      for (int row=0; row<3; row++)
+	for (int col=0; col<3; col++)
+	  r[3*row+col] = p[row]*g[col] + p[3+row]*g[3+col] + p[6+row]*g[6+col];
+      tran = DDTranslation(p[0]*t[0] + p[3]*t[1] + p[6]*t[2],
+			   p[1]*t[0] + p[4]*t[1] + p[7]*t[2],
+			   p[2]*t[0] + p[5]*t[1] + p[8]*t[2]);
+    }
+    DDRotation rot = makeRotation(r, rotations);
+    cpv.position(parts[nd.name], (nd.parent < 0) ? mother : parts[node(nd.parent).name],
+		 nd.copyNo, tran, rot);
+    positioned++;
+  }
+
+  LogDebug("TrackerGeom") << "DDTrackerSnapshot: " << string(h.root)
+			  << " built in " << mother.name() << " with "
+			  << made.size() << " logical parts made, "
+			  << positioned << " placements and "
+			  << rotations.size() << " rotations"
+			  << (rootPlaced ? " (root already placed)" : "");
+  return true;
+}
@@ -0,0 +1,181 @@
+#ifndef DD_TrackerSnapshot_h
+#define DD_TrackerSnapshot_h
+
+/*
+
+  Read-only binary snapshot of a compiled subdetector (tracker:Tracker):
+  the expanded tree below its root volume with the global position of
+  every volume, the solids, materials and rotations used, and the
+  SpecPars with the volumes they select.
+
+  The file is one block of fixed size records, 8-byte aligned, which
+  refer to each other only by index, never by address; it can therefore
+  be mapped in memory as it is, at any address, and the mapped pages
+  are shared between all the processes using the same file:
+
+    Header                      magic "TKSNAP02", version, counts and
+                                byte offsets of the sections below,
+                                name of the root volume
+    strings                     nStrings+1 offsets into the characters
+    characters                  null terminated names
+    Material[nMaterials]        constituents before the mixtures
+    Constituent[nConstituents]  (material, fraction) of the mixtures
+    Solid[nSolids]              parameters in params[first ... first+n),
+                                operands before the boolean solids
+    double params[nParams]      per shape, n the number of z planes:
+                                  box        halfX, halfY, halfZ
+                                  tubs       zhalf, rIn, rOut, startPhi,
+                                             deltaPhi
+                                  cons       zhalf, rInMinusZ,
+                                             rOutMinusZ, rInPlusZ,
+                                             rOutPlusZ, phiFrom, deltaPhi
+                                  trap       halfZ, theta, phi, y1, x1,
+                                             x2, alpha1, y2, x3, x4,
+                                             alpha2
+                                  pseudotrap x1, x2, y1, y2, halfZ,
+                                             radius, atMinusZ
+                                  torus      rMin, rMax, rTorus,
+                                             startPhi, deltaPhi
+                                  polycone   startPhi, deltaPhi, n,
+                                             z[n], (rMin[n], rMax[n] |
+                                             r[n])
+                                  polyhedra  sides, startPhi, deltaPhi,
+                                             n, z[n], (rMin[n], rMax[n]
+                                             | r[n])
+                                  boolean    translation and rotation of
+                                             the second solid
+                                  others     the parameters of DDSolid
+    double rotations[9*nRotations]  distinct global rotations
+    Node[nNodes]                expanded tree in depth first order
+    SpecPar[nSpecPars]
+    SpecParam[nSpecParams]      (name, value) string pairs
+    int matches[nMatches]       nodes selected by the SpecPars
+
+  write() fills a snapshot from the volumes below a root of a compact
+  view; the SpecPars are read from DDL files with DDTrackerSpecParMatcher.
+  open() maps a snapshot and checks that all its sections are within the
+  file and that every index of a record (parent, solid, material and
+  rotation of a node, operands and parameters of a solid, constituents
+  of a material, ...) is within its section; a file which fails is
+  rejected. build() puts it back into a compact view: the materials,
+  solids and logical parts not yet defined are made and every placement
+  of the tree is positioned once, with one rotation per distinct matrix,
+  the root in the given mother with its global transformation unless
+  the mother already holds it; the volumes already defined keep their
+  own daughters and are not filled again. The SpecPars of the snapshot are not made
+  into DDSpecifics; the SpecPar files are still read with the geometry.
+
+*/
+
+#include <string>
+#include <vector>
+
+class DDCompactView;
+class DDLogicalPart;
+class DDName;
+
+class DDTrackerSnapshot {
+
+public:
+
+  struct Header {
+    char         magic[8];
+    unsigned int version;
+    unsigned int nStrings, nMaterials, nConstituents, nSolids, nParams;
+    unsigned int nRotations, nNodes, nSpecPars, nSpecParams, nMatches;
+    unsigned int offStrings, offChars, offMaterials, offConstituents;
+    unsigned int offSolids, offParams, offRotations, offNodes;
+    unsigned int offSpecPars, offSpecParams, offMatches, size, root;
+  };
+
+  struct Material {
+    unsigned int name;
+    unsigned int firstConstituent;
+    unsigned int nConstituents;  //0 for an element
+    unsigned int pad;
+    double       density, z, a;
+  };
+
+  struct Constituent {
+    int          material;
+    unsigned int pad;
+    double       fraction;
+  };
+
+  struct Solid {
+    unsigned int name;
+    int          shape;       //DDSolidShape
+    unsigned int firstParam;
+    unsigned int nParams;
+    int          solidA;      //Boolean solids (-1 otherwise)
+    int          solidB;
+  };
+
+  struct Node {
+    int          parent;      //-1 for the root
+    unsigned int name;        //Logical part
+    int          solid;
+    int          material;
+    int          copyNo;
+    int          rotation;    //Global rotation
+    double       translation[3];
+  };
+
+  struct SpecPar {
+    unsigned int name;
+    unsigned int firstParam, nParams;
+    unsigned int firstMatch, nMatches;
+    unsigned int pad;
+  };
+
+  struct SpecParam {
+    unsigned int name, value;
+  };
+
+  //Version of the file format
+  static unsigned int formatVersion();
+
+  //File name with the ${VARIABLE}s replaced by their environment values
+  static std::string path(const std::string & file);
+
+  static bool write(const DDCompactView & cpv, const DDName & root,
+		    const std::string & file,
+		    const std::vector<std::string> & specParFiles);
+
+  DDTrackerSnapshot();
+  ~DDTrackerSnapshot();
+
+  bool open(const std::string & file);
+  void close();
+  bool isOpen() const {return base_ != 0;}
+  bool build(DDCompactView & cpv, const DDLogicalPart & mother) const;
+
+  const Header &    header()          const {return *header_;}
+  const char*       string(unsigned int i) const;
+  const Material &  material(int i)   const {return at<Material>(header_->offMaterials)[i];}
+  const Constituent & constituent(int i) const {return at<Constituent>(header_->offConstituents)[i];}
+  const Solid &     solid(int i)      const {return at<Solid>(header_->offSolids)[i];}
+  const double*     params()          const {return at<double>(header_->offParams);}
+  const double*     rotation(int i)   const {return at<double>(header_->offRotations)+9*i;}
+  const Node &      node(int i)       const {return at<Node>(header_->offNodes)[i];}
+  const SpecPar &   specPar(int i)    const {return at<SpecPar>(header_->offSpecPars)[i];}
+  const SpecParam & specParam(int i)  const {return at<SpecParam>(header_->offSpecParams)[i];}
+  const int*        matches()         const {return at<int>(header_->offMatches);}
+
+private:
+
+  DDTrackerSnapshot(const DDTrackerSnapshot &);
+  const DDTrackerSnapshot & operator=(const DDTrackerSnapshot &);
+
+  bool checkRecords() const;
+
+  template <class T> const T* at(unsigned int offset) const {
+    return reinterpret_cast<const T*>(base_ + offset);
+  }
+
+  const char*   base_;
+  unsigned long size_;
+  const Header* header_;
+};
+
+#endif
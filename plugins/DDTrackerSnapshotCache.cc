@@ -0,0 +1,201 @@
+///////////////////////////////////////////////////////////////////////////////
+// File: DDTrackerSnapshotCache.cc
+// Description: Local cache of tracker snapshots keyed by content hash
+///////////////////////////////////////////////////////////////////////////////
+
+#include <algorithm>
+#include <cstdio>
+#include <fstream>
+#include <sstream>
+#include <dirent.h>
+#include <dlfcn.h>
+#include <unistd.h>
+#include <utime.h>
+#include <sys/stat.h>
+
+#include "FWCore/MessageLogger/interface/MessageLogger.h"
+#include "FWCore/ParameterSet/interface/FileInPath.h"
+#include "Geometry/TrackerCommonData/plugins/DDTrackerSnapshot.h"
+#include "Geometry/TrackerCommonData/plugins/DDTrackerSnapshotCache.h"
+
+namespace {
+
+  //64 bit FNV-1a
+  void hash(unsigned long long & h, const char* data, unsigned long size) {
+    for (unsigned long i=0; i<size; i++) {
+      h ^= (unsigned char)(data[i]);
+      h *= 1099511628211ULL;
+    }
+  }
+
+  const std::string suffix = ".snap";
+
+  //A function of the plugin library, to find its file
+  void libraryAnchor() {}
+}
+
+DDTrackerSnapshotCache::DDTrackerSnapshotCache(const std::string & directory,
+					       unsigned long maxSize) :
+  directory_(directory), maxSize_(maxSize) {
+
+  if (mkdir(directory_.c_str(), 0755) != 0) {
+    struct stat st;
+    if (stat(directory_.c_str(), &st) != 0 || !S_ISDIR(st.st_mode))
+      edm::LogWarning("TrackerGeom") << "DDTrackerSnapshotCache: cannot "
+				     << "create " << directory_;
+  }
+}
+
+std::string DDTrackerSnapshotCache::key(const std::vector<std::string> & files) {
+
+  unsigned long long h = 14695981039346656037ULL;
+  //Format of the snapshot and library which builds and writes it
+  Dl_info info;
+  struct stat st;
+  if (dladdr(reinterpret_cast<void*>(&libraryAnchor), &info) == 0 ||
+      info.dli_fname == 0 || stat(info.dli_fname, &st) != 0) {
+    edm::LogWarning("TrackerGeom") << "DDTrackerSnapshotCache: cannot "
+				   << "identify the plugin library for the key";
+    return "";
+  }
+  std::ostringstream version;
+  version << "DDTrackerSnapshot/" << DDTrackerSnapshot::formatVersion()
+	  << "/" << (long)(st.st_mtime) << "/" << (long)(st.st_size);
+  hash(h, version.str().data(), version.str().size());
+
+  std::vector<char> buffer(65536);
+  for (unsigned int i=0; i<files.size(); i++) {
+    std::ifstream in(files[i].c_str(), std::ios::in | std::ios::binary);
+    if (!in) {
+      edm::LogWarning("TrackerGeom") << "DDTrackerSnapshotCache: cannot read "
+				     << files[i] << " for the key";
+      return "";
+    }
+    //The separator keeps "ab"+"c" apart from "a"+"bc"
+    hash(h, "\0", 1);
+    while (in) {
+      in.read(&buffer[0], buffer.size());
+      hash(h, &buffer[0], in.gcount());
+    }
+  }
+  char hex[17];
+  std::sprintf(hex, "%016llx", h);
+  return std::string(hex);
+}
+
+std::string DDTrackerSnapshotCache::configurationKey(const std::string & config,
+						    const std::vector<std::string> & specParFiles) {
+
+  std::vector<std::string> names = geomXMLFiles(edm::FileInPath(config).fullPath());
+  if (names.empty()) return "";
+  names.insert(names.end(), specParFiles.begin(), specParFiles.end());
+  std::vector<std::string> files;
+  for (unsigned int i=0; i<names.size(); i++)
+    files.push_back(edm::FileInPath(names[i]).fullPath());
+  return key(files);
+}
+
+std::vector<std::string> DDTrackerSnapshotCache::geomXMLFiles(const std::string & config) {
+
+  std::vector<std::string> files;
+  std::ifstream in(config.c_str());
+  if (!in) {
+    edm::LogWarning("TrackerGeom") << "DDTrackerSnapshotCache: cannot read "
+				   << config;
+    return files;
+  }
+  //The quoted names ending in .xml, comments excluded
+  const std::string xml = ".xml";
+  std::string line;
+  while (std::getline(in, line)) {
+    std::string::size_type pos = 0;
+    while (pos < line.size() && line[pos] != '#') {
+      if (line[pos] != '\'' && line[pos] != '"') {
+	pos++;
+	continue;
+      }
+      std::string::size_type end = line.find(line[pos], pos+1);
+      if (end == std::string::npos) break;
+      std::string name = line.substr(pos+1, end-pos-1);
+      if (name.size() > xml.size() &&
+	  name.compare(name.size()-xml.size(), xml.size(), xml) == 0)
+	files.push_back(name);
+      pos = end+1;
+    }
+  }
+  LogDebug("TrackerGeom") << "DDTrackerSnapshotCache: " << files.size()
+			  << " XML files in " << config;
+  return files;
+}
+
+std::string DDTrackerSnapshotCache::find(const std::string & key) const {
+
+  if (key.empty()) return "";
+  std::string file = path(key);
+  if (access(file.c_str(), R_OK) != 0) return "";
+  utime(file.c_str(), 0);
+  LogDebug("TrackerGeom") << "DDTrackerSnapshotCache: " << key
+			  << " found in " << file;
+  return file;
+}
+
+std::string DDTrackerSnapshotCache::temporary(const std::string & key) const {
+
+  std::ostringstream name;
+  name << directory_ << "/." << key << "." << getpid() << ".tmp";
+  return name.str();
+}
+
+bool DDTrackerSnapshotCache::publish(const std::string & temporary,
+				     const std::string & key) {
+
+  std::string file = path(key);
+  if (std::rename(temporary.c_str(), file.c_str()) != 0) {
+    edm::LogWarning("TrackerGeom") << "DDTrackerSnapshotCache: cannot "
+				   << "publish " << temporary << " as "
+				   << file;
+    std::remove(temporary.c_str());
+    return false;
+  }
+  LogDebug("TrackerGeom") << "DDTrackerSnapshotCache: " << key
+			  << " published in " << file;
+  evict(key);
+  return true;
+}
+
+void DDTrackerSnapshotCache::evict(const std::string & keep) {
+
+  DIR* dir = opendir(directory_.c_str());
+  if (!dir) return;
+  //(modification time, file) and size of the snapshots
+  std::vector<std::pair<std::pair<long, std::string>, unsigned long> > order;
+  unsigned long total = 0;
+  struct dirent* entry;
+  while ((entry = readdir(dir)) != 0) {
+    std::string name = entry->d_name;
+    if (name.size() <= suffix.size() || name[0] == '.' ||
+	name.compare(name.size()-suffix.size(), suffix.size(), suffix) != 0)
+      continue;
+    struct stat st;
+    std::string file = directory_ + "/" + name;
+    if (stat(file.c_str(), &st) != 0) continue;
+    total += st.st_size;
+    if (name == keep + suffix) continue;
+    order.push_back(std::make_pair(std::make_pair((long)(st.st_mtime), file),
+				   (unsigned long)(st.st_size)));
+  }
+  closedir(dir);
+
+  //Oldest first
+  std::sort(order.begin(), order.end());
+  for (unsigned int i=0; i<order.size() && total > maxSize_; i++) {
+    if (std::remove(order[i].first.second.c_str()) != 0) continue;
+    total -= order[i].second;
+    LogDebug("TrackerGeom") << "DDTrackerSnapshotCache: "
+			    << order[i].first.second << " evicted";
+  }
+}
+
+std::string DDTrackerSnapshotCache::path(const std::string & key) const {
+  return directory_ + "/" + key + suffix;
+}
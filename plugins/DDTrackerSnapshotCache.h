@@ -0,0 +1,62 @@
+#ifndef DD_TrackerSnapshotCache_h
+#define DD_TrackerSnapshotCache_h
+
+/*
+
+  Local on-disk cache of tracker snapshots (DDTrackerSnapshot) keyed by
+  a hash of the ordered contents of the XML files of a configuration, of
+  the snapshot format version and of the identity (modification time and
+  size) of the plugin library which builds and writes the geometry, so
+  that a job on a node where the same tracker was already built finds it
+  by
+
+    std::string file = cache.find(DDTrackerSnapshotCache::key(files));
+
+  and maps it instead of building it again. The XML files are taken from
+  the configuration fragment itself (geomXMLFiles()), so that the key
+  follows the geometry actually used. A snapshot is written under a
+  temporary name in the cache directory and published by renaming it,
+  which is atomic, so that readers never see a partial file. The cache
+  is bounded in size: the least recently used snapshots (find() renews
+  the modification time) are removed first.
+
+*/
+
+#include <string>
+#include <vector>
+
+class DDTrackerSnapshotCache {
+
+public:
+
+  DDTrackerSnapshotCache(const std::string & directory, unsigned long maxSize);
+
+  //Key of a list of (FileInPath resolved) files, in this order; empty
+  //if a file or the plugin library cannot be read
+  static std::string key(const std::vector<std::string> & files);
+  //Key of the geomXMLFiles of a configuration fragment followed by the
+  //SpecPar files (all FileInPath names)
+  static std::string configurationKey(const std::string & config,
+				      const std::vector<std::string> & specParFiles);
+  //XML files (FileInPath names) of the geomXMLFiles of a configuration
+  //fragment (resolved path of a _cfi.py file), in order
+  static std::vector<std::string> geomXMLFiles(const std::string & config);
+
+  //Path of the snapshot with this key, empty if not cached
+  std::string find(const std::string & key) const;
+  //Unique temporary name in the cache directory to write a snapshot
+  std::string temporary(const std::string & key) const;
+  //Publishes the temporary file as the snapshot of key
+  bool        publish(const std::string & temporary, const std::string & key);
+  //Removes the least recently used snapshots above the size bound
+  void        evict(const std::string & keep = "");
+
+private:
+
+  std::string path(const std::string & key) const;
+
+  std::string   directory_;
+  unsigned long maxSize_;
+};
+
+#endif
@@ -0,0 +1,86 @@
+///////////////////////////////////////////////////////////////////////////////
+// File: DDTrackerSnapshotExport.cc
+// Description: Write the binary snapshot of the compiled geometry
+///////////////////////////////////////////////////////////////////////////////
+
+#include <cstdio>
+#include <fstream>
+
+#include "FWCore/MessageLogger/interface/MessageLogger.h"
+#include "FWCore/ParameterSet/interface/FileInPath.h"
+#include "Geometry/TrackerCommonData/plugins/DDTrackerSnapshot.h"
+#include "Geometry/TrackerCommonData/plugins/DDTrackerSnapshotCache.h"
+#include "Geometry/TrackerCommonData/plugins/DDTrackerSnapshotExport.h"
+
+namespace {
+
+  bool copyFile(const std::string & from, const std::string & to) {
+    std::ifstream in(from.c_str(), std::ios::in | std::ios::binary);
+    std::ofstream out(to.c_str(), std::ios::out | std::ios::binary);
+    if (!in || !out) return false;
+    out << in.rdbuf();
+    out.close();
+    return in.good() && !out.fail();
+  }
+}
+
+DDTrackerSnapshotExport::DDTrackerSnapshotExport() {
+  LogDebug("TrackerGeom") <<"DDTrackerSnapshotExport info: Creating an instance";
+}
+
+DDTrackerSnapshotExport::~DDTrackerSnapshotExport() {}
+
+void DDTrackerSnapshotExport::initialize(const DDNumericArguments & nArgs,
+					 const DDVectorArguments & ,
+					 const DDMapArguments & ,
+					 const DDStringArguments & sArgs,
+					 const DDStringVectorArguments & vsArgs) {
+
+  fileName = DDTrackerSnapshot::path(sArgs["File"]);
+  if (vsArgs.find("SpecParFiles") != vsArgs.end())
+    specParFiles = vsArgs["SpecParFiles"];
+  if (sArgs.find("CacheDirectory") != sArgs.end())
+    cacheDir = DDTrackerSnapshot::path(sArgs["CacheDirectory"]);
+  cacheSize = 1024;
+  if (nArgs.find("CacheSize") != nArgs.end()) cacheSize = nArgs["CacheSize"];
+  if (sArgs.find("GeomFilesConfig") != sArgs.end())
+    geomConfig = sArgs["GeomFilesConfig"];
+
+  LogDebug("TrackerGeom") << "DDTrackerSnapshotExport debug: Parent "
+			  << parent().name() << " File " << fileName
+			  << " with " << specParFiles.size()
+			  << " SpecPar files, cache " << cacheDir << " of "
+			  << cacheSize << " MB for the geometry files of "
+			  << geomConfig;
+  for (unsigned int i=0; i<specParFiles.size(); i++)
+    LogDebug("TrackerGeom") << "\tspecParFiles[" << i << "] = "
+			    << specParFiles[i];
+}
+
+void DDTrackerSnapshotExport::execute(DDCompactView& cpv) {
+
+  std::vector<std::string> files;
+  for (unsigned int i=0; i<specParFiles.size(); i++)
+    files.push_back(edm::FileInPath(specParFiles[i]).fullPath());
+  bool written = false;
+  if (!fileName.empty()) {
+    written = DDTrackerSnapshot::write(cpv, parent().ddname(), fileName, files);
+    if (!written)
+      edm::LogError("TrackerGeom") << "DDTrackerSnapshotExport: writing "
+				   << fileName << " failed";
+  }
+
+  if (cacheDir.empty()) return;
+  DDTrackerSnapshotCache cache(cacheDir, (unsigned long)(cacheSize*1048576.));
+  std::string key = DDTrackerSnapshotCache::configurationKey(geomConfig,
+							     specParFiles);
+  if (key.empty() || !cache.find(key).empty()) return;
+  //The snapshot is made once; the cache gets a copy of the file if any
+  std::string temporary = cache.temporary(key);
+  bool cached = written ? copyFile(fileName, temporary) :
+    DDTrackerSnapshot::write(cpv, parent().ddname(), temporary, files);
+  if (cached)
+    cache.publish(temporary, key);
+  else
+    std::remove(temporary.c_str());
+}
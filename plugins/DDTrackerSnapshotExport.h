@@ -0,0 +1,61 @@
+#ifndef DD_TrackerSnapshotExport_h
+#define DD_TrackerSnapshotExport_h
+
+/*
+
+  Compiles the volumes below its rParent (tracker:Tracker) into a
+  read-only binary snapshot (DDTrackerSnapshot) which other jobs can map
+  in memory and build with DDTrackerSnapshotImport instead of parsing the
+  tracker XML files and running the algorithms again. It must be the
+  last algorithm of the last file of the geomXMLFiles list, so that the
+  whole tracker is in place when it runs; the SpecPars are read from
+  the given DDL files (FileInPath names):
+
+    <Algorithm name="track:DDTrackerSnapshotExport">
+      <rParent name="tracker:Tracker"/>
+      <String name="File" value="${TRACKER_SNAPSHOT_FILE}"/>
+      <Vector name="SpecParFiles" type="string" nEntries="1">
+        Geometry/TrackerCommonData/data/trackerStructureTopology.xml
+      </Vector>
+    </Algorithm>
+
+  ${VARIABLE}s in File and CacheDirectory are replaced by their values
+  in the environment; nothing is written to an empty File. With a
+  CacheDirectory the snapshot is also published in the local
+  snapshot cache (DDTrackerSnapshotCache, bounded to CacheSize MB) under
+  the key of the GeomFiles (the geomXMLFiles of the configuration, in
+  order) and of the SpecPar files; it is not written again if the cache
+  has it already, and it is a copy of File when both are given, so that
+  the snapshot is only made once.
+
+*/
+
+#include <string>
+#include <vector>
+#include "DetectorDescription/Base/interface/DDTypes.h"
+#include "DetectorDescription/Algorithm/interface/DDAlgorithm.h"
+
+class DDTrackerSnapshotExport : public DDAlgorithm {
+ public:
+  //Constructor and Destructor
+  DDTrackerSnapshotExport();
+  virtual ~DDTrackerSnapshotExport();
+
+  void initialize(const DDNumericArguments & nArgs,
+		  const DDVectorArguments & vArgs,
+		  const DDMapArguments & mArgs,
+		  const DDStringArguments & sArgs,
+		  const DDStringVectorArguments & vsArgs);
+
+  void execute(DDCompactView& cpv);
+
+private:
+
+  std::string              fileName;      //Output file
+  std::vector<std::string> specParFiles;  //DDL files with the SpecPars
+  std::string              cacheDir;      //Local snapshot cache
+  double                   cacheSize;     //Its size bound (MB)
+  std::string              geomConfig;    //Configuration with the XML files
+};
+
+#endif
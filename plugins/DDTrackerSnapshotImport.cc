@@ -0,0 +1,55 @@
+///////////////////////////////////////////////////////////////////////////////
+// File: DDTrackerSnapshotImport.cc
+// Description: Build the tracker from its binary snapshot
+///////////////////////////////////////////////////////////////////////////////
+
+#include "FWCore/MessageLogger/interface/MessageLogger.h"
+#include "DetectorDescription/Core/interface/DDCompactView.h"
+#include "Geometry/TrackerCommonData/plugins/DDTrackerSnapshot.h"
+#include "Geometry/TrackerCommonData/plugins/DDTrackerSnapshotCache.h"
+#include "Geometry/TrackerCommonData/plugins/DDTrackerSnapshotImport.h"
+
+
+DDTrackerSnapshotImport::DDTrackerSnapshotImport() {
+  LogDebug("TrackerGeom") <<"DDTrackerSnapshotImport info: Creating an instance";
+}
+
+DDTrackerSnapshotImport::~DDTrackerSnapshotImport() {}
+
+void DDTrackerSnapshotImport::initialize(const DDNumericArguments & ,
+					 const DDVectorArguments & ,
+					 const DDMapArguments & ,
+					 const DDStringArguments & sArgs,
+					 const DDStringVectorArguments & vsArgs) {
+
+  if (sArgs.find("File") != sArgs.end())
+    fileName = DDTrackerSnapshot::path(sArgs["File"]);
+  if (sArgs.find("CacheDirectory") != sArgs.end())
+    cacheDir = DDTrackerSnapshot::path(sArgs["CacheDirectory"]);
+  if (sArgs.find("GeomFilesConfig") != sArgs.end())
+    geomConfig = sArgs["GeomFilesConfig"];
+  if (vsArgs.find("SpecParFiles") != vsArgs.end())
+    specParFiles = vsArgs["SpecParFiles"];
+  LogDebug("TrackerGeom") << "DDTrackerSnapshotImport debug: Parent "
+			  << parent().name() << " File " << fileName
+			  << " cache " << cacheDir << " for the geometry files"
+			  << " of " << geomConfig << " with "
+			  << specParFiles.size() << " SpecPar files";
+}
+
+void DDTrackerSnapshotImport::execute(DDCompactView& cpv) {
+
+  std::string file;
+  if (!cacheDir.empty() && !geomConfig.empty()) {
+    DDTrackerSnapshotCache cache(cacheDir, 0);
+    file = cache.find(DDTrackerSnapshotCache::configurationKey(geomConfig,
+							       specParFiles));
+  }
+  if (file.empty()) file = fileName;
+
+  DDTrackerSnapshot snapshot;
+  if (file.empty() || !snapshot.open(file) || !snapshot.build(cpv, parent()))
+    edm::LogError("TrackerGeom") << "DDTrackerSnapshotImport: the tracker "
+				 << "could not be built from the snapshot "
+				 << file;
+}
@@ -0,0 +1,53 @@
+#ifndef DD_TrackerSnapshotImport_h
+#define DD_TrackerSnapshotImport_h
+
+/*
+
+  Builds the tracker from a binary snapshot (DDTrackerSnapshot) written
+  by DDTrackerSnapshotExport, in place of the tracker XML files and their
+  algorithms: the snapshot is mapped in memory and its root volume is
+  positioned in the rParent with the volumes below it. The geomXMLFiles
+  keep the files of the other subdetectors, the tracker materials and
+  the SpecPar files, and list this file instead of the tracker volumes:
+
+    <Algorithm name="track:DDTrackerSnapshotImport">
+      <rParent name="cms:CMSE"/>
+      <String name="File" value="${TRACKER_SNAPSHOT_FILE}"/>
+    </Algorithm>
+
+  ${VARIABLE}s in File and CacheDirectory are replaced by their values
+  in the environment. With a CacheDirectory, a GeomFilesConfig and the
+  SpecParFiles given to DDTrackerSnapshotExport, the snapshot is first
+  looked up in the local snapshot cache (DDTrackerSnapshotCache) and
+  File is only used when the cache does not have it.
+
+*/
+
+#include <string>
+#include <vector>
+#include "DetectorDescription/Base/interface/DDTypes.h"
+#include "DetectorDescription/Algorithm/interface/DDAlgorithm.h"
+
+class DDTrackerSnapshotImport : public DDAlgorithm {
+ public:
+  //Constructor and Destructor
+  DDTrackerSnapshotImport();
+  virtual ~DDTrackerSnapshotImport();
+
+  void initialize(const DDNumericArguments & nArgs,
+		  const DDVectorArguments & vArgs,
+		  const DDMapArguments & mArgs,
+		  const DDStringArguments & sArgs,
+		  const DDStringVectorArguments & vsArgs);
+
+  void execute(DDCompactView& cpv);
+
+private:
+
+  std::string              fileName;      //Snapshot file
+  std::string              cacheDir;      //Local snapshot cache
+  std::string              geomConfig;    //Configuration with the XML files
+  std::vector<std::string> specParFiles;  //DDL files with the SpecPars
+};
+
+#endif
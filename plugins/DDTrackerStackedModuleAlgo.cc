@@ -0,0 +1,144 @@
+///////////////////////////////////////////////////////////////////////////////
+// File: DDTrackerStackedModuleAlgo.cc
+// Description: Make the Phase II stacked modules of a rod and position them
+///////////////////////////////////////////////////////////////////////////////
+
+#include <cmath>
+#include <algorithm>
+
+#include "FWCore/MessageLogger/interface/MessageLogger.h"
+#include "DetectorDescription/Base/interface/DDutils.h"
+#include "DetectorDescription/Core/interface/DDSolid.h"
+#include "DetectorDescription/Core/interface/DDMaterial.h"
+#include "DetectorDescription/Core/interface/DDCurrentNamespace.h"
+#include "DetectorDescription/Core/interface/DDSplit.h"
+#include "Geometry/TrackerCommonData/plugins/DDTrackerStackedModuleAlgo.h"
+#include "Geometry/TrackerCommonData/plugins/DDTrackerSensorTable.h"
+#include "CLHEP/Units/GlobalPhysicalConstants.h"
+#include "CLHEP/Units/GlobalSystemOfUnits.h"
+
+
+DDTrackerStackedModuleAlgo::DDTrackerStackedModuleAlgo() {
+  LogDebug("TrackerGeom") << "DDTrackerStackedModuleAlgo info: Creating an "
+			  << "instance";
+}
+
+DDTrackerStackedModuleAlgo::~DDTrackerStackedModuleAlgo() {}
+
+void DDTrackerStackedModuleAlgo::initialize(const DDNumericArguments & nArgs,
+					    const DDVectorArguments & vArgs,
+					    const DDMapArguments & ,
+					    const DDStringArguments & sArgs,
+					    const DDStringVectorArguments & vsArgs) {
+
+  idNameSpace  = DDCurrentNamespace::ns();
+  modulePrefix = sArgs["ModulePrefix"];
+  moduleSuffix = sArgs["ModuleSuffix"];
+  moduleMat    = vsArgs["ModuleMaterial"];
+  waferMat     = sArgs["WaferMaterial"];
+  activeMat    = sArgs["ActiveMaterial"];
+  moduleWidth  = nArgs["ModuleWidth"];
+  moduleLength = nArgs["ModuleLength"];
+  moduleThick  = nArgs["ModuleThick"];
+  waferThick   = nArgs["WaferThick"];
+  waferZ       = nArgs["WaferZ"];
+  moduleRot    = sArgs["ModuleRotation"];
+  moduleX      = nArgs["ModuleX"];
+  sameX        = false;
+  if (sArgs.find("ZMinusX") != sArgs.end())
+    sameX      = (sArgs["ZMinusX"] == "Same");
+  zPlus        = vArgs["ZPlus"];
+  zMinus       = vArgs["ZMinus"];
+
+  DDName parentName = parent().name();
+  LogDebug("TrackerGeom") << "DDTrackerStackedModuleAlgo debug: Parent "
+			  << parentName << " NameSpace " << idNameSpace
+			  << " with " << moduleMat.size() << " module types "
+			  << modulePrefix << "*" << moduleSuffix
+			  << " of half size " << moduleWidth << ", "
+			  << moduleLength << ", " << moduleThick
+			  << " wafers of half thickness " << waferThick
+			  << " at +-" << waferZ << " made of " << waferMat
+			  << "/" << activeMat;
+
+  LogDebug("TrackerGeom") << "DDTrackerStackedModuleAlgo debug: "
+			  << zPlus.size() << "+" << zMinus.size()
+			  << " modules at x = +-" << moduleX << " ("
+			  << (sameX ? "same" : "opposite") << " side for copy 2)"
+			  << " with rotation " << moduleRot;
+  for (unsigned int i=0; i<moduleMat.size(); i++)
+    LogDebug("TrackerGeom") << "\t[" << i << "]\t" << moduleMat[i]
+			    << "\tz+ " << (i < zPlus.size() ? zPlus[i] : 0)
+			    << "\tz- " << (i < zMinus.size() ? zMinus[i] : 0);
+}
+
+void DDTrackerStackedModuleAlgo::execute(DDCompactView& cpv) {
+
+  DDName mother = parent().name();
+
+  DDRotation rot;
+  if (DDSplit(moduleRot).first != "NULL")
+    rot = DDRotation(DDName(DDSplit(moduleRot).first,
+			    DDSplit(moduleRot).second));
+  for (unsigned int i=0; i<moduleMat.size(); i++) {
+    std::string name = modulePrefix + int_to_string(i+1) + moduleSuffix;
+    DDLogicalPart module = buildModule(name, moduleMat[i], cpv);
+    double xpos = (i%2 == 0) ? moduleX : -moduleX;
+    if (i < zPlus.size()) {
+      DDTranslation tran(xpos, 0, zPlus[i]);
+      cpv.position(module, mother, 1, tran, rot);
+      LogDebug("TrackerGeom") << "DDTrackerStackedModuleAlgo test: "
+			      << module.name() << " number 1 positioned in "
+			      << mother << " at " << tran << " with " << rot;
+    }
+    if (i < zMinus.size()) {
+      DDTranslation tran((sameX ? xpos : -xpos), 0, zMinus[i]);
+      cpv.position(module, mother, 2, tran, rot);
+      LogDebug("TrackerGeom") << "DDTrackerStackedModuleAlgo test: "
+			      << module.name() << " number 2 positioned in "
+			      << mother << " at " << tran << " with " << rot;
+    }
+  }
+}
+
+DDLogicalPart DDTrackerStackedModuleAlgo::buildModule(const std::string & name,
+						      const std::string & material,
+						      DDCompactView& cpv) {
+
+  DDMaterial matter(DDName(DDSplit(material).first,
+			   DDSplit(material).second));
+  DDSolid solid = DDSolidFactory::box(DDName(name, idNameSpace), moduleWidth,
+				      moduleLength, moduleThick);
+  LogDebug("TrackerGeom") << "DDTrackerStackedModuleAlgo test: "
+			  << solid.name() << " made of " << material
+			  << " of dimensions " << moduleWidth << ", "
+			  << moduleLength << ", " << moduleThick;
+  DDLogicalPart module(solid.ddname(), matter, solid);
+
+  DDMaterial waferMatter(DDName(DDSplit(waferMat).first,
+				DDSplit(waferMat).second));
+  DDMaterial activeMatter(DDName(DDSplit(activeMat).first,
+				 DDSplit(activeMat).second));
+  for (int k=0; k<2; k++) {
+    std::string side = (k == 0) ? "INNER" : "OUTER";
+    std::string wname = name + side + "wafer";
+    std::string aname = name + side + "active";
+    DDSolid wsolid = DDSolidFactory::box(DDName(wname, idNameSpace),
+					 moduleWidth, moduleLength, waferThick);
+    DDSolid asolid = DDSolidFactory::box(DDName(aname, idNameSpace),
+					 moduleWidth, moduleLength, waferThick);
+    DDLogicalPart wafer(wsolid.ddname(), waferMatter, wsolid);
+    DDLogicalPart active(asolid.ddname(), activeMatter, asolid);
+    DDTrackerSensorTable::instance().defineSensor(active);
+    DDTranslation tran(0, 0, (k == 0) ? -waferZ : waferZ);
+    cpv.position(wafer, module, 1, tran, DDRotation());
+    cpv.position(active, wafer, 1, DDTranslation(), DDRotation());
+    LogDebug("TrackerGeom") << "DDTrackerStackedModuleAlgo test: "
+			    << wafer.name() << " number 1 positioned in "
+			    << module.name() << " at " << tran
+			    << " with no rotation and " << active.name()
+			    << " number 1 positioned in " << wafer.name()
+			    << " at (0,0,0) with no rotation";
+  }
+  return module;
+}
@@ -0,0 +1,94 @@
+#ifndef DD_TrackerStackedModuleAlgo_h
+#define DD_TrackerStackedModuleAlgo_h
+
+/*
+
+  Builds the Phase II stacked (pT) modules of one barrel rod and positions
+  them, replacing the per-module Box/LogicalPart/PosPart enumerations of
+  the upgrade tracker.xml files.
+
+  Each module type k (k = 1 ... N) is made of a module box of material
+  ModuleMaterial[k-1] named <ModulePrefix><k><ModuleSuffix>, containing
+  an INNERwafer and an OUTERwafer at -/+WaferZ, each containing the
+  corresponding INNERactive/OUTERactive sensitive volume. All volumes are
+  Boxes.
+
+  Module k copy 1 is placed in the rod at (+/-ModuleX, 0, ZPlus[k-1]) and
+  copy 2 at (-/+ModuleX, 0, ZMinus[k-1]) with ModuleRotation, the sign of
+  x alternating with k. With ZMinusX = "Same" copy 2 is on the same side
+  in x as copy 1 instead. Module types beyond the size of ZPlus (ZMinus)
+  get no copy 1 (copy 2). The barrel layers of
+  PhaseII/LongBarrel6PS/tracker.xml are built this way.
+
+== Example of use : ==
+
+<Algorithm name="track:DDTrackerStackedModuleAlgo">
+  <rParent name="tracker:Rod1"/>
+  <String name="ModulePrefix"   value="BModule"/>
+  <String name="ModuleSuffix"   value="Layer1"/>
+  <String name="WaferMaterial"  value="materials:Air"/>
+  <String name="ActiveMaterial" value="tracker:SenSi"/>
+  <String name="ModuleRotation" value="tracker:HCZ2YX"/>
+  <Numeric name="ModuleWidth"   value="48*mm"/>
+  <Numeric name="ModuleLength"  value="23.13*mm"/>
+  <Numeric name="ModuleThick"   value="1*mm"/>
+  <Numeric name="WaferThick"    value="0.1*mm"/>
+  <Numeric name="WaferZ"        value="0.9*mm"/>
+  <Numeric name="ModuleX"       value="2*mm"/>
+  <Vector name="ModuleMaterial" type="string" nEntries="56"> ... </Vector>
+  <Vector name="ZPlus"  type="numeric" nEntries="56"> ... </Vector>
+  <Vector name="ZMinus" type="numeric" nEntries="56"> ... </Vector>
+</Algorithm>
+
+  All lengths are half-dimensions except WaferZ/ModuleX/ZPlus/ZMinus which
+  are positions.
+
+*/
+
+#include <string>
+#include <vector>
+#include "DetectorDescription/Base/interface/DDTypes.h"
+#include "DetectorDescription/Algorithm/interface/DDAlgorithm.h"
+#include "DetectorDescription/Core/interface/DDLogicalPart.h"
+#include "DetectorDescription/Core/interface/DDSolid.h"
+
+class DDTrackerStackedModuleAlgo : public DDAlgorithm {
+
+public:
+  //Constructor and Destructor
+  DDTrackerStackedModuleAlgo();
+  virtual ~DDTrackerStackedModuleAlgo();
+
+  void initialize(const DDNumericArguments & nArgs,
+		  const DDVectorArguments & vArgs,
+		  const DDMapArguments & mArgs,
+		  const DDStringArguments & sArgs,
+		  const DDStringVectorArguments & vsArgs);
+
+  void execute(DDCompactView& cpv);
+
+private:
+
+  DDLogicalPart buildModule(const std::string & name,
+			    const std::string & material,
+			    DDCompactView& cpv);
+
+  std::string              idNameSpace;    //Namespace of this & ALL subparts
+  std::string              modulePrefix;   //Module name = prefix+index+suffix
+  std::string              moduleSuffix;   //
+  std::vector<std::string> moduleMat;      //Module material per module type
+  std::string              waferMat;       //Wafer material
+  std::string              activeMat;      //Active sensor material
+  double                   moduleWidth;    //Module half width  (x)
+  double                   moduleLength;   //Module half length (y)
+  double                   moduleThick;    //Module half thickness (z)
+  double                   waferThick;     //Wafer/active half thickness
+  double                   waferZ;         //Wafer position in the module
+  std::string              moduleRot;      //Module rotation
+  double                   moduleX;        //Alternating x offset
+  bool                     sameX;          //Copy 2 on the side of copy 1
+  std::vector<double>      zPlus;          //z of copy 1
+  std::vector<double>      zMinus;         //z of copy 2
+};
+
+#endif
@@ -0,0 +1,465 @@
+///////////////////////////////////////////////////////////////////////////////
+// File: DDTrackerXMLBundle.cc
+// Description: Memory mapped bundle of pre-tokenized geometry XML files
+///////////////////////////////////////////////////////////////////////////////
+
+#include <cstring>
+#include <vector>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+#include "FWCore/MessageLogger/interface/MessageLogger.h"
+#include "DetectorDescription/Algorithm/interface/DDAlgorithm.h"
+#include "DetectorDescription/Algorithm/interface/DDAlgorithmFactory.h"
+#include "DetectorDescription/Core/interface/DDCompactView.h"
+#include "DetectorDescription/Core/interface/DDCurrentNamespace.h"
+#include "DetectorDescription/Core/interface/DDLogicalPart.h"
+#include "DetectorDescription/Core/interface/DDSplit.h"
+#include "DetectorDescription/ExprAlgo/interface/ExprEvalSingleton.h"
+#include "DetectorDescription/Parser/interface/DDLSAX2FileHandler.h"
+#include "Geometry/TrackerCommonData/plugins/DDTrackerXMLBundle.h"
+
+#include <xercesc/sax2/Attributes.hpp>
+#include <xercesc/util/PlatformUtils.hpp>
+#include <xercesc/util/XMLString.hpp>
+#include <xercesc/util/XMLUni.hpp>
+
+namespace {
+
+  const char         magic[8] = {'T', 'K', 'X', 'M', 'L', 'B', '0', '2'};
+  const unsigned int version  = 2;
+
+  //Section of n records of the given size within the mapped file
+  bool inside(unsigned int offset, unsigned int n, unsigned int size,
+	      unsigned long total) {
+    return (offset%8 == 0 && offset <= total &&
+	    (unsigned long)(n) <= (total-offset)/size);
+  }
+
+  //Trimmed items of a comma separated list
+  std::vector<std::string> split(const std::string & text) {
+    std::vector<std::string> items;
+    std::string::size_type pos = 0;
+    while (pos < text.size()) {
+      std::string::size_type next = text.find(',', pos);
+      if (next == std::string::npos) next = text.size();
+      std::string item = text.substr(pos, next-pos);
+      std::string::size_type b = item.find_first_not_of(" \t\n\r");
+      std::string::size_type e = item.find_last_not_of(" \t\n\r");
+      if (b != std::string::npos) items.push_back(item.substr(b, e-b+1));
+      pos = next+1;
+    }
+    return items;
+  }
+
+  //Attributes of one element as given by a SAX2 parser
+  class Attributes : public xercesc::Attributes {
+  public:
+    void clear() {names_.clear(); values_.clear();}
+    void add(const XMLCh* name, const XMLCh* value) {
+      names_.push_back(name);
+      values_.push_back(value);
+    }
+    XMLSize_t    getLength() const {return names_.size();}
+    const XMLCh* getURI(const XMLSize_t ) const {return xercesc::XMLUni::fgZeroLenString;}
+    const XMLCh* getLocalName(const XMLSize_t i) const {return names_[i];}
+    const XMLCh* getQName(const XMLSize_t i) const {return names_[i];}
+    const XMLCh* getType(const XMLSize_t ) const {return xercesc::XMLUni::fgCDATAString;}
+    const XMLCh* getValue(const XMLSize_t i) const {return values_[i];}
+    bool getIndex(const XMLCh* const , const XMLCh* const localPart,
+		  XMLSize_t & index) const {return getIndex(localPart, index);}
+    int  getIndex(const XMLCh* const , const XMLCh* const localPart) const {
+      return getIndex(localPart);
+    }
+    bool getIndex(const XMLCh* const qName, XMLSize_t & index) const {
+      for (index=0; index<names_.size(); index++)
+	if (xercesc::XMLString::equals(names_[index], qName)) return true;
+      return false;
+    }
+    int  getIndex(const XMLCh* const qName) const {
+      XMLSize_t index;
+      return getIndex(qName, index) ? (int)(index) : -1;
+    }
+    const XMLCh* getType(const XMLCh* const , const XMLCh* const localPart) const {
+      return getType(localPart);
+    }
+    const XMLCh* getType(const XMLCh* const qName) const {
+      return (getIndex(qName) < 0) ? 0 : xercesc::XMLUni::fgCDATAString;
+    }
+    const XMLCh* getValue(const XMLCh* const , const XMLCh* const localPart) const {
+      return getValue(localPart);
+    }
+    const XMLCh* getValue(const XMLCh* const qName) const {
+      int index = getIndex(qName);
+      return (index < 0) ? 0 : values_[index];
+    }
+  private:
+    std::vector<const XMLCh*> names_, values_;
+  };
+
+  //Elements of one file to the file handler of the DDL parser, as the
+  //SAX2 parser of DDLParser calls it, except the Algorithm elements
+  //which are run with folded arguments
+  class Feed : public DDTrackerXMLBundle::Handler {
+  public:
+    Feed(const DDTrackerXMLBundle & bundle, DDCompactView & cpv) :
+      handler_(cpv), cpv_(cpv), strings_(bundle.header().nStrings),
+      algorithm_(-1), algorithms_(0) {}
+    ~Feed() {
+      for (unsigned int i=0; i<strings_.size(); i++)
+	if (strings_[i]) xercesc::XMLString::release(&strings_[i]);
+    }
+    void setNamespace(const std::string & ns) {
+      ns_ = ns;
+      handler_.setNameSpace(ns);
+    }
+    int  algorithms() const {return algorithms_;}
+    void startElement(const DDTrackerXMLBundle & bundle,
+		      const DDTrackerXMLBundle::Element & element) {
+      if (algorithm_ >= 0) return;
+      if (std::string(bundle.string(element.tag)) == "Algorithm") {
+	algorithm_ = (int)(&element - &bundle.element(0));
+	run(bundle, algorithm_);
+	return;
+      }
+      attributes_.clear();
+      for (unsigned int k=0; k<element.nAttributes; k++) {
+	const DDTrackerXMLBundle::Attribute & attr = bundle.attribute(element.firstAttribute+k);
+	attributes_.add(text(bundle, attr.name), text(bundle, attr.value));
+      }
+      const XMLCh* tag = text(bundle, element.tag);
+      handler_.startElement(xercesc::XMLUni::fgZeroLenString, tag, tag,
+			    attributes_);
+      if (element.text != DDTrackerXMLBundle::none) {
+	const XMLCh* chars = text(bundle, element.text);
+	handler_.characters(chars, xercesc::XMLString::stringLen(chars));
+      }
+    }
+    void endElement(const DDTrackerXMLBundle & bundle,
+		    const DDTrackerXMLBundle::Element & element) {
+      if (algorithm_ >= 0) {
+	if (&element == &bundle.element(algorithm_)) algorithm_ = -1;
+	return;
+      }
+      const XMLCh* tag = text(bundle, element.tag);
+      handler_.endElement(xercesc::XMLUni::fgZeroLenString, tag, tag);
+    }
+  private:
+    //String of the bundle transcoded once for the handler
+    const XMLCh* text(const DDTrackerXMLBundle & bundle, unsigned int i) {
+      if (!strings_[i]) strings_[i] = xercesc::XMLString::transcode(bundle.string(i));
+      return strings_[i];
+    }
+    //As DDLAlgorithm::processElement
+    void run(const DDTrackerXMLBundle & bundle, int index) {
+      const DDTrackerXMLBundle::Element &   algo = bundle.element(index);
+      const DDTrackerXMLBundle::Attribute*  name = bundle.attribute(algo, "name");
+      const DDTrackerXMLBundle::Attribute*  rParent = 0;
+      for (int i=index+1; i<(int)(bundle.header().nElements) &&
+	     bundle.element(i).depth > algo.depth; i++)
+	if (bundle.element(i).parent == index &&
+	    std::string(bundle.string(bundle.element(i).tag)) == "rParent")
+	  rParent = bundle.attribute(bundle.element(i), "name");
+      DDNumericArguments      nArgs;
+      DDVectorArguments       vArgs;
+      DDMapArguments          mArgs;
+      DDStringArguments       sArgs;
+      DDStringVectorArguments vsArgs;
+      if (!name || !rParent ||
+	  !bundle.arguments(index, nArgs, vArgs, mArgs, sArgs, vsArgs)) {
+	edm::LogError("TrackerGeom") << "DDTrackerXMLBundle: algorithm element "
+				     << index << " in " << ns_
+				     << " not run";
+	return;
+      }
+      std::pair<std::string,std::string> parent = DDSplit(std::string(bundle.string(rParent->value)));
+      if (parent.second.empty()) parent.second = ns_;
+      DDAlgorithm* algorithm = DDAlgorithmFactory::get()->create(bundle.string(name->value));
+      algorithm->setParent(DDLogicalPart(DDName(parent.first, parent.second)));
+      algorithm->initialize(nArgs, vArgs, mArgs, sArgs, vsArgs);
+      algorithm->execute(cpv_);
+      delete algorithm;
+      algorithms_++;
+    }
+
+    DDLSAX2FileHandler       handler_;
+    DDCompactView &          cpv_;
+    std::string              ns_;
+    std::vector<XMLCh*>      strings_;
+    Attributes               attributes_;
+    int                      algorithm_;   //Algorithm element being skipped
+    int                      algorithms_;
+  };
+}
+
+DDTrackerXMLBundle::DDTrackerXMLBundle() : base_(0), size_(0), header_(0),
+					   requests_(0) {}
+
+DDTrackerXMLBundle::~DDTrackerXMLBundle() {
+  close();
+}
+
+bool DDTrackerXMLBundle::open(const std::string & file) {
+
+  close();
+  int fd = ::open(file.c_str(), O_RDONLY);
+  if (fd < 0) {
+    edm::LogError("TrackerGeom") << "DDTrackerXMLBundle: cannot open " << file;
+    return false;
+  }
+  struct stat st;
+  void* base = MAP_FAILED;
+  if (fstat(fd, &st) == 0 && st.st_size >= (off_t)(sizeof(Header)))
+    base = mmap(0, st.st_size, PROT_READ, MAP_SHARED, fd, 0);
+  ::close(fd);
+  if (base == MAP_FAILED) {
+    edm::LogError("TrackerGeom") << "DDTrackerXMLBundle: cannot map " << file;
+    return false;
+  }
+
+  base_   = static_cast<const char*>(base);
+  size_   = st.st_size;
+  header_ = reinterpret_cast<const Header*>(base_);
+  if (std::memcmp(header_->magic, magic, 8) != 0 ||
+      header_->version != version || header_->size != size_) {
+    edm::LogError("TrackerGeom") << "DDTrackerXMLBundle: " << file
+				 << " is not a bundle of version " << version;
+    close();
+    return false;
+  }
+  if (!valid()) {
+    edm::LogError("TrackerGeom") << "DDTrackerXMLBundle: " << file
+				 << " has records outside the file";
+    close();
+    return false;
+  }
+  for (unsigned int i=0; i<header_->nNamespaces; i++)
+    index_[string(space(i).name)] = (int)(i);
+  LogDebug("TrackerGeom") << "DDTrackerXMLBundle: " << file << " mapped with "
+			  << header_->nNamespaces << " files and "
+			  << header_->nElements << " elements";
+  return true;
+}
+
+void DDTrackerXMLBundle::close() {
+
+  if (base_) munmap(const_cast<char*>(base_), size_);
+  base_   = 0;
+  size_   = 0;
+  header_ = 0;
+  index_.clear();
+  folded_.clear();
+  requests_ = 0;
+}
+
+bool DDTrackerXMLBundle::valid() const {
+
+  const Header & h = *header_;
+  if (!(inside(h.offStrings, h.nStrings+1, sizeof(unsigned int), size_) &&
+	h.offChars >= h.offStrings + (h.nStrings+1)*sizeof(unsigned int) &&
+	h.offNamespaces >= h.offChars && h.offNamespaces <= size_ &&
+	inside(h.offNamespaces, h.nNamespaces, sizeof(Namespace), size_) &&
+	inside(h.offElements, h.nElements, sizeof(Element), size_) &&
+	inside(h.offAttributes, h.nAttributes, sizeof(Attribute), size_)))
+    return false;
+
+  //Strings: increasing offsets to null terminated characters
+  const unsigned int* strings = at<unsigned int>(h.offStrings);
+  unsigned int        nChars  = h.offNamespaces - h.offChars;
+  if (strings[0] != 0 || strings[h.nStrings] > nChars ||
+      (h.nStrings > 0 && at<char>(h.offChars)[strings[h.nStrings]-1] != '\0'))
+    return false;
+  for (unsigned int i=0; i<h.nStrings; i++)
+    if (strings[i] >= strings[i+1]) return false;
+
+  //Files: consecutive ranges of elements, each one document
+  unsigned int next = 0;
+  for (unsigned int i=0; i<h.nNamespaces; i++) {
+    const Namespace & ns = space(i);
+    if (ns.name >= h.nStrings || ns.file >= h.nStrings ||
+	ns.firstElement != next || ns.nElements > h.nElements - next)
+      return false;
+    next += ns.nElements;
+  }
+  if (next != h.nElements) return false;
+
+  //Elements: parents before their daughters, depths consistent with
+  //them, attributes and strings within their sections
+  for (unsigned int i=0; i<h.nElements; i++) {
+    const Element & elem = element(i);
+    if (elem.tag >= h.nStrings || elem.parent >= (int)(i) ||
+	elem.parent < -1 || elem.firstAttribute > h.nAttributes ||
+	elem.nAttributes > h.nAttributes - elem.firstAttribute ||
+	(elem.text != none && elem.text >= h.nStrings))
+      return false;
+    unsigned int depth = (elem.parent < 0) ? 0 : element(elem.parent).depth+1;
+    if (elem.depth != depth) return false;
+  }
+  for (unsigned int i=0; i<h.nAttributes; i++)
+    if (attribute(i).name >= h.nStrings || attribute(i).value >= h.nStrings)
+      return false;
+  return true;
+}
+
+const char* DDTrackerXMLBundle::string(unsigned int i) const {
+  return at<char>(header_->offChars) + at<unsigned int>(header_->offStrings)[i];
+}
+
+int DDTrackerXMLBundle::find(const std::string & name) const {
+
+  std::map<std::string, int>::const_iterator it = index_.find(name);
+  return (it == index_.end()) ? -1 : it->second;
+}
+
+int DDTrackerXMLBundle::spaceOf(int element) const {
+
+  int first = 0, last = (int)(header_->nNamespaces);
+  while (last-first > 1) {
+    int middle = (first+last)/2;
+    if ((int)(space(middle).firstElement) <= element) first = middle;
+    else                                              last  = middle;
+  }
+  return first;
+}
+
+const DDTrackerXMLBundle::Attribute*
+DDTrackerXMLBundle::attribute(const Element & element,
+			      const std::string & name) const {
+
+  for (unsigned int k=0; k<element.nAttributes; k++) {
+    const Attribute & attr = attribute(element.firstAttribute+k);
+    if (name == string(attr.name)) return &attr;
+  }
+  return 0;
+}
+
+bool DDTrackerXMLBundle::arguments(int algorithm,
+				   DDNumericArguments & nArgs,
+				   DDVectorArguments & vArgs,
+				   DDMapArguments & mArgs,
+				   DDStringArguments & sArgs,
+				   DDStringVectorArguments & vsArgs) const {
+
+  std::string       ns   = string(space(spaceOf(algorithm)).name);
+  const Element &   algo = element(algorithm);
+  std::string       expression;
+  bool              ok   = true;
+  try {
+    for (int i=algorithm+1; ok && i<(int)(header_->nElements); i++) {
+      const Element & arg = element(i);
+      if (arg.depth <= algo.depth) break;
+      if (arg.parent != algorithm) continue;
+      std::string      tag  = string(arg.tag);
+      const Attribute* name = attribute(arg, "name");
+      if (!name) continue;
+      std::string      key   = string(name->value);
+      const Attribute* value = attribute(arg, "value");
+      std::vector<std::string> items;
+      if (arg.text != none) items = split(string(arg.text));
+      if (tag == "Numeric" && value) {
+	expression = string(value->value);
+	nArgs.insert(std::make_pair(key, fold(ns, expression)));
+      } else if (tag == "String" && value) {
+	sArgs.insert(std::make_pair(key, std::string(string(value->value))));
+      } else if (tag == "Vector") {
+	const Attribute* type = attribute(arg, "type");
+	if (type && std::string(string(type->value)) == "string") {
+	  vsArgs.insert(std::make_pair(key, items));
+	} else {
+	  std::vector<double> values;
+	  for (unsigned int k=0; k<items.size(); k++) {
+	    expression = items[k];
+	    values.push_back(fold(ns, expression));
+	  }
+	  vArgs.insert(std::make_pair(key, values));
+	}
+      } else if (tag == "Map") {
+	std::map<std::string,double> values;
+	for (unsigned int k=0; k<items.size(); k++) {
+	  expression = items[k];
+	  std::string::size_type equal = items[k].find('=');
+	  if (equal == std::string::npos || equal == 0) {
+	    ok = false;
+	    break;
+	  }
+	  std::string entry = items[k].substr(0, items[k].find_last_not_of(" \t\n\r", equal-1)+1);
+	  expression        = items[k].substr(equal+1);
+	  values[entry]     = fold(ns, expression);
+	}
+	mArgs.insert(std::make_pair(key, values));
+      }
+    }
+  } catch (...) {
+    ok = false;
+  }
+  if (!ok)
+    edm::LogError("TrackerGeom") << "DDTrackerXMLBundle: argument " << expression
+				 << " of algorithm element " << algorithm
+				 << " in " << ns << " cannot be evaluated";
+  return ok;
+}
+
+double DDTrackerXMLBundle::fold(const std::string & ns,
+				const std::string & expression) const {
+
+  requests_++;
+  std::pair<std::string,std::string> key(ns, expression);
+  std::map<std::pair<std::string,std::string>, double>::const_iterator it = folded_.find(key);
+  if (it != folded_.end()) return it->second;
+  double value = ExprEvalSingleton::instance().eval(ns, expression);
+  folded_.insert(std::make_pair(key, value));
+  return value;
+}
+
+void DDTrackerXMLBundle::load(int index, Handler & handler) const {
+
+  const Namespace & ns = space(index);
+  std::vector<const Element*> open;
+  for (unsigned int i=0; i<ns.nElements; i++) {
+    const Element & elem = element(ns.firstElement+i);
+    while (open.size() > elem.depth) {
+      handler.endElement(*this, *open.back());
+      open.pop_back();
+    }
+    handler.startElement(*this, elem);
+    open.push_back(&elem);
+  }
+  while (!open.empty()) {
+    handler.endElement(*this, *open.back());
+    open.pop_back();
+  }
+}
+
+void DDTrackerXMLBundle::load(Handler & handler) const {
+
+  for (unsigned int i=0; i<header_->nNamespaces; i++) load(i, handler);
+}
+
+void DDTrackerXMLBundle::parse(DDCompactView & cpv) const {
+
+  xercesc::XMLPlatformUtils::Initialize();
+  std::string previous   = DDCurrentNamespace::ns();
+  int         algorithms = 0;
+  {
+    Feed feed(*this, cpv);
+    for (unsigned int i=0; i<header_->nNamespaces; i++) {
+      std::string ns = string(space(i).name);
+      DDCurrentNamespace::ns() = ns;
+      feed.setNamespace(ns);
+      load(i, feed);
+    }
+    algorithms = feed.algorithms();
+  }
+  DDCurrentNamespace::ns() = previous;
+  xercesc::XMLPlatformUtils::Terminate();
+  edm::LogInfo("TrackerGeom") << "DDTrackerXMLBundle: " << header_->nNamespaces
+			      << " files and " << header_->nElements
+			      << " elements parsed, " << algorithms
+			      << " algorithms run with " << requests_
+			      << " argument expressions, " << folded_.size()
+			      << " evaluated and "
+			      << requests_ - (int)(folded_.size())
+			      << " evaluations saved";
+}
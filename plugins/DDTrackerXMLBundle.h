@@ -0,0 +1,146 @@
+#ifndef DD_TrackerXMLBundle_h
+#define DD_TrackerXMLBundle_h
+
+/*
+
+  Reader of a bundle of geometry XML files written by
+  scripts/trackerXMLBundle.py: the elements of all the files of a
+  configuration, pre-tokenized, with the strings interned. The bundle is
+  mapped in memory; the files are found by namespace and their elements
+  are replayed in document order to a Handler, in the way a SAX parser
+  calls its handlers, without reading, parsing or validating any XML:
+
+    Header                       magic "TKXMLB02", version, counts and
+                                 byte offsets of the sections below
+    strings                      nStrings+1 offsets into the characters
+    characters                   null terminated strings
+    Namespace[nNamespaces]       one per file, in the configuration order
+    Element[nElements]           document order, file after file
+    Attribute[nAttributes]       (name, value) as written
+
+  open() checks that all the sections, strings and references between
+  the records are within the file. parse() feeds the elements to the
+  file handler of the DDL parser (DDLSAX2FileHandler), file after file
+  with the namespace of the file, as the SAX2 parser of DDLParser does
+  for the XML files; the expressions are evaluated by the element
+  handlers, with the evaluator of the parser. DDTrackerXMLBundleLoad
+  runs it from a geometry configuration.
+
+  The Algorithm elements are not given to the DDL handlers: parse()
+  runs the algorithms itself with the arguments made by arguments(),
+  ready for DDAlgorithm::initialize. Their expressions are folded: each
+  distinct expression of a namespace is evaluated once for the whole
+  bundle, however many algorithms use it, and the evaluations saved are
+  written to the log at the end of parse(). The Map arguments are
+  written as "key=value, ..." pairs. The folding applies only to a
+  geometry loaded from a bundle: when the XML files are parsed by
+  DDLParser, the arguments are evaluated by its DDLAlgorithm handler,
+  element by element, as before.
+
+*/
+
+#include <map>
+#include <string>
+#include "DetectorDescription/Base/interface/DDTypes.h"
+
+class DDCompactView;
+
+class DDTrackerXMLBundle {
+
+public:
+
+  static const unsigned int none = 0xffffffff;
+
+  struct Header {
+    char         magic[8];
+    unsigned int version;
+    unsigned int nStrings, nNamespaces, nElements, nAttributes;
+    unsigned int offStrings, offChars, offNamespaces, offElements;
+    unsigned int offAttributes, size, pad;
+  };
+
+  struct Namespace {
+    unsigned int name, file;
+    unsigned int firstElement, nElements;
+  };
+
+  struct Element {
+    unsigned int tag;
+    int          parent;       //-1 for the document element
+    unsigned int depth;
+    unsigned int firstAttribute, nAttributes;
+    unsigned int text;         //Trimmed text, none if empty
+  };
+
+  struct Attribute {
+    unsigned int name;
+    unsigned int value;
+  };
+
+  class Handler {
+  public:
+    virtual ~Handler() {}
+    virtual void startElement(const DDTrackerXMLBundle & bundle,
+			      const Element & element) = 0;
+    virtual void endElement(const DDTrackerXMLBundle & bundle,
+			    const Element & element) = 0;
+  };
+
+  DDTrackerXMLBundle();
+  ~DDTrackerXMLBundle();
+
+  bool open(const std::string & file);
+  void close();
+  bool isOpen() const {return base_ != 0;}
+
+  const Header &    header()              const {return *header_;}
+  const char*       string(unsigned int i) const;
+  const Namespace & space(int i)          const {return at<Namespace>(header_->offNamespaces)[i];}
+  const Element &   element(int i)        const {return at<Element>(header_->offElements)[i];}
+  const Attribute & attribute(int i)      const {return at<Attribute>(header_->offAttributes)[i];}
+
+  //Index of the file of a namespace, -1 if not in the bundle
+  int               find(const std::string & name) const;
+  //Index of the file of an element
+  int               spaceOf(int element) const;
+  //Attribute of an element by name, 0 if it has none
+  const Attribute*  attribute(const Element & element,
+			      const std::string & name) const;
+
+  //Arguments of an Algorithm element, folded in the namespace of its
+  //file; false if one of them cannot be evaluated
+  bool              arguments(int algorithm, DDNumericArguments & nArgs,
+			      DDVectorArguments & vArgs,
+			      DDMapArguments & mArgs,
+			      DDStringArguments & sArgs,
+			      DDStringVectorArguments & vsArgs) const;
+
+  //Replays the elements of one file, or of all in order
+  void              load(int space, Handler & handler) const;
+  void              load(Handler & handler) const;
+
+  //Builds the geometry of the bundle with the DDL element handlers
+  void              parse(DDCompactView & cpv) const;
+
+private:
+
+  DDTrackerXMLBundle(const DDTrackerXMLBundle &);
+  const DDTrackerXMLBundle & operator=(const DDTrackerXMLBundle &);
+
+  template <class T> const T* at(unsigned int offset) const {
+    return reinterpret_cast<const T*>(base_ + offset);
+  }
+  bool              valid() const;
+  double            fold(const std::string & ns,
+			 const std::string & expression) const;
+
+  const char*                base_;
+  unsigned long              size_;
+  const Header*              header_;
+  std::map<std::string, int> index_;
+  //Values of the expressions by (namespace, expression)
+  mutable std::map<std::pair<std::string,std::string>, double> folded_;
+  mutable int                requests_;
+};
+
+#endif
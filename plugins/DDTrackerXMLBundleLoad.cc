@@ -0,0 +1,38 @@
+///////////////////////////////////////////////////////////////////////////////
+// File: DDTrackerXMLBundleLoad.cc
+// Description: Build the geometry of a bundle of XML files
+///////////////////////////////////////////////////////////////////////////////
+
+#include "FWCore/MessageLogger/interface/MessageLogger.h"
+#include "DetectorDescription/Core/interface/DDCompactView.h"
+#include "Geometry/TrackerCommonData/plugins/DDTrackerSnapshot.h"
+#include "Geometry/TrackerCommonData/plugins/DDTrackerXMLBundle.h"
+#include "Geometry/TrackerCommonData/plugins/DDTrackerXMLBundleLoad.h"
+
+
+DDTrackerXMLBundleLoad::DDTrackerXMLBundleLoad() {
+  LogDebug("TrackerGeom") <<"DDTrackerXMLBundleLoad info: Creating an instance";
+}
+
+DDTrackerXMLBundleLoad::~DDTrackerXMLBundleLoad() {}
+
+void DDTrackerXMLBundleLoad::initialize(const DDNumericArguments & ,
+					const DDVectorArguments & ,
+					const DDMapArguments & ,
+					const DDStringArguments & sArgs,
+					const DDStringVectorArguments & ) {
+
+  fileName = DDTrackerSnapshot::path(sArgs["File"]);
+  LogDebug("TrackerGeom") << "DDTrackerXMLBundleLoad debug: Parent "
+			  << parent().name() << " File " << fileName;
+}
+
+void DDTrackerXMLBundleLoad::execute(DDCompactView& cpv) {
+
+  DDTrackerXMLBundle bundle;
+  if (bundle.open(fileName))
+    bundle.parse(cpv);
+  else
+    edm::LogError("TrackerGeom") << "DDTrackerXMLBundleLoad: the geometry "
+				 << "could not be built from " << fileName;
+}
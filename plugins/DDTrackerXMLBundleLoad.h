@@ -0,0 +1,45 @@
+#ifndef DD_TrackerXMLBundleLoad_h
+#define DD_TrackerXMLBundleLoad_h
+
+/*
+
+  Builds the geometry of a bundle of XML files (DDTrackerXMLBundle,
+  written by scripts/trackerXMLBundle.py) in place of the files
+  themselves: the configuration lists this file after the ones which
+  define its parent volume (python/trackFromBundleGeometryXML_cfi.py),
+  and the bundle is mapped and fed to the file handler of the DDL parser
+  when the algorithm runs:
+
+    <Algorithm name="track:DDTrackerXMLBundleLoad">
+      <rParent name="cms:CMSE"/>
+      <String name="File" value="${TRACKER_XML_BUNDLE}"/>
+    </Algorithm>
+
+  ${VARIABLE}s in File are replaced by their values in the environment.
+
+*/
+
+#include <string>
+#include "DetectorDescription/Base/interface/DDTypes.h"
+#include "DetectorDescription/Algorithm/interface/DDAlgorithm.h"
+
+class DDTrackerXMLBundleLoad : public DDAlgorithm {
+ public:
+  //Constructor and Destructor
+  DDTrackerXMLBundleLoad();
+  virtual ~DDTrackerXMLBundleLoad();
+
+  void initialize(const DDNumericArguments & nArgs,
+		  const DDVectorArguments & vArgs,
+		  const DDMapArguments & mArgs,
+		  const DDStringArguments & sArgs,
+		  const DDStringVectorArguments & vsArgs);
+
+  void execute(DDCompactView& cpv);
+
+private:
+
+  std::string fileName;      //Bundle file
+};
+
+#endif
@@ -11,6 +11,7 @@
 #include "Geometry/TrackerCommonData/plugins/DDTIBLayerAlgo.h"
 #include "Geometry/TrackerCommonData/plugins/DDTIDAxialCableAlgo.h"
 #include "Geometry/TrackerCommonData/plugins/DDTIDModuleAlgo.h"
+#include "Geometry/TrackerCommonData/plugins/DDTIDModuleFullAlgo.h"
 #include "Geometry/TrackerCommonData/plugins/DDTIDModulePosAlgo.h"
 #include "Geometry/TrackerCommonData/plugins/DDTIDRingAlgo.h"
 #include "Geometry/TrackerCommonData/plugins/DDTOBAxCableAlgo.h"
@@ -18,35 +19,57 @@
 #include "Geometry/TrackerCommonData/plugins/DDTOBRadCableAlgo.h"
 #include "Geometry/TrackerCommonData/plugins/DDTrackerAngularV1.h"
 #include "Geometry/TrackerCommonData/plugins/DDTrackerAngular.h"
+#include "Geometry/TrackerCommonData/plugins/DDTrackerBuildReport.h"
 #include "Geometry/TrackerCommonData/plugins/DDTrackerLinear.h"
 #include "Geometry/TrackerCommonData/plugins/DDTrackerLinearXY.h"
+#include "Geometry/TrackerCommonData/plugins/DDTrackerModuleIndexExport.h"
+#include "Geometry/TrackerCommonData/plugins/DDTrackerOverlapCheck.h"
 #include "Geometry/TrackerCommonData/plugins/DDTrackerPhiAltAlgo.h"
 #include "Geometry/TrackerCommonData/plugins/DDTrackerPhiAlgo.h"
+#include "Geometry/TrackerCommonData/plugins/DDTrackerPooledAlgo.h"
+#include "Geometry/TrackerCommonData/plugins/DDTrackerSensorExport.h"
+#include "Geometry/TrackerCommonData/plugins/DDTrackerSnapshotExport.h"
+#include "Geometry/TrackerCommonData/plugins/DDTrackerSnapshotImport.h"
+#include "Geometry/TrackerCommonData/plugins/DDTrackerStackedModuleAlgo.h"
 #include "Geometry/TrackerCommonData/plugins/DDTrackerZPosAlgo.h"
+#include "Geometry/TrackerCommonData/plugins/DDTrackerXMLBundleLoad.h"
 #include "Geometry/TrackerCommonData/plugins/DDTrackerXYZPosAlgo.h"
 #include "DetectorDescription/Algorithm/interface/DDAlgorithmFactory.h"
 
-DEFINE_EDM_PLUGIN (DDAlgorithmFactory, DDPixBarLayerAlgo,   "track:DDPixBarLayerAlgo");
-DEFINE_EDM_PLUGIN (DDAlgorithmFactory, DDPixFwdBlades,      "track:DDPixFwdBlades");
-DEFINE_EDM_PLUGIN (DDAlgorithmFactory, DDTECAxialCableAlgo, "track:DDTECAxialCableAlgo");
-DEFINE_EDM_PLUGIN (DDAlgorithmFactory, DDTECCoolAlgo,       "track:DDTECCoolAlgo");
-DEFINE_EDM_PLUGIN (DDAlgorithmFactory, DDTECModuleAlgo,     "track:DDTECModuleAlgo");
-DEFINE_EDM_PLUGIN (DDAlgorithmFactory, DDTECOptoHybAlgo,    "track:DDTECOptoHybAlgo");
-DEFINE_EDM_PLUGIN (DDAlgorithmFactory, DDTECPhiAlgo,        "track:DDTECPhiAlgo");
-DEFINE_EDM_PLUGIN (DDAlgorithmFactory, DDTECPhiAltAlgo,     "track:DDTECPhiAltAlgo");
-DEFINE_EDM_PLUGIN (DDAlgorithmFactory, DDTIBLayerAlgo,      "track:DDTIBLayerAlgo");
-DEFINE_EDM_PLUGIN (DDAlgorithmFactory, DDTIDAxialCableAlgo, "track:DDTIDAxialCableAlgo");
-DEFINE_EDM_PLUGIN (DDAlgorithmFactory, DDTIDModuleAlgo,     "track:DDTIDModuleAlgo");
-DEFINE_EDM_PLUGIN (DDAlgorithmFactory, DDTIDModulePosAlgo,  "track:DDTIDModulePosAlgo");
-DEFINE_EDM_PLUGIN (DDAlgorithmFactory, DDTIDRingAlgo,       "track:DDTIDRingAlgo");
-DEFINE_EDM_PLUGIN (DDAlgorithmFactory, DDTOBAxCableAlgo,    "track:DDTOBAxCableAlgo");
-DEFINE_EDM_PLUGIN (DDAlgorithmFactory, DDTOBRodAlgo,        "track:DDTOBRodAlgo");
-DEFINE_EDM_PLUGIN (DDAlgorithmFactory, DDTOBRadCableAlgo,   "track:DDTOBRadCableAlgo");
-DEFINE_EDM_PLUGIN (DDAlgorithmFactory, DDTrackerAngular,    "track:DDTrackerAngular");
-DEFINE_EDM_PLUGIN (DDAlgorithmFactory, DDTrackerAngularV1,  "track:DDTrackerAngularV1");
-DEFINE_EDM_PLUGIN (DDAlgorithmFactory, DDTrackerLinear,     "track:DDTrackerLinear");
-DEFINE_EDM_PLUGIN (DDAlgorithmFactory, DDTrackerLinearXY,   "track:DDTrackerLinearXY");
-DEFINE_EDM_PLUGIN (DDAlgorithmFactory, DDTrackerPhiAltAlgo, "track:DDTrackerPhiAltAlgo");
-DEFINE_EDM_PLUGIN (DDAlgorithmFactory, DDTrackerPhiAlgo,    "track:DDTrackerPhiAlgo");
-DEFINE_EDM_PLUGIN (DDAlgorithmFactory, DDTrackerZPosAlgo,   "track:DDTrackerZPosAlgo");
-DEFINE_EDM_PLUGIN (DDAlgorithmFactory, DDTrackerXYZPosAlgo, "track:DDTrackerXYZPosAlgo");
+//Algorithms invoked hundreds of times: one instance per type, reused
+typedef DDTrackerPooledAlgo<DDTrackerAngular>   DDTrackerAngularPooled;
+typedef DDTrackerPooledAlgo<DDTrackerAngularV1> DDTrackerAngularV1Pooled;
+
+DEFINE_EDM_PLUGIN (DDAlgorithmFactory, DDPixBarLayerAlgo,          "track:DDPixBarLayerAlgo");
+DEFINE_EDM_PLUGIN (DDAlgorithmFactory, DDPixFwdBlades,             "track:DDPixFwdBlades");
+DEFINE_EDM_PLUGIN (DDAlgorithmFactory, DDTECAxialCableAlgo,        "track:DDTECAxialCableAlgo");
+DEFINE_EDM_PLUGIN (DDAlgorithmFactory, DDTECCoolAlgo,              "track:DDTECCoolAlgo");
+DEFINE_EDM_PLUGIN (DDAlgorithmFactory, DDTECModuleAlgo,            "track:DDTECModuleAlgo");
+DEFINE_EDM_PLUGIN (DDAlgorithmFactory, DDTECOptoHybAlgo,           "track:DDTECOptoHybAlgo");
+DEFINE_EDM_PLUGIN (DDAlgorithmFactory, DDTECPhiAlgo,               "track:DDTECPhiAlgo");
+DEFINE_EDM_PLUGIN (DDAlgorithmFactory, DDTECPhiAltAlgo,            "track:DDTECPhiAltAlgo");
+DEFINE_EDM_PLUGIN (DDAlgorithmFactory, DDTIBLayerAlgo,             "track:DDTIBLayerAlgo");
+DEFINE_EDM_PLUGIN (DDAlgorithmFactory, DDTIDAxialCableAlgo,        "track:DDTIDAxialCableAlgo");
+DEFINE_EDM_PLUGIN (DDAlgorithmFactory, DDTIDModuleAlgo,            "track:DDTIDModuleAlgo");
+DEFINE_EDM_PLUGIN (DDAlgorithmFactory, DDTIDModuleFullAlgo,        "track:DDTIDModuleFullAlgo");
+DEFINE_EDM_PLUGIN (DDAlgorithmFactory, DDTIDModulePosAlgo,         "track:DDTIDModulePosAlgo");
+DEFINE_EDM_PLUGIN (DDAlgorithmFactory, DDTIDRingAlgo,              "track:DDTIDRingAlgo");
+DEFINE_EDM_PLUGIN (DDAlgorithmFactory, DDTOBAxCableAlgo,           "track:DDTOBAxCableAlgo");
+DEFINE_EDM_PLUGIN (DDAlgorithmFactory, DDTOBRodAlgo,               "track:DDTOBRodAlgo");
+DEFINE_EDM_PLUGIN (DDAlgorithmFactory, DDTOBRadCableAlgo,          "track:DDTOBRadCableAlgo");
+DEFINE_EDM_PLUGIN (DDAlgorithmFactory, DDTrackerAngularPooled,     "track:DDTrackerAngular");
+DEFINE_EDM_PLUGIN (DDAlgorithmFactory, DDTrackerAngularV1Pooled,   "track:DDTrackerAngularV1");
+DEFINE_EDM_PLUGIN (DDAlgorithmFactory, DDTrackerBuildReport,       "track:DDTrackerBuildReport");
+DEFINE_EDM_PLUGIN (DDAlgorithmFactory, DDTrackerLinear,            "track:DDTrackerLinear");
+DEFINE_EDM_PLUGIN (DDAlgorithmFactory, DDTrackerLinearXY,          "track:DDTrackerLinearXY");
+DEFINE_EDM_PLUGIN (DDAlgorithmFactory, DDTrackerModuleIndexExport, "track:DDTrackerModuleIndexExport");
+DEFINE_EDM_PLUGIN (DDAlgorithmFactory, DDTrackerOverlapCheck,      "track:DDTrackerOverlapCheck");
+DEFINE_EDM_PLUGIN (DDAlgorithmFactory, DDTrackerPhiAltAlgo,        "track:DDTrackerPhiAltAlgo");
+DEFINE_EDM_PLUGIN (DDAlgorithmFactory, DDTrackerPhiAlgo,           "track:DDTrackerPhiAlgo");
+DEFINE_EDM_PLUGIN (DDAlgorithmFactory, DDTrackerSensorExport,      "track:DDTrackerSensorExport");
+DEFINE_EDM_PLUGIN (DDAlgorithmFactory, DDTrackerSnapshotExport,    "track:DDTrackerSnapshotExport");
+DEFINE_EDM_PLUGIN (DDAlgorithmFactory, DDTrackerSnapshotImport,    "track:DDTrackerSnapshotImport");
+DEFINE_EDM_PLUGIN (DDAlgorithmFactory, DDTrackerStackedModuleAlgo, "track:DDTrackerStackedModuleAlgo");
+DEFINE_EDM_PLUGIN (DDAlgorithmFactory, DDTrackerZPosAlgo,          "track:DDTrackerZPosAlgo");
+DEFINE_EDM_PLUGIN (DDAlgorithmFactory, DDTrackerXMLBundleLoad,     "track:DDTrackerXMLBundleLoad");
+DEFINE_EDM_PLUGIN (DDAlgorithmFactory, DDTrackerXYZPosAlgo,        "track:DDTrackerXYZPosAlgo");
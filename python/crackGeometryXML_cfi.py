@@ -36,7 +36,8 @@ XMLIdealGeometryESSource = cms.ESSource("XMLIdealGeometryESSource",
     'Geometry/TrackerCommonData/data/CRack/trackerStructureTopology.xml',
     'Geometry/TrackerCommonData/data/CRack/trackersens_2DS_5SS6_5SS4.xml',
     'Geometry/TrackerCommonData/data/CRack/trackerRecoMaterial_2DS_5SS6_5SS4.xml',
-    'Geometry/TrackerCommonData/data/CRack/trackerProdCuts_2DS_5SS6_5SS4.xml'
+    'Geometry/TrackerCommonData/data/CRack/trackerProdCuts_2DS_5SS6_5SS4.xml',
+    'Geometry/TrackerCommonData/data/trackerBuildReport.xml'
   ),
   rootNodeName = cms.string('cms:OCMS')
 )
@@ -14,7 +14,8 @@ XMLIdealGeometryESSource = cms.ESSource("XMLIdealGeometryESSource",
         'Geometry/TrackerCommonData/data/trackerpixbar.xml', 
         'Geometry/TrackerCommonData/data/tracker.xml', 
         'Geometry/CMSCommonData/data/normal/cmsextent.xml', 
-        'Geometry/TrackerCommonData/data/cms.xml'),
+        'Geometry/TrackerCommonData/data/cms.xml', 
+        'Geometry/TrackerCommonData/data/trackerBuildReport.xml'),
     rootNodeName = cms.string('cms:CMSE')
 )
 
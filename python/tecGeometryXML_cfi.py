@@ -63,7 +63,8 @@ XMLIdealGeometryESSource = cms.ESSource("XMLIdealGeometryESSource",
         'Geometry/TrackerCommonData/data/trackertec.xml', 
         'Geometry/TrackerCommonData/data/tracker.xml', 
         'Geometry/CMSCommonData/data/normal/cmsextent.xml', 
-        'Geometry/TrackerCommonData/data/cms.xml'),
+        'Geometry/TrackerCommonData/data/cms.xml', 
+        'Geometry/TrackerCommonData/data/trackerBuildReport.xml'),
     rootNodeName = cms.string('cms:CMSE')
 )
 
@@ -65,11 +65,7 @@ XMLIdealGeometryESSource = cms.ESSource("XMLIdealGeometryESSource",
         'Geometry/TrackerCommonData/data/tidmaterial.xml',
         'Geometry/TrackerCommonData/data/tidmodpar.xml',
         'Geometry/TrackerCommonData/data/tidmodule0.xml',
-        'Geometry/TrackerCommonData/data/tidmodule0r.xml',
-        'Geometry/TrackerCommonData/data/tidmodule0l.xml',
         'Geometry/TrackerCommonData/data/tidmodule1.xml',
-        'Geometry/TrackerCommonData/data/tidmodule1r.xml',
-        'Geometry/TrackerCommonData/data/tidmodule1l.xml',
         'Geometry/TrackerCommonData/data/tidmodule2.xml',
         'Geometry/TrackerCommonData/data/tidringpar.xml',
         'Geometry/TrackerCommonData/data/tidring0.xml',
@@ -182,7 +178,8 @@ XMLIdealGeometryESSource = cms.ESSource("XMLIdealGeometryESSource",
         'Geometry/TrackerCommonData/data/trackertec.xml',
         'Geometry/TrackerCommonData/data/trackerbulkhead.xml',
         'Geometry/TrackerCommonData/data/trackerother.xml',
-        'Geometry/TrackerSimData/data/trackerProdCuts.xml'),
+        'Geometry/TrackerSimData/data/trackerProdCuts.xml',
+        'Geometry/TrackerCommonData/data/trackerBuildReport.xml'),
     rootNodeName = cms.string('cms:CMSE')
 )
 
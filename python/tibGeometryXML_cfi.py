@@ -2,6 +2,7 @@ import FWCore.ParameterSet.Config as cms
 
 XMLIdealGeometryESSource = cms.ESSource("XMLIdealGeometryESSource",
     geomXMLFiles = cms.vstring('Geometry/CMSCommonData/data/materials.xml', 
+        'Geometry/TrackerCommonData/data/trackermaterial.xml', 
         'Geometry/TrackerCommonData/data/tibtidcommonmaterial.xml', 
         'Geometry/TrackerCommonData/data/tibmaterial.xml', 
         'Geometry/TrackerCommonData/data/tibmodpar.xml', 
@@ -39,7 +40,8 @@ XMLIdealGeometryESSource = cms.ESSource("XMLIdealGeometryESSource",
         'Geometry/TrackerCommonData/data/trackertib.xml', 
         'Geometry/TrackerCommonData/data/tracker.xml', 
         'Geometry/CMSCommonData/data/normal/cmsextent.xml', 
-        'Geometry/TrackerCommonData/data/cms.xml'),
+        'Geometry/TrackerCommonData/data/cms.xml', 
+        'Geometry/TrackerCommonData/data/trackerBuildReport.xml'),
     rootNodeName = cms.string('cms:CMSE')
 )
 
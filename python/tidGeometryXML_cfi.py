@@ -6,11 +6,7 @@ XMLIdealGeometryESSource = cms.ESSource("XMLIdealGeometryESSource",
         'Geometry/TrackerCommonData/data/tidmaterial.xml', 
         'Geometry/TrackerCommonData/data/tidmodpar.xml', 
         'Geometry/TrackerCommonData/data/tidmodule0.xml', 
-        'Geometry/TrackerCommonData/data/tidmodule0r.xml', 
-        'Geometry/TrackerCommonData/data/tidmodule0l.xml', 
         'Geometry/TrackerCommonData/data/tidmodule1.xml', 
-        'Geometry/TrackerCommonData/data/tidmodule1r.xml', 
-        'Geometry/TrackerCommonData/data/tidmodule1l.xml', 
         'Geometry/TrackerCommonData/data/tidmodule2.xml', 
         'Geometry/TrackerCommonData/data/tidringpar.xml', 
         'Geometry/TrackerCommonData/data/tidring0.xml', 
@@ -26,7 +22,8 @@ XMLIdealGeometryESSource = cms.ESSource("XMLIdealGeometryESSource",
         'Geometry/TrackerCommonData/data/trackertid.xml', 
         'Geometry/TrackerCommonData/data/tracker.xml', 
         'Geometry/CMSCommonData/data/normal/cmsextent.xml', 
-        'Geometry/TrackerCommonData/data/cms.xml'),
+        'Geometry/TrackerCommonData/data/cms.xml', 
+        'Geometry/TrackerCommonData/data/trackerBuildReport.xml'),
     rootNodeName = cms.string('cms:CMSE')
 )
 
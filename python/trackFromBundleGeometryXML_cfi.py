@@ -0,0 +1,19 @@
+import FWCore.ParameterSet.Config as cms
+
+# Tracker geometry built from the bundle given by $TRACKER_XML_BUNDLE,
+# made from the files of trackGeometryXML_cfi except those listed here,
+# which define the mother volume of the bundle loader (cms:CMSE):
+#   trackerXMLBundle.py --cfi python/trackGeometryXML_cfi.py \
+#     --skip Geometry/CMSCommonData/data/materials.xml \
+#     --skip Geometry/CMSCommonData/data/normal/cmsextent.xml \
+#     --skip Geometry/TrackerCommonData/data/cms.xml -o $TRACKER_XML_BUNDLE
+# The algorithm arguments are folded (each distinct expression evaluated
+# once) only in this configuration; trackGeometryXML_cfi, which parses
+# the XML files, evaluates them per algorithm as the DDL parser does.
+XMLIdealGeometryESSource = cms.ESSource("XMLIdealGeometryESSource",
+    geomXMLFiles = cms.vstring('Geometry/CMSCommonData/data/materials.xml', 
+        'Geometry/CMSCommonData/data/normal/cmsextent.xml', 
+        'Geometry/TrackerCommonData/data/cms.xml', 
+        'Geometry/TrackerCommonData/data/trackerXMLBundle.xml'),
+    rootNodeName = cms.string('cms:CMSE')
+)
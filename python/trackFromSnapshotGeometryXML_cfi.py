@@ -0,0 +1,17 @@
+import FWCore.ParameterSet.Config as cms
+
+# Tracker geometry built from the snapshot of trackSnapshotGeometryXML_cfi
+# found in the local snapshot cache in $TRACKER_SNAPSHOT_CACHE, or else
+# from the file given by $TRACKER_SNAPSHOT_FILE, instead of the tracker
+# volume files and their algorithms. cms.xml already places tracker:Tracker
+# in cms:CMSE, so the import only fills it and does not place it again
+XMLIdealGeometryESSource = cms.ESSource("XMLIdealGeometryESSource",
+    geomXMLFiles = cms.vstring('Geometry/CMSCommonData/data/materials.xml', 
+        'Geometry/TrackerCommonData/data/trackermaterial.xml', 
+        'Geometry/TrackerCommonData/data/tecmaterial.xml', 
+        'Geometry/CMSCommonData/data/normal/cmsextent.xml', 
+        'Geometry/TrackerCommonData/data/cms.xml', 
+        'Geometry/TrackerCommonData/data/trackerSnapshotImport.xml'),
+    rootNodeName = cms.string('cms:CMSE')
+)
+
@@ -0,0 +1,190 @@
+import FWCore.ParameterSet.Config as cms
+
+# Full tracker geometry from the XML files; the sensor surface table of
+# the sensors recorded by the algorithms is written at the end of the
+# build to TrackerSensors.bin
+XMLIdealGeometryESSource = cms.ESSource("XMLIdealGeometryESSource",
+    geomXMLFiles = cms.vstring('Geometry/CMSCommonData/data/materials.xml', 
+        'Geometry/CMSCommonData/data/normal/cmsextent.xml',
+        'Geometry/TrackerCommonData/data/cms.xml',
+        'Geometry/TrackerCommonData/data/pixfwdMaterials.xml',
+        'Geometry/TrackerCommonData/data/pixfwdCommon.xml',
+        'Geometry/TrackerCommonData/data/pixfwdPlaq.xml',
+        'Geometry/TrackerCommonData/data/pixfwdPlaq1x2.xml',
+        'Geometry/TrackerCommonData/data/pixfwdPlaq1x5.xml',
+        'Geometry/TrackerCommonData/data/pixfwdPlaq2x3.xml',
+        'Geometry/TrackerCommonData/data/pixfwdPlaq2x4.xml',
+        'Geometry/TrackerCommonData/data/pixfwdPlaq2x5.xml',
+        'Geometry/TrackerCommonData/data/pixfwdPanelBase.xml',
+        'Geometry/TrackerCommonData/data/pixfwdPanel.xml',
+        'Geometry/TrackerCommonData/data/pixfwdBlade.xml',
+        'Geometry/TrackerCommonData/data/pixfwdNipple.xml',
+        'Geometry/TrackerCommonData/data/pixfwdDisk.xml',
+        'Geometry/TrackerCommonData/data/pixfwdCylinder.xml',
+        'Geometry/TrackerCommonData/data/pixfwd.xml',
+        'Geometry/TrackerCommonData/data/pixbarmaterial.xml',
+        'Geometry/TrackerCommonData/data/pixbarladder.xml',
+        'Geometry/TrackerCommonData/data/pixbarladderfull.xml',
+        'Geometry/TrackerCommonData/data/pixbarladderhalf.xml',
+        'Geometry/TrackerCommonData/data/pixbarlayer.xml',
+        'Geometry/TrackerCommonData/data/pixbarlayer0.xml',
+        'Geometry/TrackerCommonData/data/pixbarlayer1.xml',
+        'Geometry/TrackerCommonData/data/pixbarlayer2.xml',
+        'Geometry/TrackerCommonData/data/pixbar.xml',
+        'Geometry/TrackerCommonData/data/tibtidcommonmaterial.xml',
+        'Geometry/TrackerCommonData/data/tibmaterial.xml',
+        'Geometry/TrackerCommonData/data/tibmodpar.xml',
+        'Geometry/TrackerCommonData/data/tibmodule0.xml',
+        'Geometry/TrackerCommonData/data/tibmodule0a.xml',
+        'Geometry/TrackerCommonData/data/tibmodule0b.xml',
+        'Geometry/TrackerCommonData/data/tibmodule2.xml',
+        'Geometry/TrackerCommonData/data/tibstringpar.xml',
+        'Geometry/TrackerCommonData/data/tibstring0ll.xml',
+        'Geometry/TrackerCommonData/data/tibstring0lr.xml',
+        'Geometry/TrackerCommonData/data/tibstring0ul.xml',
+        'Geometry/TrackerCommonData/data/tibstring0ur.xml',
+        'Geometry/TrackerCommonData/data/tibstring0.xml',
+        'Geometry/TrackerCommonData/data/tibstring1ll.xml',
+        'Geometry/TrackerCommonData/data/tibstring1lr.xml',
+        'Geometry/TrackerCommonData/data/tibstring1ul.xml',
+        'Geometry/TrackerCommonData/data/tibstring1ur.xml',
+        'Geometry/TrackerCommonData/data/tibstring1.xml',
+        'Geometry/TrackerCommonData/data/tibstring2ll.xml',
+        'Geometry/TrackerCommonData/data/tibstring2lr.xml',
+        'Geometry/TrackerCommonData/data/tibstring2ul.xml',
+        'Geometry/TrackerCommonData/data/tibstring2ur.xml',
+        'Geometry/TrackerCommonData/data/tibstring2.xml',
+        'Geometry/TrackerCommonData/data/tibstring3ll.xml',
+        'Geometry/TrackerCommonData/data/tibstring3lr.xml',
+        'Geometry/TrackerCommonData/data/tibstring3ul.xml',
+        'Geometry/TrackerCommonData/data/tibstring3ur.xml',
+        'Geometry/TrackerCommonData/data/tibstring3.xml',
+        'Geometry/TrackerCommonData/data/tiblayerpar.xml',
+        'Geometry/TrackerCommonData/data/tiblayer0.xml',
+        'Geometry/TrackerCommonData/data/tiblayer1.xml',
+        'Geometry/TrackerCommonData/data/tiblayer2.xml',
+        'Geometry/TrackerCommonData/data/tiblayer3.xml',
+        'Geometry/TrackerCommonData/data/tib.xml',
+        'Geometry/TrackerCommonData/data/tidmaterial.xml',
+        'Geometry/TrackerCommonData/data/tidmodpar.xml',
+        'Geometry/TrackerCommonData/data/tidmodule0.xml',
+        'Geometry/TrackerCommonData/data/tidmodule1.xml',
+        'Geometry/TrackerCommonData/data/tidmodule2.xml',
+        'Geometry/TrackerCommonData/data/tidringpar.xml',
+        'Geometry/TrackerCommonData/data/tidring0.xml',
+        'Geometry/TrackerCommonData/data/tidring0f.xml',
+        'Geometry/TrackerCommonData/data/tidring0b.xml',
+        'Geometry/TrackerCommonData/data/tidring1.xml',
+        'Geometry/TrackerCommonData/data/tidring1f.xml',
+        'Geometry/TrackerCommonData/data/tidring1b.xml',
+        'Geometry/TrackerCommonData/data/tidring2.xml',
+        'Geometry/TrackerCommonData/data/tid.xml',
+        'Geometry/TrackerCommonData/data/tidf.xml',
+        'Geometry/TrackerCommonData/data/tidb.xml',
+        'Geometry/TrackerCommonData/data/tibtidservices.xml',
+        'Geometry/TrackerCommonData/data/tibtidservicesf.xml',
+        'Geometry/TrackerCommonData/data/tibtidservicesb.xml',
+        'Geometry/TrackerCommonData/data/tobmaterial.xml',
+        'Geometry/TrackerCommonData/data/tobmodpar.xml',
+        'Geometry/TrackerCommonData/data/tobmodule0.xml',
+        'Geometry/TrackerCommonData/data/tobmodule2.xml',
+        'Geometry/TrackerCommonData/data/tobmodule4.xml',
+        'Geometry/TrackerCommonData/data/tobrodpar.xml',
+        'Geometry/TrackerCommonData/data/tobrod0c.xml',
+        'Geometry/TrackerCommonData/data/tobrod0l.xml',
+        'Geometry/TrackerCommonData/data/tobrod0h.xml',
+        'Geometry/TrackerCommonData/data/tobrod0.xml',
+        'Geometry/TrackerCommonData/data/tobrod1l.xml',
+        'Geometry/TrackerCommonData/data/tobrod1h.xml',
+        'Geometry/TrackerCommonData/data/tobrod1.xml',
+        'Geometry/TrackerCommonData/data/tobrod2c.xml',
+        'Geometry/TrackerCommonData/data/tobrod2l.xml',
+        'Geometry/TrackerCommonData/data/tobrod2h.xml',
+        'Geometry/TrackerCommonData/data/tobrod2.xml',
+        'Geometry/TrackerCommonData/data/tobrod3l.xml',
+        'Geometry/TrackerCommonData/data/tobrod3h.xml',
+        'Geometry/TrackerCommonData/data/tobrod3.xml',
+        'Geometry/TrackerCommonData/data/tobrod4c.xml',
+        'Geometry/TrackerCommonData/data/tobrod4l.xml',
+        'Geometry/TrackerCommonData/data/tobrod4h.xml',
+        'Geometry/TrackerCommonData/data/tobrod4.xml',
+        'Geometry/TrackerCommonData/data/tobrod5l.xml',
+        'Geometry/TrackerCommonData/data/tobrod5h.xml',
+        'Geometry/TrackerCommonData/data/tobrod5.xml',
+        'Geometry/TrackerCommonData/data/tob.xml',
+        'Geometry/TrackerCommonData/data/tecmaterial.xml',
+        'Geometry/TrackerCommonData/data/tecmodpar.xml',
+        'Geometry/TrackerCommonData/data/tecmodule0.xml',
+        'Geometry/TrackerCommonData/data/tecmodule0r.xml',
+        'Geometry/TrackerCommonData/data/tecmodule0s.xml',
+        'Geometry/TrackerCommonData/data/tecmodule1.xml',
+        'Geometry/TrackerCommonData/data/tecmodule1r.xml',
+        'Geometry/TrackerCommonData/data/tecmodule1s.xml',
+        'Geometry/TrackerCommonData/data/tecmodule2.xml',
+        'Geometry/TrackerCommonData/data/tecmodule3.xml',
+        'Geometry/TrackerCommonData/data/tecmodule4.xml',
+        'Geometry/TrackerCommonData/data/tecmodule4r.xml',
+        'Geometry/TrackerCommonData/data/tecmodule4s.xml',
+        'Geometry/TrackerCommonData/data/tecmodule5.xml',
+        'Geometry/TrackerCommonData/data/tecmodule6.xml',
+        'Geometry/TrackerCommonData/data/tecpetpar.xml', 
+        'Geometry/TrackerCommonData/data/tecring0.xml',
+        'Geometry/TrackerCommonData/data/tecring1.xml',
+        'Geometry/TrackerCommonData/data/tecring2.xml',
+        'Geometry/TrackerCommonData/data/tecring3.xml',
+        'Geometry/TrackerCommonData/data/tecring4.xml',
+        'Geometry/TrackerCommonData/data/tecring5.xml',
+        'Geometry/TrackerCommonData/data/tecring6.xml',
+        'Geometry/TrackerCommonData/data/tecring0f.xml',
+        'Geometry/TrackerCommonData/data/tecring1f.xml',
+        'Geometry/TrackerCommonData/data/tecring2f.xml',
+        'Geometry/TrackerCommonData/data/tecring3f.xml',
+        'Geometry/TrackerCommonData/data/tecring4f.xml',
+        'Geometry/TrackerCommonData/data/tecring5f.xml',
+        'Geometry/TrackerCommonData/data/tecring6f.xml',
+        'Geometry/TrackerCommonData/data/tecring0b.xml',
+        'Geometry/TrackerCommonData/data/tecring1b.xml',
+        'Geometry/TrackerCommonData/data/tecring2b.xml',
+        'Geometry/TrackerCommonData/data/tecring3b.xml',
+        'Geometry/TrackerCommonData/data/tecring4b.xml',
+        'Geometry/TrackerCommonData/data/tecring5b.xml',
+        'Geometry/TrackerCommonData/data/tecring6b.xml',
+        'Geometry/TrackerCommonData/data/tecpetalf.xml',
+        'Geometry/TrackerCommonData/data/tecpetalb.xml',
+        'Geometry/TrackerCommonData/data/tecpetal0.xml',
+        'Geometry/TrackerCommonData/data/tecpetal0f.xml',
+        'Geometry/TrackerCommonData/data/tecpetal0b.xml',
+        'Geometry/TrackerCommonData/data/tecpetal3.xml',
+        'Geometry/TrackerCommonData/data/tecpetal3f.xml',
+        'Geometry/TrackerCommonData/data/tecpetal3b.xml',
+        'Geometry/TrackerCommonData/data/tecpetal6f.xml',
+        'Geometry/TrackerCommonData/data/tecpetal6b.xml',
+        'Geometry/TrackerCommonData/data/tecpetal8f.xml',
+        'Geometry/TrackerCommonData/data/tecpetal8b.xml',
+        'Geometry/TrackerCommonData/data/tecwheel.xml',
+        'Geometry/TrackerCommonData/data/tecwheela.xml',
+        'Geometry/TrackerCommonData/data/tecwheelb.xml',
+        'Geometry/TrackerCommonData/data/tecwheelc.xml',
+        'Geometry/TrackerCommonData/data/tecwheeld.xml',
+        'Geometry/TrackerCommonData/data/tecwheel6.xml',
+        'Geometry/TrackerCommonData/data/tecservices.xml',
+        'Geometry/TrackerCommonData/data/tecbackplate.xml',
+        'Geometry/TrackerCommonData/data/trackermaterial.xml',
+        'Geometry/TrackerCommonData/data/tec.xml',
+        'Geometry/TrackerCommonData/data/tracker.xml',
+        'Geometry/TrackerCommonData/data/trackerpixbar.xml',
+        'Geometry/TrackerCommonData/data/trackerpixfwd.xml',
+        'Geometry/TrackerCommonData/data/trackertib.xml',
+        'Geometry/TrackerCommonData/data/trackertid.xml',
+        'Geometry/TrackerCommonData/data/trackertibtidservices.xml',
+        'Geometry/TrackerCommonData/data/trackertob.xml',
+        'Geometry/TrackerCommonData/data/trackertec.xml',
+        'Geometry/TrackerCommonData/data/trackerbulkhead.xml',
+        'Geometry/TrackerCommonData/data/trackerother.xml',
+        'Geometry/TrackerSimData/data/trackerProdCuts.xml',
+        'Geometry/TrackerCommonData/data/trackerSensors.xml',
+        'Geometry/TrackerCommonData/data/trackerBuildReport.xml'),
+    rootNodeName = cms.string('cms:CMSE')
+)
+
+
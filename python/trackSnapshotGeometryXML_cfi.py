@@ -0,0 +1,19 @@
+import FWCore.ParameterSet.Config as cms
+
+# Tracker geometry from the XML files, written at the end of the build
+# to the snapshot file given by $TRACKER_SNAPSHOT_FILE and to the local
+# snapshot cache in $TRACKER_SNAPSHOT_CACHE
+XMLIdealGeometryESSource = cms.ESSource("XMLIdealGeometryESSource",
+    geomXMLFiles = cms.vstring('Geometry/CMSCommonData/data/materials.xml', 
+        'Geometry/TrackerCommonData/data/trackermaterial.xml', 
+        'Geometry/TrackerCommonData/data/tecmaterial.xml', 
+        'Geometry/TrackerCommonData/data/trackerbulkhead.xml', 
+        'Geometry/TrackerCommonData/data/trackerother.xml', 
+        'Geometry/TrackerCommonData/data/tracker.xml', 
+        'Geometry/CMSCommonData/data/normal/cmsextent.xml', 
+        'Geometry/TrackerCommonData/data/cms.xml', 
+        'Geometry/TrackerCommonData/data/trackerSnapshot.xml', 
+        'Geometry/TrackerCommonData/data/trackerBuildReport.xml'),
+    rootNodeName = cms.string('cms:CMSE')
+)
+
@@ -0,0 +1,339 @@
+#!/usr/bin/env python
+#
+# Computes the minimal closed list of geometry XML files (geomXMLFiles)
+# needed to build a root volume, from the references between the files:
+# rMaterial, rSolid, rChild, rParent, rRotation, [ns:constant] in the
+# expressions and ns:name values of the algorithm arguments. The files of
+# a volume are the file defining it, the files of what it references and
+# the files placing volumes (PosPart or Algorithm) in it. The list is
+# ordered so that every file comes after the files it references, as in
+# the hand written python/*GeometryXML_cfi.py:
+#
+#   trackerGeomXMLFiles.py --only tib:TIB
+#   trackerGeomXMLFiles.py --only tib:TIB --cfi tibGeometryXML_cfi.py
+#
+# The namespace of a file is its name without .xml. Volumes made by the
+# algorithms are not in the XML: a reference to an unknown name of a
+# known namespace needs the file of that namespace, and the volumes
+# placed in such names are followed with the file.
+#
+# The algorithms which only read, load or report the geometry (exports,
+# snapshot import, bundle load, build report, checks) place nothing and
+# are ignored, as are the files which only hold such algorithms. The
+# first package with a namespace wins: Geometry/CMSCommonData comes
+# first, so that cms is the CMS one and not the cms.xml kept in
+# Geometry/TrackerCommonData for the tracker only jobs. A --only volume
+# which is neither a logical part nor placed by any file is an error.
+import os
+import re
+import sys
+import optparse
+import xml.etree.ElementTree as ElementTree
+
+definitions = ("Constant", "Material", "ElementaryMaterial", "CompositeMaterial",
+               "Rotation", "ReflectionRotation", "LogicalPart",
+               "Box", "Tubs", "Cone", "Trapezoid", "Trd1", "Polycone",
+               "Polyhedra", "Torus", "Sphere", "Pseudotrap", "TruncTubs",
+               "Orb", "EllipticalTube", "CutTubs", "ExtrudedPolygon",
+               "UnionSolid", "SubtractionSolid", "IntersectionSolid",
+               "ShapelessSolid")
+references = ("rMaterial", "rSolid", "rChild", "rParent", "rRotation",
+              "rReflectionRotation")
+constant = re.compile(r"\[([A-Za-z_][\w.\-]*:)?([A-Za-z_][\w.\-]*)\]")
+tools = ("Export", "Import", "Load", "Report", "Check")
+qualified = re.compile(r"^\s*([A-Za-z_][\w.\-]*):([A-Za-z_][\w.\-]*)\s*$")
+
+def tag(element):
+    return element.tag.split("}")[-1]
+
+def qualify(name, namespace):
+    if ":" in name:
+        return name
+    return namespace + ":" + name
+
+class GeometryFiles:
+
+    def __init__(self):
+        self.files = {}        # namespace -> file name
+        self.defs = {}         # name -> (namespace, references)
+        self.placements = {}   # parent -> [(namespace, child, references)]
+        self.specpars = []     # (namespace, [last steps of the selectors])
+        self.volumes = set()   # logical parts and placed volumes
+
+    #Files of data of a package, those of the preferred subdirectories
+    #first; the first file of each namespace is kept
+    def scanPackage(self, source, package, prefer):
+        data = os.path.join(source, package, "data")
+        found = []
+        for directory, subdirs, names in os.walk(data):
+            subdirs.sort()
+            relative = os.path.relpath(directory, data)
+            for name in sorted(names):
+                if name.endswith(".xml"):
+                    found.append((relative, name))
+        def rank(entry):
+            for i in range(len(prefer)):
+                if entry[0] == prefer[i]:
+                    return i
+            return len(prefer)
+        found = [entry for entry in found if entry[0] == "." or entry[0] in prefer]
+        found.sort(key=rank)
+        for relative, name in found:
+            namespace = name[:-4]
+            if namespace in self.files:
+                continue
+            path = os.path.normpath(os.path.join(package, "data", relative, name))
+            self.read(os.path.join(source, path), path, namespace)
+
+    def read(self, fullPath, path, namespace):
+        try:
+            root = ElementTree.parse(fullPath).getroot()
+        except Exception:
+            sys.stderr.write("Skipping %s: not a readable XML file\n" % fullPath)
+            return
+        elements = []
+        for section in root:
+            if tag(section).endswith("Section"):
+                elements += list(section)
+            else:
+                elements.append(section)
+        #Readers, writers and checks of the geometry place nothing
+        elements = [element for element in elements if not self.isTool(element)]
+        if not elements:
+            return
+        self.files[namespace] = path
+        for element in elements:
+            self.readElement(element, namespace)
+
+    def isTool(self, element):
+        return (tag(element) == "Algorithm" and
+                element.get("name", "").endswith(tools))
+
+    def readElement(self, element, namespace):
+        kind = tag(element)
+        refs = self.references(element, namespace)
+        if kind in ("PosPart", "Algorithm"):
+            parent = None
+            child = None
+            for sub in element.iter():
+                if tag(sub) == "rParent" and parent is None:
+                    parent = qualify(sub.get("name"), namespace)
+                elif tag(sub) == "rChild" and child is None:
+                    child = qualify(sub.get("name"), namespace)
+            if parent is not None:
+                refs.discard(parent)
+                self.placements.setdefault(parent, []).append((namespace, child, refs))
+                self.volumes.add(parent)
+                if child is not None:
+                    self.volumes.add(child)
+        elif kind == "SpecPar":
+            steps = []
+            for sub in element.iter():
+                if tag(sub) == "PartSelector":
+                    last = sub.get("path", "").split("/")[-1]
+                    steps.append(last.split(":")[-1])
+            self.specpars.append((namespace, steps))
+        elif kind in definitions and element.get("name"):
+            name = qualify(element.get("name"), namespace)
+            refs.discard(name)
+            self.defs[name] = (namespace, refs)
+            if kind == "LogicalPart":
+                self.volumes.add(name)
+
+    def references(self, element, namespace):
+        refs = set()
+        for sub in element.iter():
+            kind = tag(sub)
+            if kind in references and sub.get("name"):
+                refs.add(qualify(sub.get("name"), namespace))
+            values = list(sub.attrib.values())
+            if sub.text:
+                values.append(sub.text)
+            for value in values:
+                for match in constant.finditer(value):
+                    refs.add(qualify(match.group(2), (match.group(1) or namespace + ":")[:-1]))
+            if kind == "String" and sub.get("value"):
+                values = [sub.get("value")]
+            elif kind == "Vector" and sub.get("type") == "string" and sub.text:
+                values = sub.text.split(",")
+            else:
+                continue
+            for value in values:
+                match = qualified.match(value)
+                if match:
+                    refs.add(match.group(1) + ":" + match.group(2))
+        return refs
+
+class Closure:
+
+    def __init__(self, geometry, root, only):
+        self.geometry = geometry
+        self.needed = {}       # file namespace -> set of namespaces used
+        self.missing = set()
+        self.inside = set()    # volumes of which everything is needed
+        self.path = set()      # volumes only leading to the wanted ones
+        self.only = set(only)
+        self.keep = self.ancestors(only) | self.only
+        self.root = root
+        self.volume(root, None, not only or root in only)
+
+    #Volumes which contain (directly or not) the given volumes
+    def ancestors(self, volumes):
+        parents = {}
+        for parent, entries in self.geometry.placements.items():
+            for namespace, child, refs in entries:
+                for name in refs | set([child]):
+                    parents.setdefault(name, set()).add(parent)
+        result = set()
+        todo = list(volumes)
+        while todo:
+            for parent in parents.get(todo.pop(), ()):
+                if parent not in result:
+                    result.add(parent)
+                    todo.append(parent)
+        return result
+
+    def useFile(self, namespace, user):
+        if namespace not in self.geometry.files:
+            return False
+        first = namespace not in self.needed
+        self.needed.setdefault(namespace, set())
+        if user is not None and user != namespace:
+            self.needed[user].add(namespace)
+        if first:
+            #Placements in volumes made by the algorithms of this namespace
+            for parent, entries in self.geometry.placements.items():
+                if parent.split(":")[0] == namespace and parent not in self.geometry.defs:
+                    self.volume(parent, namespace, True)
+        return True
+
+    def name(self, name, user):
+        namespace = name.split(":")[0]
+        if not self.useFile(namespace, user):
+            self.missing.add(name)
+            return
+        if name in self.geometry.defs:
+            for ref in self.geometry.defs[name][1]:
+                self.volume(ref, namespace, True)
+
+    def volume(self, name, user, inside):
+        if name in self.inside or (not inside and name in self.path):
+            if user is not None:
+                self.useFile(name.split(":")[0], user)
+            return
+        (self.inside if inside else self.path).add(name)
+        self.name(name, user)
+        namespace = name.split(":")[0]
+        for placer, child, refs in self.geometry.placements.get(name, ()):
+            if not inside:
+                wanted = refs | set([child])
+                if not wanted & self.keep:
+                    continue
+            if not self.useFile(placer, None):
+                continue
+            #The file with the volume needs the files placing in it
+            if namespace in self.needed and placer != namespace:
+                self.needed[namespace].add(placer)
+            for ref in refs | set([child]):
+                if ref is not None:
+                    below = inside or ref in self.only or ref not in self.keep
+                    self.volume(ref, placer, below)
+
+    def specpars(self):
+        volumes = set([name.split(":")[-1] for name in self.inside | self.path])
+        for namespace, steps in self.geometry.specpars:
+            if set(steps) & volumes:
+                self.useFile(namespace, None)
+
+    #Files after the files they use, the root file last
+    def ordered(self):
+        result = []
+        done = set()
+        def visit(namespace):
+            done.add(namespace)
+            for used in sorted(self.needed[namespace]):
+                if used not in done:
+                    visit(used)
+            result.append(self.geometry.files[namespace])
+        rootNamespace = self.root.split(":")[0]
+        if rootNamespace in self.needed:
+            visit(rootNamespace)
+        last = result[-1:]
+        result = result[:-1]
+        for namespace in sorted(self.needed):
+            if namespace not in done:
+                visit(namespace)
+        result += last
+        return result
+
+def writeCfi(fileName, files, root):
+    out = open(fileName, "w")
+    out.write("import FWCore.ParameterSet.Config as cms\n\n")
+    out.write("XMLIdealGeometryESSource = cms.ESSource(\"XMLIdealGeometryESSource\",\n")
+    out.write("    geomXMLFiles = cms.vstring(")
+    out.write(", \n        ".join(["'%s'" % name for name in files]))
+    out.write("),\n")
+    out.write("    rootNodeName = cms.string('%s')\n)\n\n" % root)
+    out.close()
+
+def sources():
+    result = []
+    for variable in ("CMSSW_BASE", "CMSSW_RELEASE_BASE"):
+        if os.environ.get(variable):
+            result.append(os.path.join(os.environ[variable], "src"))
+    #This package when run from a checkout
+    here = os.path.dirname(os.path.abspath(__file__))
+    result.append(os.path.normpath(os.path.join(here, "..", "..", "..")))
+    return result
+
+def main():
+    parser = optparse.OptionParser(usage="%prog [options]")
+    parser.add_option("--root", default="cms:CMSE",
+                      help="root volume of the job [%default]")
+    parser.add_option("--only", action="append", default=[],
+                      help="keep only these volumes below the root (repeatable)")
+    parser.add_option("--package", action="append", default=[],
+                      help="packages whose data/**/*.xml are read (repeatable) "
+                      "[Geometry/CMSCommonData, Geometry/TrackerCommonData]; "
+                      "the first package with a namespace wins")
+    parser.add_option("--prefer", action="append", default=[],
+                      help="data subdirectories whose files win over data/ "
+                      "(repeatable, e.g. PhaseI)")
+    parser.add_option("--specpars", action="store_true", default=False,
+                      help="add the files with SpecPars selecting the volumes")
+    parser.add_option("--cfi", default=None,
+                      help="write a cfi with the XMLIdealGeometryESSource")
+    options, args = parser.parse_args()
+    packages = options.package or ["Geometry/CMSCommonData",
+                                   "Geometry/TrackerCommonData"]
+
+    geometry = GeometryFiles()
+    for package in packages:
+        for source in sources():
+            if os.path.isdir(os.path.join(source, package, "data")):
+                geometry.scanPackage(source, package, options.prefer)
+                break
+        else:
+            sys.stderr.write("Package %s not found\n" % package)
+
+    undefined = [name for name in options.only if name not in geometry.volumes]
+    for name in undefined:
+        sys.stderr.write("No volume %s in the geometry files\n" % name)
+    if undefined:
+        return 2
+
+    closure = Closure(geometry, options.root, options.only)
+    if options.specpars:
+        closure.specpars()
+    for name in sorted(closure.missing):
+        sys.stderr.write("No file for %s\n" % name)
+    files = closure.ordered()
+    if options.cfi:
+        writeCfi(options.cfi, files, options.root)
+    else:
+        for name in files:
+            print(name)
+    return len(closure.missing) != 0
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -0,0 +1,140 @@
+#!/usr/bin/env python3
+#
+# Packs the XML files of a geometry configuration into one binary bundle
+# read by DDTrackerXMLBundle: the elements of every file in document
+# order with their attributes and trimmed text, all the strings interned
+# once, so that the loader needs no XML parser and reads the whole
+# configuration from one memory mapped file. The expressions are kept
+# as written: they are evaluated when the bundle is loaded, by the
+# evaluator of the DDL parser, so that they give the same values as
+# when the XML files are parsed:
+#
+#   trackerXMLBundle.py --cfi python/tibGeometryXML_cfi.py -o tib.bundle
+#   trackerXMLBundle.py -o tib.bundle Geometry/TrackerCommonData/data/tib.xml ...
+#
+# Files which the configuration loading the bundle lists itself, before
+# data/trackerXMLBundle.xml, are left out with --skip.
+#
+# Layout (little endian, sections 8 byte aligned, see DDTrackerXMLBundle.h):
+#
+#   Header     magic "TKXMLB02", version, counts and section offsets
+#   strings    nStrings+1 offsets into the characters
+#   characters null terminated strings
+#   Namespace  name, file, first element, number of elements
+#   Element    tag, parent, depth, attributes, text
+#   Attribute  name, value
+import os
+import re
+import struct
+import sys
+import optparse
+import xml.etree.ElementTree as ElementTree
+
+from trackerGeomXMLFiles import sources, tag
+
+magic = b"TKXMLB02"
+version = 2
+none = 0xffffffff
+
+class Bundle:
+
+    def __init__(self):
+        self.strings = []
+        self.index = {}
+        self.namespaces = []
+        self.elements = []
+        self.attributes = []
+
+    def intern(self, text):
+        if text not in self.index:
+            self.index[text] = len(self.strings)
+            self.strings.append(text)
+        return self.index[text]
+
+    def addFile(self, root, namespace, path):
+        first = len(self.elements)
+        self.addElement(root, -1, 0)
+        self.namespaces.append((self.intern(namespace), self.intern(path),
+                                first, len(self.elements) - first))
+
+    def addElement(self, element, parent, depth):
+        index = len(self.elements)
+        firstAttribute = len(self.attributes)
+        for name in sorted(element.attrib):
+            self.attributes.append((self.intern(name.split("}")[-1]),
+                                    self.intern(element.attrib[name])))
+        text = none
+        if element.text and element.text.strip():
+            text = self.intern(element.text.strip())
+        self.elements.append([self.intern(tag(element)), parent, depth,
+                              firstAttribute,
+                              len(self.attributes) - firstAttribute, text])
+        for child in element:
+            self.addElement(child, index, depth + 1)
+
+    def write(self, fileName):
+        offsets = [0]
+        chars = b""
+        for text in self.strings:
+            chars += text.encode("utf-8") + b"\0"
+            offsets.append(len(chars))
+        sections = [struct.pack("<%dI" % len(offsets), *offsets), chars,
+                    b"".join([struct.pack("<4I", *entry) for entry in self.namespaces]),
+                    b"".join([struct.pack("<IiIIII", *entry) for entry in self.elements]),
+                    b"".join([struct.pack("<II", *entry) for entry in self.attributes])]
+        def align(offset):
+            return offset + (8 - offset % 8) % 8
+        headerSize = 8 + 12 * 4
+        offset = align(headerSize)
+        starts = []
+        for section in sections:
+            starts.append(offset)
+            offset = align(offset + len(section))
+        header = magic + struct.pack("<12I", version, len(self.strings),
+                                     len(self.namespaces), len(self.elements),
+                                     len(self.attributes), starts[0],
+                                     starts[1], starts[2], starts[3],
+                                     starts[4], offset, 0)
+        out = open(fileName, "wb")
+        out.write(header + b"\0" * (align(headerSize) - headerSize))
+        for section in sections:
+            out.write(section + b"\0" * (align(len(section)) - len(section)))
+        out.close()
+
+def resolve(name):
+    if os.path.isfile(name):
+        return name
+    for source in sources():
+        if os.path.isfile(os.path.join(source, name)):
+            return os.path.join(source, name)
+    return None
+
+def main():
+    parser = optparse.OptionParser(usage="%prog [options] [files]")
+    parser.add_option("--cfi", default=None,
+                      help="take the geomXMLFiles of this cfi")
+    parser.add_option("-o", "--output", default="geometry.bundle",
+                      help="bundle file [%default]")
+    parser.add_option("--skip", action="append", default=[],
+                      help="leave this file out of the bundle (repeated)")
+    options, files = parser.parse_args()
+    if options.cfi:
+        files += re.findall(r"'([^']+\.xml)'", open(options.cfi).read())
+    files = [name for name in files if name not in options.skip]
+
+    bundle = Bundle()
+    for name in files:
+        path = resolve(name)
+        if path is None:
+            sys.stderr.write("File %s not found\n" % name)
+            return 1
+        namespace = os.path.basename(name)[:-4]
+        bundle.addFile(ElementTree.parse(path).getroot(), namespace, name)
+    bundle.write(options.output)
+    print("%s: %d files, %d elements, %d strings" %
+          (options.output, len(bundle.namespaces), len(bundle.elements),
+           len(bundle.strings)))
+    return 0
+
+if __name__ == "__main__":
+    sys.exit(main())
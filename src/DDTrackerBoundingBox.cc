@@ -0,0 +1,211 @@
+///////////////////////////////////////////////////////////////////////////////
+// File: DDTrackerBoundingBox.cc
+// Description: Analytic bounding box of the solids used by the tracker
+///////////////////////////////////////////////////////////////////////////////
+
+#include <cmath>
+#include <algorithm>
+
+#include "FWCore/MessageLogger/interface/MessageLogger.h"
+#include "Geometry/TrackerCommonData/interface/DDTrackerBoundingBox.h"
+#include "CLHEP/Units/GlobalPhysicalConstants.h"
+
+DDTrackerBoundingBox::DDTrackerBoundingBox() {
+  for (int k=0; k<3; k++) { lo[k] = 1.e30; hi[k] = -1.e30; }
+}
+
+DDTrackerBoundingBox::DDTrackerBoundingBox(double xmin, double ymin,
+					   double zmin, double xmax,
+					   double ymax, double zmax) {
+  lo[0] = xmin; lo[1] = ymin; lo[2] = zmin;
+  hi[0] = xmax; hi[1] = ymax; hi[2] = zmax;
+}
+
+DDTrackerBoundingBox::DDTrackerBoundingBox(const DDSolid & solid) {
+
+  for (int k=0; k<3; k++) { lo[k] = 1.e30; hi[k] = -1.e30; }
+  if (!solid.isDefined().second) return;
+
+  switch (solid.shape()) {
+  case ddbox: {
+    DDBox box(solid);
+    extend(-box.halfX(), -box.halfY(), -box.halfZ());
+    extend( box.halfX(),  box.halfY(),  box.halfZ());
+    break;
+  }
+  case ddtubs: {
+    DDTubs tubs(solid);
+    extendPhi(tubs.rIn(), tubs.rOut(), tubs.startPhi(), tubs.deltaPhi(),
+	      -tubs.zhalf(), tubs.zhalf());
+    break;
+  }
+  case ddcons: {
+    DDCons cons(solid);
+    extendPhi(std::min(cons.rInMinusZ(), cons.rInPlusZ()),
+	      std::max(cons.rOutMinusZ(), cons.rOutPlusZ()),
+	      cons.phiFrom(), cons.deltaPhi(), -cons.zhalf(), cons.zhalf());
+    break;
+  }
+  case ddtrap: {
+    DDTrap trap(solid);
+    double dz  = trap.halfZ();
+    double tx  = tan(trap.theta())*cos(trap.phi());
+    double ty  = tan(trap.theta())*sin(trap.phi());
+    double ta1 = tan(trap.alpha1());
+    double ta2 = tan(trap.alpha2());
+    for (int s=-1; s<=1; s+=2) {
+      extend(-dz*tx-trap.y1()*ta1+s*trap.x1(), -dz*ty-trap.y1(), -dz);
+      extend(-dz*tx+trap.y1()*ta1+s*trap.x2(), -dz*ty+trap.y1(), -dz);
+      extend( dz*tx-trap.y2()*ta2+s*trap.x3(),  dz*ty-trap.y2(),  dz);
+      extend( dz*tx+trap.y2()*ta2+s*trap.x4(),  dz*ty+trap.y2(),  dz);
+    }
+    break;
+  }
+  case ddpseudotrap: {
+    DDPseudoTrap trap(solid);
+    double dx = std::max(trap.x1(), trap.x2());
+    double dy = std::max(trap.y1(), trap.y2());
+    double r  = std::fabs(trap.radius());
+    double sag= (r > dx) ? r - sqrt(r*r-dx*dx) : r;
+    extend(-dx, -dy, -trap.halfZ()-sag);
+    extend( dx,  dy,  trap.halfZ()+sag);
+    break;
+  }
+  case ddpolycone_rz:
+  case ddpolycone_rrz: {
+    DDPolycone pcon(solid);
+    std::vector<double> zv = pcon.zVec();
+    std::vector<double> rv = (solid.shape() == ddpolycone_rz) ?
+      pcon.rVec() : pcon.rMaxVec();
+    double rmin = 0;
+    if (solid.shape() == ddpolycone_rrz) {
+      std::vector<double> rminv = pcon.rMinVec();
+      rmin = *std::min_element(rminv.begin(), rminv.end());
+    }
+    extendPhi(rmin, *std::max_element(rv.begin(), rv.end()),
+	      pcon.startPhi(), pcon.deltaPhi(),
+	      *std::min_element(zv.begin(), zv.end()),
+	      *std::max_element(zv.begin(), zv.end()));
+    break;
+  }
+  case ddpolyhedra_rz:
+  case ddpolyhedra_rrz: {
+    DDPolyhedra phed(solid);
+    std::vector<double> zv = phed.zVec();
+    std::vector<double> rv = (solid.shape() == ddpolyhedra_rz) ?
+      phed.rVec() : phed.rMaxVec();
+    double rmax = *std::max_element(rv.begin(), rv.end());
+    if (phed.sides() > 0) rmax /= cos(0.5*phed.deltaPhi()/phed.sides());
+    extendPhi(0, rmax, phed.startPhi(), phed.deltaPhi(),
+	      *std::min_element(zv.begin(), zv.end()),
+	      *std::max_element(zv.begin(), zv.end()));
+    break;
+  }
+  case ddtorus: {
+    DDTorus torus(solid);
+    extendPhi(std::max(0., torus.rTorus()-torus.rMax()),
+	      torus.rTorus()+torus.rMax(), torus.startPhi(),
+	      torus.deltaPhi(), -torus.rMax(), torus.rMax());
+    break;
+  }
+  case ddunion:
+  case ddsubtraction:
+  case ddintersection: {
+    DDBooleanSolid bs(solid);
+    extend(DDTrackerBoundingBox(bs.solidA()));
+    if (solid.shape() == ddunion) {
+      DDRotation rot = bs.rotation();
+      const DDRotationMatrix* mat = rot ? rot.rotation() : 0;
+      DDTrackerBoundingBox boxB(bs.solidB());
+      extend(boxB.transformed(mat ? *mat : DDRotationMatrix(),
+			      bs.translation()));
+    }
+    break;
+  }
+  default:
+    LogDebug("TrackerGeom") << "DDTrackerBoundingBox: no analytic bound for "
+			    << solid.name() << " of shape " << solid.shape();
+    break;
+  }
+}
+
+double DDTrackerBoundingBox::area() const {
+
+  if (!valid()) return 0;
+  double dx = hi[0]-lo[0], dy = hi[1]-lo[1], dz = hi[2]-lo[2];
+  return 2.*(dx*dy+dy*dz+dz*dx);
+}
+
+void DDTrackerBoundingBox::extend(double x, double y, double z) {
+
+  double p[3] = {x, y, z};
+  for (int k=0; k<3; k++) {
+    if (p[k] < lo[k]) lo[k] = p[k];
+    if (p[k] > hi[k]) hi[k] = p[k];
+  }
+}
+
+void DDTrackerBoundingBox::extend(const DDTrackerBoundingBox & box) {
+
+  if (!box.valid()) return;
+  extend(box.lo[0], box.lo[1], box.lo[2]);
+  extend(box.hi[0], box.hi[1], box.hi[2]);
+}
+
+bool DDTrackerBoundingBox::contains(double x, double y, double z,
+				    double tol) const {
+  return (x >= lo[0]-tol && x <= hi[0]+tol && y >= lo[1]-tol &&
+	  y <= hi[1]+tol && z >= lo[2]-tol && z <= hi[2]+tol);
+}
+
+bool DDTrackerBoundingBox::overlaps(const DDTrackerBoundingBox & box,
+				    double tol) const {
+
+  for (int k=0; k<3; k++)
+    if (box.lo[k] > hi[k]-tol || box.hi[k] < lo[k]+tol) return false;
+  return true;
+}
+
+DDTrackerBoundingBox
+DDTrackerBoundingBox::transformed(const DDRotationMatrix & rot,
+				  const DDTranslation & tran) const {
+
+  if (!valid()) return *this;
+  double r[9];
+  rot.GetComponents(r);
+  double c[3] = {center(0), center(1), center(2)};
+  double h[3] = {half(0), half(1), half(2)};
+  double t[3] = {tran.x(), tran.y(), tran.z()};
+  DDTrackerBoundingBox box;
+  for (int i=0; i<3; i++) {
+    double ci = t[i], hi_ = 0;
+    for (int j=0; j<3; j++) {
+      ci  += r[3*i+j]*c[j];
+      hi_ += std::fabs(r[3*i+j])*h[j];
+    }
+    box.lo[i] = ci - hi_;
+    box.hi[i] = ci + hi_;
+  }
+  return box;
+}
+
+void DDTrackerBoundingBox::extendPhi(double rmin, double rmax, double phi0,
+				     double dphi, double zmin, double zmax) {
+
+  if (dphi >= CLHEP::twopi - 1.e-9) {
+    extend(-rmax, -rmax, zmin);
+    extend( rmax,  rmax, zmax);
+    return;
+  }
+  double phi1 = phi0 + dphi;
+  extend(rmin*cos(phi0), rmin*sin(phi0), zmin);
+  extend(rmin*cos(phi1), rmin*sin(phi1), zmin);
+  extend(rmax*cos(phi0), rmax*sin(phi0), zmax);
+  extend(rmax*cos(phi1), rmax*sin(phi1), zmax);
+  //Axis crossings inside the phi range reach rmax
+  int k0 = (int)(ceil(phi0/CLHEP::halfpi));
+  for (int k=k0; k*CLHEP::halfpi <= phi1; k++) {
+    double phi = k*CLHEP::halfpi;
+    extend(rmax*cos(phi), rmax*sin(phi), zmax);
+  }
+}
@@ -0,0 +1,359 @@
+///////////////////////////////////////////////////////////////////////////////
+// File: DDTrackerModuleIndex.cc
+// Description: Phi-binned index of modules positioned in regular rings
+///////////////////////////////////////////////////////////////////////////////
+
+#include <cmath>
+#include <algorithm>
+#include <fstream>
+
+#include "FWCore/MessageLogger/interface/MessageLogger.h"
+#include "DetectorDescription/Core/interface/DDLogicalPart.h"
+#include "DetectorDescription/Core/interface/DDSolid.h"
+#include "Geometry/TrackerCommonData/interface/DDTrackerBoundingBox.h"
+#include "Geometry/TrackerCommonData/interface/DDTrackerModuleIndex.h"
+#include "Geometry/TrackerCommonData/interface/DDTrackerTransformCache.h"
+#include "CLHEP/Units/GlobalPhysicalConstants.h"
+#include "CLHEP/Units/GlobalSystemOfUnits.h"
+
+namespace {
+
+  const unsigned int version = 1;
+  const double       zBinWidth = 100*CLHEP::mm;
+  const int          maxZBins  = 1000;
+
+  void writeUInt(std::ofstream & out, unsigned int value) {
+    out.write(reinterpret_cast<const char*>(&value), sizeof(value));
+  }
+
+  void writeDouble(std::ofstream & out, double value) {
+    out.write(reinterpret_cast<const char*>(&value), sizeof(value));
+  }
+
+  void writeName(std::ofstream & out, const DDName & name) {
+    writeUInt(out, (unsigned int)(name.ns().size()));
+    out.write(name.ns().c_str(), name.ns().size());
+    writeUInt(out, (unsigned int)(name.name().size()));
+    out.write(name.name().c_str(), name.name().size());
+  }
+
+  unsigned int readUInt(std::ifstream & in) {
+    unsigned int value = 0;
+    in.read(reinterpret_cast<char*>(&value), sizeof(value));
+    return value;
+  }
+
+  double readDouble(std::ifstream & in) {
+    double value = 0;
+    in.read(reinterpret_cast<char*>(&value), sizeof(value));
+    return value;
+  }
+
+  std::string readString(std::ifstream & in) {
+    unsigned int n = readUInt(in);
+    if (!in || n > 4096) {
+      in.setstate(std::ios::failbit);
+      return std::string();
+    }
+    std::string text(n, ' ');
+    if (n > 0) in.read(&text[0], n);
+    return text;
+  }
+
+  DDName readName(std::ifstream & in) {
+    std::string ns = readString(in);
+    return DDName(readString(in), ns);
+  }
+}
+
+DDTrackerModuleIndex::Layer::Layer(int nBins, double phiOffset) :
+  phiOffset_(phiOffset), invWidth_((nBins > 0 ? nBins : 1)/CLHEP::twopi),
+  bins_(nBins > 0 ? nBins : 1) {
+  for (int k=0; k<3; k++) { lo[k] = 1.e30; hi[k] = -1.e30; }
+}
+
+int DDTrackerModuleIndex::Layer::bin(double phi) const {
+
+  int n = (int)(bins_.size());
+  int i = (int)(floor((phi-phiOffset_)*invWidth_ + 0.5)) % n;
+  return (i < 0) ? i+n : i;
+}
+
+void DDTrackerModuleIndex::Layer::add(const Module & module) {
+  bins_[bin(module.phi)].push_back(module);
+}
+
+void DDTrackerModuleIndex::Layer::candidates(double x, double y,
+					     std::vector<Module> & result) const {
+
+  int n = (int)(bins_.size());
+  int i = bin(atan2(y, x));
+  int k1 = (n > 2) ? -1 : 0;
+  int k2 = (n > 2) ?  1 : n-1;
+  for (int k=k1; k<=k2; k++) {
+    const std::vector<Module> & mods = bins_[(i+k+n)%n];
+    result.insert(result.end(), mods.begin(), mods.end());
+  }
+}
+
+DDTrackerModuleIndex::DDTrackerModuleIndex() : zmin_(0), zmax_(0), invDz_(0) {}
+
+int DDTrackerModuleIndex::fill(const DDTrackerTransformCache & cache,
+			       const std::vector<DDName> & layers,
+			       const std::vector<DDName> & children,
+			       const std::vector<DDName> & sensors) {
+
+  std::vector<DDName> sensitive(sensors);
+  std::sort(sensitive.begin(), sensitive.end());
+  int found = 0;
+  for (int n=0; n<cache.nodes(); n++) {
+    const DDName & name = cache.part(n);
+    if (std::find(layers.begin(), layers.end(), name) == layers.end())
+      continue;
+    Instance instance;
+    instance.layer = name;
+    std::copy(cache.global(n), cache.global(n)+12, instance.global);
+    instances_.push_back(instance);
+    //Other placements of the layer have the same daughters
+    if (layers_.find(name) != layers_.end()) continue;
+
+    std::vector<Module> modules;
+    for (int c=n+1; c<n+cache.size(n); c+=cache.size(c)) {
+      if (!children.empty() &&
+	  std::find(children.begin(), children.end(), cache.part(c)) ==
+	  children.end()) continue;
+      const double* m = cache.local(c);
+      if (m[3]*m[3]+m[7]*m[7] < 1.e-12*CLHEP::mm*CLHEP::mm) continue;
+      if (!sensitive.empty()) {
+	bool active = false;
+	for (int s=c; s<c+cache.size(c) && !active; s++)
+	  active = std::binary_search(sensitive.begin(), sensitive.end(),
+				      cache.part(s));
+	if (!active) continue;
+      }
+      Module module;
+      module.child  = cache.part(c);
+      module.copyNo = cache.copyNo(c);
+      module.phi    = atan2(m[7], m[3]);
+      modules.push_back(module);
+    }
+    Layer layer((int)(modules.size()),
+		modules.empty() ? 0 : modules[0].phi);
+    DDTrackerBoundingBox box(DDLogicalPart(name).solid());
+    for (int k=0; k<3; k++) { layer.lo[k] = box.lo[k]; layer.hi[k] = box.hi[k]; }
+    for (unsigned int i=0; i<modules.size(); i++) layer.add(modules[i]);
+    layers_.insert(std::pair<DDName,Layer>(name, layer));
+    ++found;
+    LogDebug("TrackerGeom") << "DDTrackerModuleIndex: " << name << " with "
+			    << modules.size() << " modules from "
+			    << layer.phiOffset()/CLHEP::deg;
+  }
+  bin();
+  return found;
+}
+
+void DDTrackerModuleIndex::clear() {
+  layers_.clear();
+  instances_.clear();
+  zBins_.clear();
+  zmin_ = zmax_ = invDz_ = 0;
+}
+
+void DDTrackerModuleIndex::bin() {
+
+  //World box of every placement; those of a layer without a box are
+  //put in every z bin
+  zBins_.clear();
+  zmin_ = 1.e30; zmax_ = -1.e30;
+  for (unsigned int i=0; i<instances_.size(); i++) {
+    Instance & instance = instances_[i];
+    const Layer* lay = layer(instance.layer);
+    for (int k=0; k<3; k++) { instance.lo[k] = -1.e30; instance.hi[k] = 1.e30; }
+    if (lay == 0 || lay->lo[0] > lay->hi[0]) continue;
+    DDRotationMatrix rot;
+    DDTranslation    tran;
+    DDTrackerTransformCache::transform(instance.global, rot, tran);
+    DDTrackerBoundingBox box = DDTrackerBoundingBox(lay->lo[0], lay->lo[1],
+						    lay->lo[2], lay->hi[0],
+						    lay->hi[1], lay->hi[2]).transformed(rot, tran);
+    for (int k=0; k<3; k++) { instance.lo[k] = box.lo[k]; instance.hi[k] = box.hi[k]; }
+    zmin_ = std::min(zmin_, box.lo[2]);
+    zmax_ = std::max(zmax_, box.hi[2]);
+  }
+  if (instances_.empty()) { zmin_ = zmax_ = invDz_ = 0; return; }
+  if (zmin_ > zmax_) zmin_ = zmax_ = 0;
+
+  int nz = std::max(1, std::min(maxZBins, (int)(ceil((zmax_-zmin_)/zBinWidth))));
+  invDz_ = (zmax_ > zmin_) ? nz/(zmax_-zmin_) : 0;
+  zBins_.resize(nz);
+  for (unsigned int i=0; i<instances_.size(); i++) {
+    int b1 = 0, b2 = nz-1;
+    if (instances_[i].lo[2] > -1.e30) {
+      b1 = std::max(0,    (int)((instances_[i].lo[2]-zmin_)*invDz_));
+      b2 = std::min(nz-1, (int)((instances_[i].hi[2]-zmin_)*invDz_));
+    }
+    for (int b=b1; b<=b2; b++) zBins_[b].push_back((int)(i));
+  }
+  LogDebug("TrackerGeom") << "DDTrackerModuleIndex: " << instances_.size()
+			  << " placements in " << nz << " z bins from "
+			  << zmin_ << " to " << zmax_;
+}
+
+bool DDTrackerModuleIndex::write(const std::string & file) const {
+
+  std::ofstream out(file.c_str(), std::ios::out | std::ios::binary);
+  if (!out) {
+    edm::LogError("TrackerGeom") << "DDTrackerModuleIndex: cannot open "
+				 << file;
+    return false;
+  }
+
+  out.write("TKMIDX01", 8);
+  writeUInt(out, version);
+  writeUInt(out, (unsigned int)(layers_.size()));
+  writeUInt(out, (unsigned int)(instances_.size()));
+  for (std::map<DDName, Layer>::const_iterator it=layers_.begin();
+       it != layers_.end(); ++it) {
+    const Layer & layer = it->second;
+    writeName(out, it->first);
+    writeUInt(out, (unsigned int)(layer.nBins()));
+    writeDouble(out, layer.phiOffset());
+    for (int k=0; k<3; k++) writeDouble(out, layer.lo[k]);
+    for (int k=0; k<3; k++) writeDouble(out, layer.hi[k]);
+    unsigned int nmod = 0;
+    for (int b=0; b<layer.nBins(); b++) nmod += layer.modules(b).size();
+    writeUInt(out, nmod);
+    for (int b=0; b<layer.nBins(); b++) {
+      const std::vector<Module> & mods = layer.modules(b);
+      for (unsigned int i=0; i<mods.size(); i++) {
+	writeName(out, mods[i].child);
+	writeUInt(out, (unsigned int)(mods[i].copyNo));
+	writeDouble(out, mods[i].phi);
+      }
+    }
+  }
+  for (unsigned int i=0; i<instances_.size(); i++) {
+    writeName(out, instances_[i].layer);
+    for (int k=0; k<12; k++) writeDouble(out, instances_[i].global[k]);
+  }
+
+  LogDebug("TrackerGeom") << "DDTrackerModuleIndex: " << layers_.size()
+			  << " layers placed " << instances_.size()
+			  << " times written to " << file;
+  return out.good();
+}
+
+bool DDTrackerModuleIndex::open(const std::string & file) {
+
+  clear();
+  std::ifstream in(file.c_str(), std::ios::in | std::ios::binary);
+  char magic[8];
+  if (!in || !in.read(magic, 8) || std::string(magic, 8) != "TKMIDX01" ||
+      readUInt(in) != version) {
+    edm::LogError("TrackerGeom") << "DDTrackerModuleIndex: " << file
+				 << " is not a module index of version "
+				 << version;
+    return false;
+  }
+
+  unsigned int nlay = readUInt(in);
+  unsigned int ninst = readUInt(in);
+  for (unsigned int l=0; l<nlay && in; l++) {
+    DDName name = readName(in);
+    int nBins = (int)(readUInt(in));
+    Layer layer(nBins, readDouble(in));
+    for (int k=0; k<3; k++) layer.lo[k] = readDouble(in);
+    for (int k=0; k<3; k++) layer.hi[k] = readDouble(in);
+    unsigned int nmod = readUInt(in);
+    for (unsigned int i=0; i<nmod && in; i++) {
+      Module module;
+      module.child  = readName(in);
+      module.copyNo = (int)(readUInt(in));
+      module.phi    = readDouble(in);
+      layer.add(module);
+    }
+    layers_.insert(std::pair<DDName,Layer>(name, layer));
+  }
+  for (unsigned int i=0; i<ninst && in; i++) {
+    Instance instance;
+    instance.layer = readName(in);
+    for (int k=0; k<12; k++) instance.global[k] = readDouble(in);
+    instances_.push_back(instance);
+  }
+  if (!in) {
+    edm::LogError("TrackerGeom") << "DDTrackerModuleIndex: " << file
+				 << " is truncated";
+    clear();
+    return false;
+  }
+  bin();
+  return true;
+}
+
+const DDTrackerModuleIndex::Layer*
+DDTrackerModuleIndex::layer(const DDName & layer) const {
+
+  std::map<DDName, Layer>::const_iterator it = layers_.find(layer);
+  return (it == layers_.end()) ? 0 : &(it->second);
+}
+
+std::vector<DDTrackerModuleIndex::Module>
+DDTrackerModuleIndex::candidates(const DDName & name,
+				 const DDTranslation & point) const {
+
+  std::vector<Module> result;
+  const Layer* lay = layer(name);
+  if (lay) lay->candidates(point.x(), point.y(), result);
+  return result;
+}
+
+std::vector<DDTrackerModuleIndex::Hit>
+DDTrackerModuleIndex::candidates(const DDTranslation & point) const {
+
+  std::vector<Hit>    result;
+  if (zBins_.empty()) return result;
+  //Out of the binned range only the placements without a box (which
+  //are in every bin) can hold the point
+  double pz = point.z();
+  int nz = (int)(zBins_.size());
+  int b  = std::max(0, std::min(nz-1, (int)((pz-zmin_)*invDz_)));
+  const std::vector<int> & inBin = zBins_[b];
+  std::vector<Module> mods;
+  for (unsigned int j=0; j<inBin.size(); j++) {
+    int i = inBin[j];
+    const Instance & inst = instances_[i];
+    if (point.x() < inst.lo[0] || point.x() > inst.hi[0] ||
+	point.y() < inst.lo[1] || point.y() > inst.hi[1] ||
+	pz < inst.lo[2] || pz > inst.hi[2]) continue;
+    const Layer* lay = layer(inst.layer);
+    if (lay == 0) continue;
+    //Point in the frame of the layer: R^T (point - t)
+    const double* m = inst.global;
+    double dx = point.x()-m[3], dy = point.y()-m[7], dz = point.z()-m[11];
+    double x  = m[0]*dx + m[4]*dy + m[8]*dz;
+    double y  = m[1]*dx + m[5]*dy + m[9]*dz;
+    double z  = m[2]*dx + m[6]*dy + m[10]*dz;
+    if (lay->lo[0] <= lay->hi[0] &&
+	(x < lay->lo[0] || x > lay->hi[0] || y < lay->lo[1] ||
+	 y > lay->hi[1] || z < lay->lo[2] || z > lay->hi[2])) continue;
+    mods.clear();
+    lay->candidates(x, y, mods);
+    for (unsigned int k=0; k<mods.size(); k++) {
+      Hit hit;
+      hit.instance = i;
+      hit.module   = mods[k];
+      result.push_back(hit);
+    }
+  }
+  return result;
+}
+
+std::vector<DDName>
+DDTrackerModuleIndex::layers(const std::string & subdetector) const {
+
+  std::vector<DDName> result;
+  for (std::map<DDName, Layer>::const_iterator it=layers_.begin();
+       it != layers_.end(); ++it)
+    if (it->first.ns() == subdetector) result.push_back(it->first);
+  return result;
+}
@@ -0,0 +1,318 @@
+///////////////////////////////////////////////////////////////////////////////
+// File: DDTrackerSpecParMatcher.cc
+// Description: Matcher of all the SpecPar part selectors in one pass
+///////////////////////////////////////////////////////////////////////////////
+
+#include <algorithm>
+#include <fstream>
+#include <sstream>
+
+#include "FWCore/MessageLogger/interface/MessageLogger.h"
+#include "Geometry/TrackerCommonData/interface/DDTrackerSpecParMatcher.h"
+#include "Geometry/TrackerCommonData/interface/DDTrackerTransformCache.h"
+
+namespace {
+
+  std::string attribute(const std::string & tag, const std::string & name) {
+
+    std::string key = name + "=\"";
+    std::string::size_type pos = 0;
+    while ((pos = tag.find(key, pos)) != std::string::npos) {
+      if (pos == 0 || tag[pos-1] == ' ' || tag[pos-1] == '\t' ||
+	  tag[pos-1] == '\n' || tag[pos-1] == '\r') {
+	std::string::size_type end = tag.find('"', pos+key.size());
+	if (end == std::string::npos) break;
+	return tag.substr(pos+key.size(), end-pos-key.size());
+      }
+      pos += key.size();
+    }
+    return "";
+  }
+
+  //Tags <name ...> in text[begin, end)
+  void tags(const std::string & text, std::string::size_type begin,
+	    std::string::size_type end, const std::string & name,
+	    std::vector<std::string> & result) {
+
+    std::string open = "<" + name;
+    std::string::size_type pos = begin;
+    while ((pos = text.find(open, pos)) != std::string::npos && pos < end) {
+      std::string::size_type close = text.find('>', pos);
+      if (close == std::string::npos || close > end) break;
+      char next = text[pos+open.size()];
+      if (next == ' ' || next == '\t' || next == '\n' || next == '\r' ||
+	  next == '/' || next == '>')
+	result.push_back(text.substr(pos, close-pos+1));
+      pos = close;
+    }
+  }
+
+  //Steps of a selector, from the last one upwards;
+  //second is true if the step may be any ancestor of the step below it
+  //("//") rather than its mother ("/")
+  void steps(const std::string & path,
+	     std::vector<std::pair<std::string,bool> > & result) {
+
+    std::vector<std::string> names;
+    std::vector<bool>        any;    //"//" before the step
+    bool slashes = false;
+    std::string::size_type pos = 0;
+    while (pos < path.size()) {
+      std::string::size_type next = path.find('/', pos);
+      if (next == std::string::npos) next = path.size();
+      if (next > pos) {
+	names.push_back(path.substr(pos, next-pos));
+	any.push_back(slashes);
+	slashes = false;
+      } else if (pos > 0) {
+	slashes = true;
+      }
+      pos = next+1;
+    }
+    result.clear();
+    for (int k=(int)(names.size())-1; k>=0; k--)
+      result.push_back(std::pair<std::string,bool>
+		       (names[k], (k+1 < (int)(names.size())) && any[k+1]));
+  }
+}
+
+DDTrackerSpecParMatcher::DDTrackerSpecParMatcher() : compiled_(false) {}
+
+int DDTrackerSpecParMatcher::readFile(const std::string & file) {
+
+  std::ifstream in(file.c_str());
+  if (!in) {
+    edm::LogError("TrackerGeom") << "DDTrackerSpecParMatcher: cannot open "
+				 << file;
+    return 0;
+  }
+  std::stringstream buffer;
+  buffer << in.rdbuf();
+  std::string text = buffer.str();
+
+  int n = 0;
+  std::string::size_type pos = 0;
+  while ((pos = text.find("<SpecPar", pos)) != std::string::npos) {
+    std::string::size_type close = text.find('>', pos);
+    if (close == std::string::npos) break;
+    char next = text[pos+8];
+    if (next != ' ' && next != '\t' && next != '\n' && next != '\r') {
+      pos = close;
+      continue;
+    }
+    std::string::size_type end = text.find("</SpecPar>", close);
+    if (end == std::string::npos) end = text.size();
+
+    SpecPar specPar;
+    specPar.name    = attribute(text.substr(pos, close-pos+1), "name");
+    specPar.file    = file;
+    std::vector<std::string> found;
+    tags(text, close, end, "PartSelector", found);
+    for (unsigned int i=0; i<found.size(); i++)
+      specPar.selectors.push_back(attribute(found[i], "path"));
+    found.clear();
+    tags(text, close, end, "Parameter", found);
+    for (unsigned int i=0; i<found.size(); i++)
+      specPar.parameters.push_back(std::pair<std::string,std::string>
+				   (attribute(found[i], "name"),
+				    attribute(found[i], "value")));
+    addSpecPar(specPar);
+    n++;
+    pos = end;
+  }
+  LogDebug("TrackerGeom") << "DDTrackerSpecParMatcher: " << n
+			  << " SpecPars read from " << file;
+  return n;
+}
+
+void DDTrackerSpecParMatcher::addSpecPar(const SpecPar & specPar) {
+
+  specPars_.push_back(specPar);
+  compiled_ = false;
+}
+
+void DDTrackerSpecParMatcher::compile() {
+
+  trie_.clear();
+  trie_.push_back(Step());
+  std::vector<std::pair<std::string,bool> > path;
+  int nsel = 0;
+  for (unsigned int s=0; s<specPars_.size(); s++) {
+    for (unsigned int k=0; k<specPars_[s].selectors.size(); k++) {
+      const std::string & selector = specPars_[s].selectors[k];
+      if (selector.compare(0, 2, "//") != 0) {
+	edm::LogWarning("TrackerGeom") << "DDTrackerSpecParMatcher: selector "
+				       << selector << " of "
+				       << specPars_[s].name << " is not of "
+				       << "the form //A/B/Name and is ignored";
+	continue;
+      }
+      steps(selector, path);
+      //The edges of step 0 match the volume itself
+      int t = 0;
+      for (unsigned int i=0; i<path.size(); i++) {
+	int  name = intern(path[i].first);
+	bool any  = (i > 0 && path[i].second);
+	std::map<int, int> & edges = any ? trie_[t].ancestor : trie_[t].mother;
+	std::map<int, int>::const_iterator it = edges.find(name);
+	if (it == edges.end()) {
+	  int next = (int)(trie_.size());
+	  edges[name] = next;
+	  trie_.push_back(Step());
+	  t = next;
+	} else {
+	  t = it->second;
+	}
+      }
+      if (std::find(trie_[t].specPars.begin(), trie_[t].specPars.end(),
+		    (int)(s)) == trie_[t].specPars.end())
+	trie_[t].specPars.push_back(s);
+      nsel++;
+    }
+  }
+  compiled_ = true;
+  LogDebug("TrackerGeom") << "DDTrackerSpecParMatcher: " << nsel
+			  << " selectors of " << specPars_.size()
+			  << " SpecPars compiled into " << trie_.size()
+			  << " steps over " << names_.size() << " names";
+}
+
+void DDTrackerSpecParMatcher::match(const DDTrackerTransformCache & cache,
+				    int first, int last,
+				    std::vector<int> & offsets,
+				    std::vector<int> & ids) const {
+
+  //Name ids of each logical part, computed once
+  std::map<DDName, std::pair<int,int> > partName;
+  std::vector<int> parents(cache.nodes()), qualified(cache.nodes()),
+    bare(cache.nodes());
+  for (int i=0; i<cache.nodes(); i++) {
+    const DDName & part = cache.part(i);
+    std::map<DDName, std::pair<int,int> >::const_iterator it =
+      partName.find(part);
+    if (it == partName.end())
+      it = partName.insert(std::make_pair(part, std::make_pair
+					  (id(part.fullname()),
+					   id(part.name())))).first;
+    parents[i]   = cache.parent(i);
+    qualified[i] = it->second.first;
+    bare[i]      = it->second.second;
+  }
+  matchNodes(parents, qualified, bare, first, last, offsets, ids);
+}
+
+void DDTrackerSpecParMatcher::match(const std::vector<int> & parents,
+				    const std::vector<std::string> & names,
+				    std::vector<int> & offsets,
+				    std::vector<int> & ids) const {
+
+  std::vector<int> qualified(names.size(), -1), bare(names.size());
+  for (unsigned int i=0; i<names.size(); i++) {
+    std::string::size_type colon = names[i].find(':');
+    if (colon == std::string::npos) {
+      bare[i] = id(names[i]);
+    } else {
+      qualified[i] = id(names[i]);
+      bare[i]      = id(names[i].substr(colon+1));
+    }
+  }
+  matchNodes(parents, qualified, bare, 0, (int)(names.size()), offsets,
+	     ids);
+}
+
+int DDTrackerSpecParMatcher::specPar(const std::string & name) const {
+
+  for (unsigned int s=0; s<specPars_.size(); s++)
+    if (specPars_[s].name == name) return (int)(s);
+  return -1;
+}
+
+void DDTrackerSpecParMatcher::report(const std::vector<int> & ids) const {
+
+  std::vector<int> matches(specPars_.size(), 0);
+  for (unsigned int k=0; k<ids.size(); k++) matches[ids[k]]++;
+  for (unsigned int s=0; s<specPars_.size(); s++) {
+    if (matches[s] == 0)
+      edm::LogWarning("TrackerGeom") << "DDTrackerSpecParMatcher: SpecPar "
+				     << specPars_[s].name << " of "
+				     << specPars_[s].file
+				     << " matches no volume";
+    else
+      edm::LogInfo("TrackerGeom") << "DDTrackerSpecParMatcher: SpecPar "
+				  << specPars_[s].name << " of "
+				  << specPars_[s].file << " matches "
+				  << matches[s] << " volumes";
+  }
+}
+
+void DDTrackerSpecParMatcher::matchNodes(const std::vector<int> & parents,
+					 const std::vector<int> & qualified,
+					 const std::vector<int> & bare,
+					 int first, int last,
+					 std::vector<int> & offsets,
+					 std::vector<int> & ids) const {
+
+  offsets.clear();
+  ids.clear();
+  offsets.push_back(0);
+  if (!compiled_) {
+    edm::LogError("TrackerGeom") << "DDTrackerSpecParMatcher: the selectors "
+				 << "must be compiled before matching";
+    offsets.resize(last-first+1, 0);
+    return;
+  }
+
+  //Walk up the ancestors with the steps expected in the next volume up
+  //(mother) and those expected in any volume further up (ancestor)
+  std::vector<int> found, mother, next, ancestor, reached;
+  for (int i=first; i<last; i++) {
+    found.clear();
+    ancestor.clear();
+    mother.assign(1, 0);
+    for (int node=i; node >= 0 && !(mother.empty() && ancestor.empty());
+	 node=parents[node]) {
+      next.clear();
+      reached.clear();
+      int keys[2] = {qualified[node], bare[node]};
+      for (int j=0; j<2; j++) {
+	if (keys[j] < 0) continue;
+	for (unsigned int k=0; k<mother.size(); k++) {
+	  std::map<int, int>::const_iterator it = trie_[mother[k]].mother.find(keys[j]);
+	  if (it != trie_[mother[k]].mother.end()) reached.push_back(it->second);
+	}
+	for (unsigned int k=0; k<ancestor.size(); k++) {
+	  std::map<int, int>::const_iterator it = trie_[ancestor[k]].ancestor.find(keys[j]);
+	  if (it != trie_[ancestor[k]].ancestor.end()) reached.push_back(it->second);
+	}
+      }
+      for (unsigned int k=0; k<reached.size(); k++) {
+	const Step & step = trie_[reached[k]];
+	found.insert(found.end(), step.specPars.begin(), step.specPars.end());
+	if (!step.mother.empty())   next.push_back(reached[k]);
+	if (!step.ancestor.empty()) ancestor.push_back(reached[k]);
+      }
+      std::sort(ancestor.begin(), ancestor.end());
+      ancestor.erase(std::unique(ancestor.begin(), ancestor.end()), ancestor.end());
+      mother.swap(next);
+    }
+    std::sort(found.begin(), found.end());
+    found.erase(std::unique(found.begin(), found.end()), found.end());
+    ids.insert(ids.end(), found.begin(), found.end());
+    offsets.push_back((int)(ids.size()));
+  }
+}
+
+int DDTrackerSpecParMatcher::intern(const std::string & name) {
+
+  std::map<std::string, int>::const_iterator it = names_.find(name);
+  if (it != names_.end()) return it->second;
+  int n = (int)(names_.size());
+  names_[name] = n;
+  return n;
+}
+
+int DDTrackerSpecParMatcher::id(const std::string & name) const {
+
+  std::map<std::string, int>::const_iterator it = names_.find(name);
+  return (it == names_.end()) ? -1 : it->second;
+}
@@ -0,0 +1,166 @@
+///////////////////////////////////////////////////////////////////////////////
+// File: DDTrackerStructureIndex.cc
+// Description: Index of the placed volumes by structure level and copy
+//              number path
+///////////////////////////////////////////////////////////////////////////////
+
+#include <algorithm>
+
+#include "FWCore/MessageLogger/interface/MessageLogger.h"
+#include "Geometry/TrackerCommonData/interface/DDTrackerSpecParMatcher.h"
+#include "Geometry/TrackerCommonData/interface/DDTrackerStructureIndex.h"
+#include "Geometry/TrackerCommonData/interface/DDTrackerTransformCache.h"
+
+DDTrackerStructureIndex::DDTrackerStructureIndex(const DDTrackerTransformCache & cache,
+						 const DDTrackerSpecParMatcher & matcher,
+						 const std::string & parameter) {
+
+  std::vector<int> parents, offsets, ids;
+  for (int i=0; i<cache.nodes(); i++) {
+    parents.push_back(cache.parent(i));
+    copyNo_.push_back(cache.copyNo(i));
+  }
+  matcher.match(cache, 0, cache.nodes(), offsets, ids);
+  fill(parents, matcher, offsets, ids, parameter);
+}
+
+DDTrackerStructureIndex::DDTrackerStructureIndex(const std::vector<int> & parents,
+						 const std::vector<std::string> & names,
+						 const std::vector<int> & copyNos,
+						 const DDTrackerSpecParMatcher & matcher,
+						 const std::string & parameter) :
+  copyNo_(copyNos) {
+
+  std::vector<int> offsets, ids;
+  matcher.match(parents, names, offsets, ids);
+  fill(parents, matcher, offsets, ids, parameter);
+}
+
+int DDTrackerStructureIndex::level(const std::string & name) const {
+
+  std::vector<std::string>::const_iterator it =
+    std::lower_bound(levels_.begin(), levels_.end(), name);
+  if (it == levels_.end() || *it != name) return -1;
+  return (int)(it - levels_.begin());
+}
+
+int DDTrackerStructureIndex::find(int level,
+				  const std::vector<int> & path) const {
+
+  if (level < 0 || level >= (int)(levels_.size())) return -1;
+  int t = level;
+  for (unsigned int k=0; k<path.size(); k++) {
+    if (path[k] < 0 || path[k] >= (int)(trie_[t].next.size())) return -1;
+    t = trie_[t].next[path[k]];
+    if (t < 0) return -1;
+  }
+  return trie_[t].node;
+}
+
+int DDTrackerStructureIndex::find(const std::string & name,
+				  const std::vector<int> & path) const {
+  return find(level(name), path);
+}
+
+void DDTrackerStructureIndex::path(int node, std::vector<int> & result) const {
+
+  result.clear();
+  if (nodeLevel_[node] >= 0) result.push_back(copyNo_[node]);
+  for (int a=tagged_[node]; a >= 0; a=tagged_[a])
+    result.push_back(copyNo_[a]);
+  std::reverse(result.begin(), result.end());
+}
+
+void DDTrackerStructureIndex::fill(const std::vector<int> & parents,
+				   const DDTrackerSpecParMatcher & matcher,
+				   const std::vector<int> & offsets,
+				   const std::vector<int> & ids,
+				   const std::string & parameter) {
+
+  //Level of every SpecPar (-1 if it has no structure parameter)
+  const std::vector<DDTrackerSpecParMatcher::SpecPar> & specPars = matcher.specPars();
+  std::vector<std::string> values(specPars.size());
+  for (unsigned int s=0; s<specPars.size(); s++) {
+    for (unsigned int k=0; k<specPars[s].parameters.size(); k++) {
+      if (specPars[s].parameters[k].first == parameter) {
+	values[s] = specPars[s].parameters[k].second;
+	if (std::find(levels_.begin(), levels_.end(), values[s]) == levels_.end())
+	  levels_.push_back(values[s]);
+	break;
+      }
+    }
+  }
+  std::sort(levels_.begin(), levels_.end());
+  std::vector<int> specParLevel(specPars.size(), -1);
+  for (unsigned int s=0; s<specPars.size(); s++)
+    if (!values[s].empty()) specParLevel[s] = level(values[s]);
+
+  int nlevel = (int)(levels_.size());
+  members_.resize(nlevel);
+  TrieNode root;
+  root.node = -1;
+  trie_.resize(nlevel, root);
+
+  int n = (int)(parents.size());
+  nodeLevel_.resize(n, -1);
+  tagged_.resize(n, -1);
+  std::vector<int> copies;
+  for (int i=0; i<n; i++) {
+    int p = parents[i];
+    if (p >= 0) tagged_[i] = (nodeLevel_[p] >= 0) ? p : tagged_[p];
+    for (int k=offsets[i]; k<offsets[i+1]; k++) {
+      int l = specParLevel[ids[k]];
+      if (l < 0) continue;
+      if (nodeLevel_[i] >= 0 && nodeLevel_[i] != l) {
+	edm::LogWarning("TrackerGeom") << "DDTrackerStructureIndex: node "
+				       << i << " is in levels "
+				       << levels_[nodeLevel_[i]] << " and "
+				       << levels_[l] << "; the first is kept";
+	continue;
+      }
+      nodeLevel_[i] = l;
+    }
+    if (nodeLevel_[i] < 0) continue;
+    members_[nodeLevel_[i]].push_back(i);
+    path(i, copies);
+    insert(nodeLevel_[i], copies, i);
+  }
+
+  LogDebug("TrackerGeom") << "DDTrackerStructureIndex: " << nlevel
+			  << " levels over " << n << " nodes, trie of "
+			  << trie_.size() << " entries";
+  for (int l=0; l<nlevel; l++)
+    LogDebug("TrackerGeom") << "\t" << levels_[l] << " with "
+			    << members_[l].size() << " volumes";
+}
+
+int DDTrackerStructureIndex::insert(int level, const std::vector<int> & path,
+				    int node) {
+
+  int t = level;
+  for (unsigned int k=0; k<path.size(); k++) {
+    int copy = path[k];
+    if (copy < 0) {
+      edm::LogWarning("TrackerGeom") << "DDTrackerStructureIndex: negative "
+				     << "copy number in the path of node "
+				     << node << " is not indexed";
+      return -1;
+    }
+    if ((int)(trie_[t].next.size()) <= copy) trie_[t].next.resize(copy+1, -1);
+    if (trie_[t].next[copy] < 0) {
+      TrieNode entry;
+      entry.node = -1;
+      trie_[t].next[copy] = (int)(trie_.size());
+      trie_.push_back(entry);
+    }
+    t = trie_[t].next[copy];
+  }
+  if (trie_[t].node >= 0)
+    edm::LogWarning("TrackerGeom") << "DDTrackerStructureIndex: nodes "
+				   << trie_[t].node << " and " << node
+				   << " share the same path in level "
+				   << levels_[level];
+  else
+    trie_[t].node = node;
+  return t;
+}
@@ -0,0 +1,232 @@
+///////////////////////////////////////////////////////////////////////////////
+// File: DDTrackerTransformCache.cc
+// Description: Flat cache of the global transformations of the volumes
+//              below a root volume
+///////////////////////////////////////////////////////////////////////////////
+
+#include <algorithm>
+#include <boost/bind.hpp>
+#include <boost/thread/thread.hpp>
+
+#include "FWCore/MessageLogger/interface/MessageLogger.h"
+#include "DetectorDescription/Core/interface/DDCompactView.h"
+#include "DetectorDescription/Core/interface/DDExpandedView.h"
+#include "DetectorDescription/Core/interface/DDLogicalPart.h"
+#include "Geometry/TrackerCommonData/interface/DDTrackerTransformCache.h"
+
+namespace {
+
+  const int maxLevels = 8;     //Depth of the root below the world volume
+  const int minBlock  = 4096;  //Smallest block of nodes given to a thread
+
+  //Shared caches of the current build
+  typedef std::map<DDName, DDTrackerTransformCache*> CacheMap;
+  const DDCompactView* sharedView = 0;
+  CacheMap             sharedCaches;
+
+  //Moves the view to the first volume of logical part name found at
+  //most levels below the current volume; the view is left unchanged
+  //if there is none
+  bool locate(DDExpandedView & ev, const DDName & name, int levels) {
+
+    if (ev.logicalPart().ddname() == name) return true;
+    if (levels == 0 || !ev.firstChild()) return false;
+    do {
+      if (locate(ev, name, levels-1)) return true;
+    } while (ev.nextSibling());
+    ev.parent();
+    return false;
+  }
+}
+
+DDTrackerTransformCache::DDTrackerTransformCache(const DDCompactView & cpv,
+						 const DDName & root) :
+  root_(root) {
+
+  //The root is looked for level by level, so that the other
+  //subdetectors are not expanded
+  DDExpandedView ev(cpv);
+  bool found = false;
+  for (int levels=0; levels<=maxLevels && !found; levels++)
+    found = locate(ev, root, levels);
+  if (!found) {
+    edm::LogWarning("TrackerGeom") << "DDTrackerTransformCache: " << root_
+				   << " is not positioned in the first "
+				   << maxLevels << " levels of the geometry";
+    return;
+  }
+
+  int top = ev.depth();
+  std::vector<int> stack;
+  do {
+    int depth = ev.depth() - top;
+    int self  = nodes();
+    part_.push_back(ev.logicalPart().ddname());
+    copyNo_.push_back(ev.copyno());
+    parent_.push_back((depth > 0) ? stack[depth-1] : -1);
+    size_.push_back(1);
+    leafId_.push_back(-1);
+    global_.resize(global_.size()+12);
+    setMatrix(&global_[12*self], ev.rotation(), ev.translation());
+    stack.resize(depth+1);
+    stack[depth] = self;
+  } while (ev.next() && ev.depth() > top);
+
+  //Sizes of the subtrees, leaves and the placements of the instances
+  for (int i=nodes()-1; i>0; i--) size_[parent_[i]] += size_[i];
+  for (int i=0; i<nodes(); i++) {
+    if (size_[i] == 1) {
+      leafId_[i] = leaves();
+      leafNode_.push_back(i);
+    }
+    if (parent_[i] >= 0) {
+      Placement placement;
+      placement.mother = part_[parent_[i]];
+      placement.child  = part_[i];
+      placement.copyNo = copyNo_[i];
+      instances_.insert(std::pair<Placement,int>(placement, i));
+    }
+  }
+
+  //Local transformations: every node only needs its own global
+  //transformation and the one of its parent
+  local_.resize(global_.size());
+  int threads = (int)(boost::thread::hardware_concurrency());
+  if (threads > nodes()/minBlock) threads = nodes()/minBlock;
+  if (threads > 1) {
+    boost::thread_group group;
+    int block = (nodes()+threads-1)/threads;
+    for (int first=0; first<nodes(); first+=block) {
+      int last = std::min(first+block, nodes());
+      group.create_thread(boost::bind(&DDTrackerTransformCache::localize,
+				      this, first, last));
+    }
+    group.join_all();
+  } else {
+    localize(0, nodes());
+  }
+
+  LogDebug("TrackerGeom") << "DDTrackerTransformCache: " << root_ << " with "
+			  << nodes() << " nodes and " << leaves() << " leaves"
+			  << " (" << std::max(threads, 1) << " threads)";
+}
+
+const DDTrackerTransformCache &
+DDTrackerTransformCache::shared(const DDCompactView & cpv,
+				const DDName & root) {
+
+  if (sharedView != &cpv) {
+    release();
+    sharedView = &cpv;
+  }
+  CacheMap::iterator it = sharedCaches.find(root);
+  if (it == sharedCaches.end()) {
+    DDTrackerTransformCache* cache = new DDTrackerTransformCache(cpv, root);
+    it = sharedCaches.insert(CacheMap::value_type(root, cache)).first;
+  }
+  return *(it->second);
+}
+
+void DDTrackerTransformCache::release() {
+
+  for (CacheMap::iterator it=sharedCaches.begin(); it != sharedCaches.end();
+       ++it)
+    delete it->second;
+  sharedCaches.clear();
+  sharedView = 0;
+}
+
+void DDTrackerTransformCache::transform(const double* m, DDRotationMatrix & rot,
+					DDTranslation & tran) {
+
+  rot  = DDRotationMatrix(m[0], m[1], m[2], m[4], m[5], m[6], m[8], m[9],
+			  m[10]);
+  tran = DDTranslation(m[3], m[7], m[11]);
+}
+
+int DDTrackerTransformCache::update(const DDName & mother,
+				    const DDName & child, int copyNo,
+				    const DDRotationMatrix & rot,
+				    const DDTranslation & tran) {
+
+  Placement placement;
+  placement.mother = mother;
+  placement.child  = child;
+  placement.copyNo = copyNo;
+  int n = 0;
+  std::pair<std::multimap<Placement,int>::const_iterator,
+    std::multimap<Placement,int>::const_iterator> range = instances_.equal_range(placement);
+  for (std::multimap<Placement,int>::const_iterator it=range.first;
+       it != range.second; ++it) {
+    int node = it->second;
+    setMatrix(&local_[12*node], rot, tran);
+    compose(node, node+size_[node]);
+    n += size_[node];
+  }
+  LogDebug("TrackerGeom") << "DDTrackerTransformCache: " << child << "["
+			  << copyNo << "] in " << mother << " updated, " << n
+			  << " nodes recomputed";
+  return n;
+}
+
+bool DDTrackerTransformCache::Placement::operator<(const Placement & p) const {
+
+  if (copyNo != p.copyNo) return copyNo < p.copyNo;
+  if (child < p.child)    return true;
+  if (p.child < child)    return false;
+  return mother < p.mother;
+}
+
+void DDTrackerTransformCache::compose(int first, int last) {
+
+  //Parents precede their daughters: one forward pass is sufficient
+  for (int i=first; i<last; i++) {
+    const double* l = &local_[12*i];
+    double*       g = &global_[12*i];
+    if (parent_[i] < 0) {
+      for (int k=0; k<12; k++) g[k] = l[k];
+      continue;
+    }
+    const double* p = &global_[12*parent_[i]];
+    for (int r=0; r<3; r++) {
+      const double* pr = p + 4*r;
+      for (int c=0; c<4; c++)
+	g[4*r+c] = pr[0]*l[c] + pr[1]*l[4+c] + pr[2]*l[8+c];
+      g[4*r+3] += pr[3];
+    }
+  }
+}
+
+void DDTrackerTransformCache::localize(int first, int last) {
+
+  //The inverse of a rotation is its transpose
+  for (int i=first; i<last; i++) {
+    const double* g = &global_[12*i];
+    double*       l = &local_[12*i];
+    if (parent_[i] < 0) {
+      for (int k=0; k<12; k++) l[k] = g[k];
+      continue;
+    }
+    const double* p = &global_[12*parent_[i]];
+    for (int r=0; r<3; r++) {
+      for (int c=0; c<4; c++)
+	l[4*r+c] = p[r]*g[c] + p[4+r]*g[4+c] + p[8+r]*g[8+c];
+      l[4*r+3] -= p[r]*p[3] + p[4+r]*p[7] + p[8+r]*p[11];
+    }
+  }
+}
+
+void DDTrackerTransformCache::setMatrix(double* m, const DDRotationMatrix & rot,
+					const DDTranslation & tran) {
+
+  double r[9];
+  rot.GetComponents(r);
+  for (int i=0; i<3; i++) {
+    m[4*i]   = r[3*i];
+    m[4*i+1] = r[3*i+1];
+    m[4*i+2] = r[3*i+2];
+  }
+  m[3]  = tran.x();
+  m[7]  = tran.y();
+  m[11] = tran.z();
+}
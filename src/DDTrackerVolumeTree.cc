@@ -0,0 +1,234 @@
+///////////////////////////////////////////////////////////////////////////////
+// File: DDTrackerVolumeTree.cc
+// Description: Bounding volume hierarchy over the world boxes of the
+//              volumes below a root volume
+///////////////////////////////////////////////////////////////////////////////
+
+#include <cmath>
+#include <algorithm>
+#include <map>
+
+#include "FWCore/MessageLogger/interface/MessageLogger.h"
+#include "DetectorDescription/Core/interface/DDLogicalPart.h"
+#include "Geometry/TrackerCommonData/interface/DDTrackerTransformCache.h"
+#include "Geometry/TrackerCommonData/interface/DDTrackerVolumeTree.h"
+
+namespace {
+
+  const int   nBins    = 16;   //Bins for the surface area heuristic
+  const int   leafSize = 4;    //Always make a leaf below this size
+  const float pad      = 1.e-3;//Rounding margin of the float boxes (mm)
+
+  struct InBin {
+    InBin(const std::vector<double> & c, int axis, double cmin, double scale,
+	  int split) : c_(c), axis_(axis), cmin_(cmin), scale_(scale),
+		       split_(split) {}
+    bool operator()(int v) const {
+      int b = std::min(nBins-1, (int)((c_[3*v+axis_]-cmin_)*scale_));
+      return b <= split_;
+    }
+    const std::vector<double> & c_;
+    int axis_; double cmin_, scale_; int split_;
+  };
+
+  bool overlapNode(const DDTrackerVolumeTree::Node & node,
+		   const DDTrackerBoundingBox & box) {
+    for (int k=0; k<3; k++)
+      if (box.lo[k] > node.hi[k] || box.hi[k] < node.lo[k]) return false;
+    return true;
+  }
+
+  bool rayBox(const double* lo, const double* hi, const double* o,
+	      const double* inv, double tmax, double & tin) {
+    double t0 = 0, t1 = tmax;
+    for (int k=0; k<3; k++) {
+      double ta = (lo[k]-o[k])*inv[k];
+      double tb = (hi[k]-o[k])*inv[k];
+      if (ta > tb) std::swap(ta, tb);
+      if (ta > t0) t0 = ta;
+      if (tb < t1) t1 = tb;
+      if (t0 > t1) return false;
+    }
+    tin = t0;
+    return true;
+  }
+}
+
+DDTrackerVolumeTree::DDTrackerVolumeTree(const DDTrackerTransformCache & cache) {
+
+  //Box of every logical part in its own frame, computed once
+  std::map<DDName, DDTrackerBoundingBox> partBoxes;
+  boxes_.resize(cache.nodes());
+  for (int i=0; i<cache.nodes(); i++) {
+    std::map<DDName, DDTrackerBoundingBox>::const_iterator it =
+      partBoxes.find(cache.part(i));
+    if (it == partBoxes.end()) {
+      DDLogicalPart        part(cache.part(i));
+      DDTrackerBoundingBox box;
+      if (part.isDefined().second) box = DDTrackerBoundingBox(part.solid());
+      it = partBoxes.insert(std::pair<DDName,DDTrackerBoundingBox>
+			    (cache.part(i), box)).first;
+    }
+    if (!it->second.valid()) continue;
+    DDRotationMatrix rot;
+    DDTranslation    tran;
+    DDTrackerTransformCache::transform(cache.global(i), rot, tran);
+    boxes_[i] = it->second.transformed(rot, tran);
+  }
+  build();
+
+  LogDebug("TrackerGeom") << "DDTrackerVolumeTree: " << cache.root()
+			  << " with " << volumes() << " volumes ("
+			  << order_.size() << " bounded) from "
+			  << partBoxes.size() << " logical parts and "
+			  << nodes_.size() << " nodes";
+}
+
+DDTrackerVolumeTree::DDTrackerVolumeTree(const std::vector<DDTrackerBoundingBox> & boxes) :
+  boxes_(boxes) {
+  build();
+}
+
+void DDTrackerVolumeTree::build() {
+
+  std::vector<double> centroids(3*boxes_.size(), 0.);
+  for (unsigned int i=0; i<boxes_.size(); i++) {
+    if (!boxes_[i].valid()) continue;
+    order_.push_back(i);
+    for (int k=0; k<3; k++) centroids[3*i+k] = boxes_[i].center(k);
+  }
+  if (!order_.empty()) build(0, (int)(order_.size()), centroids);
+}
+
+int DDTrackerVolumeTree::build(int first, int last,
+			       const std::vector<double> & centroids) {
+
+  DDTrackerBoundingBox bounds, cbounds;
+  for (int i=first; i<last; i++) {
+    int v = order_[i];
+    bounds.extend(boxes_[v]);
+    cbounds.extend(centroids[3*v], centroids[3*v+1], centroids[3*v+2]);
+  }
+
+  int self = (int)(nodes_.size());
+  Node node;
+  for (int k=0; k<3; k++) {
+    node.lo[k] = (float)(bounds.lo[k]) - pad;
+    node.hi[k] = (float)(bounds.hi[k]) + pad;
+  }
+  node.index = first;
+  node.count = last-first;
+  nodes_.push_back(node);
+
+  int n = last-first;
+  if (n <= leafSize) return self;
+
+  int axis = 0;
+  for (int k=1; k<3; k++)
+    if (cbounds.half(k) > cbounds.half(axis)) axis = k;
+  double extent = 2.*cbounds.half(axis);
+  if (extent <= 0) return self;
+
+  //Binned surface area heuristic along the widest centroid axis
+  double scale = nBins/extent;
+  int                  count[nBins];
+  DDTrackerBoundingBox box[nBins];
+  for (int b=0; b<nBins; b++) count[b] = 0;
+  for (int i=first; i<last; i++) {
+    int v = order_[i];
+    int b = std::min(nBins-1, (int)((centroids[3*v+axis]-cbounds.lo[axis])*scale));
+    count[b]++;
+    box[b].extend(boxes_[v]);
+  }
+  double areaR[nBins];
+  int    countR[nBins];
+  DDTrackerBoundingBox right;
+  int    nr = 0;
+  for (int b=nBins-1; b>0; b--) {
+    right.extend(box[b]);
+    nr       += count[b];
+    areaR[b]  = right.area();
+    countR[b] = nr;
+  }
+  DDTrackerBoundingBox left;
+  int    nl = 0, split = -1;
+  double best = n*bounds.area();
+  for (int b=0; b<nBins-1; b++) {
+    left.extend(box[b]);
+    nl += count[b];
+    if (nl == 0 || countR[b+1] == 0) continue;
+    double cost = nl*left.area() + countR[b+1]*areaR[b+1];
+    if (cost < best) { best = cost; split = b; }
+  }
+  if (split < 0) return self;
+
+  std::vector<int>::iterator mid =
+    std::partition(order_.begin()+first, order_.begin()+last,
+		   InBin(centroids, axis, cbounds.lo[axis], scale, split));
+  int imid = (int)(mid - order_.begin());
+  if (imid == first || imid == last) return self;
+
+  nodes_[self].count = 0;
+  build(first, imid, centroids);
+  int iright = build(imid, last, centroids);
+  nodes_[self].index = iright;
+  return self;
+}
+
+void DDTrackerVolumeTree::findPoint(double x, double y, double z,
+				    std::vector<int> & hits) const {
+  findBox(DDTrackerBoundingBox(x, y, z, x, y, z), hits);
+}
+
+void DDTrackerVolumeTree::findBox(const DDTrackerBoundingBox & box,
+				  std::vector<int> & hits) const {
+
+  if (nodes_.empty()) return;
+  std::vector<int> stack(1, 0);
+  while (!stack.empty()) {
+    int inode = stack.back();
+    stack.pop_back();
+    const Node & node = nodes_[inode];
+    if (!overlapNode(node, box)) continue;
+    if (node.count > 0) {
+      for (int i=node.index; i<node.index+node.count; i++)
+	if (boxes_[order_[i]].overlaps(box)) hits.push_back(order_[i]);
+    } else {
+      stack.push_back(node.index);
+      stack.push_back(inode+1);
+    }
+  }
+}
+
+void DDTrackerVolumeTree::findRay(const DDTranslation & origin,
+				  const DDTranslation & dir, double tmax,
+				  std::vector<std::pair<double,int> > & hits) const {
+
+  if (nodes_.empty()) return;
+  double o[3]   = {origin.x(), origin.y(), origin.z()};
+  double d[3]   = {dir.x(), dir.y(), dir.z()};
+  double inv[3];
+  for (int k=0; k<3; k++) inv[k] = (d[k] != 0) ? 1./d[k] : 1.e30;
+
+  std::vector<int> stack(1, 0);
+  while (!stack.empty()) {
+    int inode = stack.back();
+    stack.pop_back();
+    const Node & node = nodes_[inode];
+    double lo[3] = {node.lo[0], node.lo[1], node.lo[2]};
+    double hi[3] = {node.hi[0], node.hi[1], node.hi[2]};
+    double t;
+    if (!rayBox(lo, hi, o, inv, tmax, t)) continue;
+    if (node.count > 0) {
+      for (int i=node.index; i<node.index+node.count; i++) {
+	const DDTrackerBoundingBox & box = boxes_[order_[i]];
+	if (rayBox(box.lo, box.hi, o, inv, tmax, t))
+	  hits.push_back(std::pair<double,int>(t, order_[i]));
+      }
+    } else {
+      stack.push_back(node.index);
+      stack.push_back(inode+1);
+    }
+  }
+  std::sort(hits.begin(), hits.end());
+}
@@ -0,0 +1,157 @@
+///////////////////////////////////////////////////////////////////////////////
+// File: testDDTrackerSpecParMatcher.cpp
+// Description: Unit test of the SpecPar part selector matcher
+///////////////////////////////////////////////////////////////////////////////
+
+#include <cstdio>
+#include <fstream>
+#include <cppunit/extensions/HelperMacros.h>
+
+#include "Geometry/TrackerCommonData/interface/DDTrackerSpecParMatcher.h"
+
+class testDDTrackerSpecParMatcher : public CppUnit::TestFixture {
+
+  CPPUNIT_TEST_SUITE(testDDTrackerSpecParMatcher);
+  CPPUNIT_TEST(checkMother);
+  CPPUNIT_TEST(checkAncestor);
+  CPPUNIT_TEST(checkNamespace);
+  CPPUNIT_TEST(checkReadFile);
+  CPPUNIT_TEST(checkNotCompiled);
+  CPPUNIT_TEST_SUITE_END();
+
+public:
+
+  //Tree (node name: daughters): 0 X: 1 A,  1 A: 2 B, 4 D,  2 B: 3 C,
+  //4 D: 5 C,  6 C: 7 B; 5 and 6 are in namespace tob, the others in
+  //namespace tracker
+  void setUp() {
+    int         parent[] = {-1, 0, 1, 2, 1, 4, -1, 6};
+    const char* name[]   = {"tracker:X", "tracker:A", "tracker:B",
+			    "tracker:C", "tracker:D", "tob:C", "tob:C",
+			    "tracker:B"};
+    parents.assign(parent, parent+8);
+    names.assign(name, name+8);
+  }
+
+  void checkMother();
+  void checkAncestor();
+  void checkNamespace();
+  void checkReadFile();
+  void checkNotCompiled();
+
+private:
+
+  void add(DDTrackerSpecParMatcher & matcher, const std::string & name,
+	   const std::string & selector) {
+    DDTrackerSpecParMatcher::SpecPar specPar;
+    specPar.name = name;
+    specPar.selectors.push_back(selector);
+    matcher.addSpecPar(specPar);
+  }
+
+  //Names of the SpecPars matched by node
+  std::string matched(const DDTrackerSpecParMatcher & matcher,
+		      const std::vector<int> & offsets,
+		      const std::vector<int> & ids, int node) {
+    std::string result;
+    for (int k=offsets[node]; k<offsets[node+1]; k++)
+      result += (result.empty() ? "" : " ") + matcher.specPars()[ids[k]].name;
+    return result;
+  }
+
+  std::vector<int>         parents;
+  std::vector<std::string> names;
+};
+
+CPPUNIT_TEST_SUITE_REGISTRATION(testDDTrackerSpecParMatcher);
+
+void testDDTrackerSpecParMatcher::checkMother() {
+
+  DDTrackerSpecParMatcher matcher;
+  add(matcher, "Any",   "//C");
+  add(matcher, "Child", "//tracker:A/tracker:B");
+  add(matcher, "Path",  "//X/A/B/C");
+  matcher.compile();
+  std::vector<int> offsets, ids;
+  matcher.match(parents, names, offsets, ids);
+  CPPUNIT_ASSERT(offsets.size() == names.size()+1);
+  CPPUNIT_ASSERT(matched(matcher, offsets, ids, 2) == "Child");
+  CPPUNIT_ASSERT(matched(matcher, offsets, ids, 3) == "Any Path");
+  CPPUNIT_ASSERT(matched(matcher, offsets, ids, 5) == "Any");
+  CPPUNIT_ASSERT(matched(matcher, offsets, ids, 6) == "Any");
+  CPPUNIT_ASSERT(matched(matcher, offsets, ids, 7) == "");
+}
+
+void testDDTrackerSpecParMatcher::checkAncestor() {
+
+  DDTrackerSpecParMatcher matcher;
+  add(matcher, "Below", "//A//C");
+  add(matcher, "Mixed", "//X/A//B/C");
+  matcher.compile();
+  std::vector<int> offsets, ids;
+  matcher.match(parents, names, offsets, ids);
+  CPPUNIT_ASSERT(matched(matcher, offsets, ids, 3) == "Below Mixed");
+  CPPUNIT_ASSERT(matched(matcher, offsets, ids, 5) == "Below");
+  CPPUNIT_ASSERT(matched(matcher, offsets, ids, 6) == "");
+
+  //The matching does not change the matcher
+  std::vector<int> offsets2, ids2;
+  matcher.match(parents, names, offsets2, ids2);
+  CPPUNIT_ASSERT(offsets == offsets2 && ids == ids2);
+}
+
+void testDDTrackerSpecParMatcher::checkNamespace() {
+
+  DDTrackerSpecParMatcher matcher;
+  add(matcher, "Tracker", "//tracker:C");
+  add(matcher, "TOB",     "//tob:C");
+  add(matcher, "Below",   "//tracker:D/tob:C");
+  matcher.compile();
+  std::vector<int> offsets, ids;
+  matcher.match(parents, names, offsets, ids);
+  CPPUNIT_ASSERT(matched(matcher, offsets, ids, 3) == "Tracker");
+  CPPUNIT_ASSERT(matched(matcher, offsets, ids, 5) == "TOB Below");
+  CPPUNIT_ASSERT(matched(matcher, offsets, ids, 6) == "TOB");
+
+  //Names without namespace only match the steps without namespace
+  std::vector<std::string> bare(names.size());
+  for (unsigned int i=0; i<names.size(); i++)
+    bare[i] = names[i].substr(names[i].find(':')+1);
+  matcher.match(parents, bare, offsets, ids);
+  CPPUNIT_ASSERT(ids.empty());
+}
+
+void testDDTrackerSpecParMatcher::checkReadFile() {
+
+  const char* file = "testDDTrackerSpecParMatcher.xml";
+  std::ofstream out(file);
+  out << "<DDDefinition>\n<SpecParSection label=\"test\">\n"
+      << "<SpecPar name=\"Sensitive\">\n"
+      << "  <PartSelector path=\"//A//C\"/>\n"
+      << "  <PartSelector path=\"//B\"/>\n"
+      << "  <Parameter name=\"SensitiveDetector\" value=\"Tracker\"/>\n"
+      << "</SpecPar>\n</SpecParSection>\n</DDDefinition>\n";
+  out.close();
+
+  DDTrackerSpecParMatcher matcher;
+  CPPUNIT_ASSERT(matcher.readFile(file) == 1);
+  std::remove(file);
+  CPPUNIT_ASSERT(matcher.specPars()[0].selectors.size() == 2);
+  CPPUNIT_ASSERT(matcher.specPars()[0].parameters[0].second == "Tracker");
+  matcher.compile();
+  std::vector<int> offsets, ids;
+  matcher.match(parents, names, offsets, ids);
+  CPPUNIT_ASSERT(ids.size() == 4);
+}
+
+void testDDTrackerSpecParMatcher::checkNotCompiled() {
+
+  DDTrackerSpecParMatcher matcher;
+  add(matcher, "Any", "//C");
+  std::vector<int> offsets, ids;
+  matcher.match(parents, names, offsets, ids);
+  CPPUNIT_ASSERT(!matcher.compiled());
+  CPPUNIT_ASSERT(offsets.size() == names.size()+1 && ids.empty());
+}
+
+#include "Utilities/Testing/interface/CppUnit_testdriver.icpp"
@@ -0,0 +1,110 @@
+///////////////////////////////////////////////////////////////////////////////
+// File: testDDTrackerStructureIndex.cpp
+// Description: Unit test of the index by structure level and copy path
+///////////////////////////////////////////////////////////////////////////////
+
+#include <cppunit/extensions/HelperMacros.h>
+
+#include "Geometry/TrackerCommonData/interface/DDTrackerSpecParMatcher.h"
+#include "Geometry/TrackerCommonData/interface/DDTrackerStructureIndex.h"
+
+class testDDTrackerStructureIndex : public CppUnit::TestFixture {
+
+  CPPUNIT_TEST_SUITE(testDDTrackerStructureIndex);
+  CPPUNIT_TEST(checkLevels);
+  CPPUNIT_TEST(checkFind);
+  CPPUNIT_TEST(checkPath);
+  CPPUNIT_TEST_SUITE_END();
+
+public:
+
+  //Tree (node name[copy]: daughters): 0 Tracker[1]: 1, 6
+  //  1 Layer0[1]: 2 Ladder[1]: 3 Module[1],  1: 4 Ladder[2]: 5 Module[1]
+  //  6 Layer1[2]: 7 Ladder[1]: 8 Support[1]: 9 Module[3]
+  void setUp() {
+    int         parent[] = {-1, 0, 1, 2, 1, 4, 0, 6, 7, 8};
+    int         copy[]   = { 1, 1, 1, 1, 2, 1, 2, 1, 1, 3};
+    const char* name[]   = {"Tracker", "Layer0", "Ladder", "Module", "Ladder",
+			    "Module", "Layer1", "Ladder", "Support", "Module"};
+    parents.assign(parent, parent+10);
+    copyNos.assign(copy, copy+10);
+    names.assign(name, name+10);
+
+    matcher = DDTrackerSpecParMatcher();
+    add("TrackerPar", "//Tracker", "FullTracker");
+    add("LayerPar",   "//Layer0",  "Layer");
+    add("LayerPar",   "//Layer1",  "Layer");
+    add("LadderPar",  "//Ladder",  "Ladder");
+    add("ModulePar",  "//Module",  "Module");
+    add("OtherPar",   "//Support", "");
+    matcher.compile();
+  }
+
+  void checkLevels();
+  void checkFind();
+  void checkPath();
+
+private:
+
+  void add(const std::string & name, const std::string & selector,
+	   const std::string & level) {
+    DDTrackerSpecParMatcher::SpecPar specPar;
+    specPar.name = name;
+    specPar.selectors.push_back(selector);
+    if (!level.empty())
+      specPar.parameters.push_back(std::pair<std::string,std::string>
+				   ("TkDDDStructure", level));
+    matcher.addSpecPar(specPar);
+  }
+
+  std::vector<int> path(int c1, int c2, int c3=-1, int c4=-1) {
+    std::vector<int> result;
+    result.push_back(c1);
+    result.push_back(c2);
+    if (c3 >= 0) result.push_back(c3);
+    if (c4 >= 0) result.push_back(c4);
+    return result;
+  }
+
+  std::vector<int>         parents, copyNos;
+  std::vector<std::string> names;
+  DDTrackerSpecParMatcher  matcher;
+};
+
+CPPUNIT_TEST_SUITE_REGISTRATION(testDDTrackerStructureIndex);
+
+void testDDTrackerStructureIndex::checkLevels() {
+
+  DDTrackerStructureIndex index(parents, names, copyNos, matcher);
+  CPPUNIT_ASSERT(index.levels().size() == 4);
+  CPPUNIT_ASSERT(index.level("Support") == -1);
+  CPPUNIT_ASSERT(index.level(8) == -1);
+  CPPUNIT_ASSERT(index.level(9) == index.level("Module"));
+  CPPUNIT_ASSERT(index.nodes(index.level("Layer")).size() == 2);
+  CPPUNIT_ASSERT(index.nodes(index.level("Module")).size() == 3);
+}
+
+void testDDTrackerStructureIndex::checkFind() {
+
+  DDTrackerStructureIndex index(parents, names, copyNos, matcher);
+  CPPUNIT_ASSERT(index.find("Layer", path(1, 2)) == 6);
+  CPPUNIT_ASSERT(index.find("Ladder", path(1, 1, 2)) == 4);
+  CPPUNIT_ASSERT(index.find("Module", path(1, 1, 2, 1)) == 5);
+  //The support is not a level: the module is found below the ladder
+  CPPUNIT_ASSERT(index.find("Module", path(1, 2, 1, 3)) == 9);
+  CPPUNIT_ASSERT(index.find("Module", path(1, 2, 1, 1)) == -1);
+  CPPUNIT_ASSERT(index.find("Module", path(1, 7, 1, 1)) == -1);
+  CPPUNIT_ASSERT(index.find("Support", path(1, 2)) == -1);
+}
+
+void testDDTrackerStructureIndex::checkPath() {
+
+  DDTrackerStructureIndex index(parents, names, copyNos, matcher);
+  std::vector<int> result;
+  index.path(9, result);
+  CPPUNIT_ASSERT(result == path(1, 2, 1, 3));
+  index.path(8, result);
+  CPPUNIT_ASSERT(result == path(1, 2, 1));
+}
+
+#include "Utilities/Testing/interface/CppUnit_testdriver.icpp"
@@ -0,0 +1,125 @@
+///////////////////////////////////////////////////////////////////////////////
+// File: testDDTrackerVolumeTree.cpp
+// Description: Unit test of the bounding volume hierarchy queries
+///////////////////////////////////////////////////////////////////////////////
+
+#include <cmath>
+#include <algorithm>
+#include <cppunit/extensions/HelperMacros.h>
+
+#include "Geometry/TrackerCommonData/interface/DDTrackerVolumeTree.h"
+
+class testDDTrackerVolumeTree : public CppUnit::TestFixture {
+
+  CPPUNIT_TEST_SUITE(testDDTrackerVolumeTree);
+  CPPUNIT_TEST(checkPoint);
+  CPPUNIT_TEST(checkBox);
+  CPPUNIT_TEST(checkRay);
+  CPPUNIT_TEST(checkInvalid);
+  CPPUNIT_TEST_SUITE_END();
+
+public:
+
+  //Ring of 40 modules (10 x 2 x 60 mm) at a radius of 100 mm, repeated
+  //at 8 positions in z
+  void setUp() {
+    boxes.clear();
+    for (int iz=0; iz<8; iz++) {
+      double z = -280 + 80*iz;
+      for (int iphi=0; iphi<40; iphi++) {
+	double phi = 2*M_PI*iphi/40;
+	double x = 100*cos(phi), y = 100*sin(phi);
+	boxes.push_back(DDTrackerBoundingBox(x-5, y-5, z-30, x+5, y+5,
+					     z+30));
+      }
+    }
+  }
+
+  void checkPoint();
+  void checkBox();
+  void checkRay();
+  void checkInvalid();
+
+private:
+
+  //Brute force box query
+  std::vector<int> overlapping(const DDTrackerBoundingBox & box) {
+    std::vector<int> result;
+    for (unsigned int i=0; i<boxes.size(); i++)
+      if (boxes[i].valid() && boxes[i].overlaps(box)) result.push_back(i);
+    return result;
+  }
+
+  std::vector<DDTrackerBoundingBox> boxes;
+};
+
+CPPUNIT_TEST_SUITE_REGISTRATION(testDDTrackerVolumeTree);
+
+void testDDTrackerVolumeTree::checkPoint() {
+
+  DDTrackerVolumeTree tree(boxes);
+  CPPUNIT_ASSERT(tree.volumes() == (int)(boxes.size()));
+  CPPUNIT_ASSERT(tree.nodes().size() > 1);
+  std::vector<int> hits;
+  tree.findPoint(100, 0, -280, hits);
+  CPPUNIT_ASSERT(hits.size() == 1 && hits[0] == 0);
+  hits.clear();
+  tree.findPoint(0, 0, 0, hits);
+  CPPUNIT_ASSERT(hits.empty());
+}
+
+void testDDTrackerVolumeTree::checkBox() {
+
+  DDTrackerVolumeTree tree(boxes);
+  const double lo[3] = {-120, 20, -100};
+  const double hi[3] = { 40, 120,  60};
+  DDTrackerBoundingBox box(lo[0], lo[1], lo[2], hi[0], hi[1], hi[2]);
+  std::vector<int> hits;
+  tree.findBox(box, hits);
+  std::sort(hits.begin(), hits.end());
+  CPPUNIT_ASSERT(!hits.empty());
+  CPPUNIT_ASSERT(hits == overlapping(box));
+}
+
+void testDDTrackerVolumeTree::checkRay() {
+
+  //Radial ray through the module at phi = 0 of the first z position
+  DDTrackerVolumeTree tree(boxes);
+  std::vector<std::pair<double,int> > hits;
+  tree.findRay(DDTranslation(0, 0, -270), DDTranslation(1, 0, 0), 1000,
+	       hits);
+  CPPUNIT_ASSERT(hits.size() == 1);
+  CPPUNIT_ASSERT(hits[0].second == 0);
+  CPPUNIT_ASSERT(std::fabs(hits[0].first-95) < 1.e-9);
+
+  //Ray along z at the radius of the modules: sorted by distance
+  hits.clear();
+  tree.findRay(DDTranslation(100, 0, -1000), DDTranslation(0, 0, 1), 2000,
+	       hits);
+  CPPUNIT_ASSERT(hits.size() == 8);
+  for (unsigned int i=0; i<hits.size(); i++)
+    CPPUNIT_ASSERT(hits[i].second == (int)(40*i));
+  hits.clear();
+  tree.findRay(DDTranslation(100, 0, -1000), DDTranslation(0, 0, 1), 500,
+	       hits);
+  CPPUNIT_ASSERT(hits.empty());
+}
+
+void testDDTrackerVolumeTree::checkInvalid() {
+
+  //Volumes without a box are counted but never found
+  boxes.push_back(DDTrackerBoundingBox());
+  DDTrackerVolumeTree tree(boxes);
+  CPPUNIT_ASSERT(tree.volumes() == (int)(boxes.size()));
+  std::vector<int> hits;
+  tree.findBox(DDTrackerBoundingBox(-1000, -1000, -1000, 1000, 1000, 1000),
+	       hits);
+  CPPUNIT_ASSERT(hits.size() == boxes.size()-1);
+
+  DDTrackerVolumeTree empty((std::vector<DDTrackerBoundingBox>()));
+  hits.clear();
+  empty.findPoint(0, 0, 0, hits);
+  CPPUNIT_ASSERT(empty.nodes().empty() && hits.empty());
+}
+
+#include "Utilities/Testing/interface/CppUnit_testdriver.icpp"